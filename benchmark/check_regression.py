@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+RTTM Benchmark Regression Check
+
+Compares Google Benchmark JSON results against a stored baseline and fails
+when a tracked benchmark got slower than the allowed threshold.
+
+Usage:
+    ./rttm_benchmark --benchmark_format=json --benchmark_out=rttm.json
+    ./rttm_scaling_benchmark --benchmark_format=json --benchmark_out=scaling.json
+    python check_regression.py --baseline baseline.json rttm.json scaling.json
+
+    # Record new baseline values for the tracked benchmarks
+    python check_regression.py --baseline baseline.json --update rttm.json scaling.json
+
+    # Start tracking benchmarks matching a pattern
+    python check_regression.py --baseline baseline.json --update --track "RTTM_Throughput_.*" scaling.json
+
+Baseline format:
+    {
+      "threshold": 0.15,
+      "benchmarks": { "<benchmark name>": <real time in ns>, ... }
+    }
+
+Only benchmarks listed in the baseline are checked. With repetitions, the
+median aggregate is used. Baselines are machine specific: refresh them with
+--update on the machine that runs the check.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_results(paths):
+    """Map benchmark name -> real time in ns (median aggregate preferred)"""
+    plain = {}
+    medians = {}
+    for path in paths:
+        with open(path, "r") as f:
+            data = json.load(f)
+        for bench in data.get("benchmarks", []):
+            if bench.get("error_occurred"):
+                continue
+            scale = TIME_UNIT_NS.get(bench.get("time_unit", "ns"), 1.0)
+            time_ns = float(bench["real_time"]) * scale
+            if bench.get("run_type") == "aggregate":
+                if bench.get("aggregate_name") == "median":
+                    medians[bench["run_name"]] = time_ns
+            else:
+                # Keep the fastest repetition when no aggregate is reported
+                name = bench.get("run_name", bench["name"])
+                plain[name] = min(time_ns, plain.get(name, time_ns))
+    plain.update(medians)
+    return plain
+
+
+def load_baseline(path):
+    try:
+        with open(path, "r") as f:
+            return json.load(f)
+    except FileNotFoundError:
+        return {"threshold": 0.15, "benchmarks": {}}
+
+
+def update_baseline(path, baseline, results, track):
+    tracked = baseline.setdefault("benchmarks", {})
+    if track:
+        pattern = re.compile(track)
+        for name in results:
+            if pattern.fullmatch(name):
+                tracked[name] = None
+    updated = 0
+    for name in list(tracked):
+        if name in results:
+            tracked[name] = round(results[name], 3)
+            updated += 1
+        else:
+            print(f"warning: tracked benchmark {name} not in results, keeping old value")
+            if tracked[name] is None:
+                del tracked[name]
+    baseline["benchmarks"] = dict(sorted(tracked.items()))
+    with open(path, "w") as f:
+        json.dump(baseline, f, indent=2)
+        f.write("\n")
+    print(f"Updated {updated} baseline entries in {path}")
+    return 0
+
+
+def check(baseline, results, threshold):
+    regressions = []
+    missing = []
+    print(f"{'Benchmark':<60} {'Baseline':>12} {'Current':>12} {'Change':>9}")
+    print("-" * 96)
+    for name, base_ns in baseline.get("benchmarks", {}).items():
+        if name not in results:
+            missing.append(name)
+            continue
+        current_ns = results[name]
+        change = (current_ns - base_ns) / base_ns if base_ns else 0.0
+        flag = ""
+        if change > threshold:
+            regressions.append((name, change))
+            flag = "  REGRESSION"
+        print(f"{name:<60} {base_ns:>10.2f}ns {current_ns:>10.2f}ns {change:>+8.1%}{flag}")
+    print("-" * 96)
+
+    for name in missing:
+        print(f"warning: tracked benchmark {name} missing from results")
+    if regressions:
+        print(f"{len(regressions)} benchmark(s) regressed by more than {threshold:.0%}:")
+        for name, change in regressions:
+            print(f"  {name}: {change:+.1%}")
+        return 1
+    print(f"No regression above {threshold:.0%}")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Check benchmark results against a baseline")
+    parser.add_argument("results", nargs="+", help="Google Benchmark JSON output files")
+    parser.add_argument("--baseline", required=True, help="Baseline JSON file")
+    parser.add_argument("--threshold", type=float,
+                        help="Allowed slowdown as a fraction (default: baseline's threshold)")
+    parser.add_argument("--update", action="store_true", help="Rewrite baseline values from the results")
+    parser.add_argument("--track", help="With --update: also track benchmarks matching this regex")
+    args = parser.parse_args()
+
+    results = load_results(args.results)
+    baseline = load_baseline(args.baseline)
+    if args.update:
+        return update_baseline(args.baseline, baseline, results, args.track)
+
+    threshold = args.threshold if args.threshold is not None else baseline.get("threshold", 0.15)
+    return check(baseline, results, threshold)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
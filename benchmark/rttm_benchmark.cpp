@@ -17,12 +17,24 @@
 #include "RTTM/detail/Instance.hpp"
 #include "benchmark_common.hpp"
 
+#include <array>
+#include <cstring>
+#include <memory_resource>
+
 using namespace rttm;
 
 // ============================================================================
 // Type Registration
 // ============================================================================
 
+// SimpleClass's layout plus a dirty bitset, for the change tracking cost
+struct TrackedClass {
+    int intValue = 0;
+    float floatValue = 0.0f;
+    std::string stringValue;
+    DirtyBits<> dirty;
+};
+
 RTTM_REGISTRATION {
     Registry<Vector3>()
         .property("x", &Vector3::x)
@@ -59,6 +71,12 @@ RTTM_REGISTRATION {
         .property("level5", &DeepClass::level5)
         .property("data", &DeepClass::data)
         .method("compute", &DeepClass::compute);
+
+    Registry<TrackedClass>()
+        .property("intValue", &TrackedClass::intValue)
+        .property("floatValue", &TrackedClass::floatValue)
+        .property("stringValue", &TrackedClass::stringValue)
+        .track_changes(&TrackedClass::dirty);
 }
 
 // ============================================================================
@@ -84,6 +102,36 @@ static void RTTM_TypeLookup_Dynamic(benchmark::State& state) {
 }
 BENCHMARK(RTTM_TypeLookup_Dynamic);
 
+template<int I>
+struct LookupTag {
+    int value = I;
+};
+
+template<int... I>
+static std::vector<std::string> register_lookup_tags(std::integer_sequence<int, I...>) {
+    (Registry<LookupTag<I>>().property("value", &LookupTag<I>::value), ...);
+    return {std::string(rttm::detail::type_name<LookupTag<I>>())...};
+}
+
+// Dynamic lookup cycling through many names (per-thread cache pressure)
+static void RTTM_TypeLookup_Dynamic_ManyNames(benchmark::State& state) {
+    static const std::vector<std::string> all_names =
+        register_lookup_tags(std::make_integer_sequence<int, 64>{});
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    auto& manager = rttm::detail::TypeManager::instance();
+    manager.reset_cache_stats();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        auto handle = RTypeHandle::get(all_names[i]);
+        benchmark::DoNotOptimize(handle);
+        i = (i + 1 == count) ? 0 : i + 1;
+    }
+    const auto& stats = manager.cache_stats();
+    state.counters["hit_rate"] = stats.hits + stats.misses
+        ? static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses) : 0.0;
+}
+BENCHMARK(RTTM_TypeLookup_Dynamic_ManyNames)->Arg(8)->Arg(32)->Arg(64);
+
 // ============================================================================
 // 2. Object Creation Benchmarks
 // ============================================================================
@@ -106,6 +154,17 @@ static void RTTM_ObjectCreation_Complex(benchmark::State& state) {
 }
 BENCHMARK(RTTM_ObjectCreation_Complex);
 
+// Slow path: the type-erased "default" factory instead of default_factory_raw
+static void RTTM_ObjectCreation_FactoryFallback(benchmark::State& state) {
+    const auto* info = rttm::detail::TypeManager::instance().get_type("SimpleClass");
+    const auto& factory = info->factories.find("default")->second;
+    for (auto _ : state) {
+        auto obj = factory();
+        benchmark::DoNotOptimize(obj);
+    }
+}
+BENCHMARK(RTTM_ObjectCreation_FactoryFallback);
+
 // ============================================================================
 // 3. Property Access Benchmarks
 // ============================================================================
@@ -175,6 +234,46 @@ static void RTTM_PropertyWrite_Cached(benchmark::State& state) {
 }
 BENCHMARK(RTTM_PropertyWrite_Cached);
 
+// Same write on a change-tracked type: one extra OR into the dirty bitset
+static void RTTM_PropertyWrite_Cached_Tracked(benchmark::State& state) {
+    TrackedClass obj;
+    
+    auto handle = RTypeHandle::get<TrackedClass>();
+    auto prop = handle.get_property<int>("intValue");
+    
+    int i = 0;
+    for (auto _ : state) {
+        i += obj.intValue;  // dependency chain
+        prop.set(obj, i);
+        benchmark::DoNotOptimize(obj.intValue);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(RTTM_PropertyWrite_Cached_Tracked);
+
+// Variant write through Instance, untracked vs tracked
+template<typename T>
+static void instance_variant_write(benchmark::State& state) {
+    T obj;
+    auto inst = Instance::from_ref(&obj, RTypeHandle::get<T>().type_info());
+    const Variant value = Variant::create(7);
+    
+    for (auto _ : state) {
+        inst.set_property("intValue"_rn, value);
+        benchmark::ClobberMemory();
+    }
+}
+
+static void RTTM_Instance_SetProperty_Variant(benchmark::State& state) {
+    instance_variant_write<SimpleClass>(state);
+}
+BENCHMARK(RTTM_Instance_SetProperty_Variant);
+
+static void RTTM_Instance_SetProperty_Variant_Tracked(benchmark::State& state) {
+    instance_variant_write<TrackedClass>(state);
+}
+BENCHMARK(RTTM_Instance_SetProperty_Variant_Tracked);
+
 // Multiple property access - cached handles
 static void RTTM_PropertyAccess_Multiple(benchmark::State& state) {
     ComplexClass obj;
@@ -222,6 +321,37 @@ static void RTTM_PropertyAccess_Deep(benchmark::State& state) {
 }
 BENCHMARK(RTTM_PropertyAccess_Deep);
 
+// Nested traversal through RType (one shared_ptr<RType> per hop)
+static void RTTM_NestedAccess_RType(benchmark::State& state) {
+    auto obj = std::make_shared<ComplexClass>();
+    obj->position.x = 1.0f;
+    
+    auto rtype = RType::get<ComplexClass>();
+    rtype->attach(obj);
+    
+    float sum = 0;
+    for (auto _ : state) {
+        sum += rtype->property("position")->property<float>("x");
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(RTTM_NestedAccess_RType);
+
+// Nested traversal through BoundType (no allocation)
+static void RTTM_NestedAccess_Bound(benchmark::State& state) {
+    ComplexClass obj;
+    obj.position.x = 1.0f;
+    
+    auto bound = RTypeHandle::get<ComplexClass>().bind(obj);
+    
+    float sum = 0;
+    for (auto _ : state) {
+        sum += bound.property("position").get<float>("x");
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(RTTM_NestedAccess_Bound);
+
 // ============================================================================
 // 4. Method Invocation Benchmarks
 // ============================================================================
@@ -258,6 +388,22 @@ static void RTTM_MethodCall_Cached(benchmark::State& state) {
 }
 BENCHMARK(RTTM_MethodCall_Cached);
 
+// Slow path: the type-erased invoker instead of raw_invoker
+static void RTTM_MethodCall_InvokerFallback(benchmark::State& state) {
+    SimpleClass obj;
+    obj.intValue = 42;
+    
+    const auto* info = rttm::detail::TypeManager::instance().get_type("SimpleClass");
+    const auto& method = info->find_methods("getInt")->front();
+    
+    int sum = 0;
+    for (auto _ : state) {
+        sum += std::any_cast<int>(method.invoker(&obj, {}));
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(RTTM_MethodCall_InvokerFallback);
+
 // Level 1: Full dynamic with arg
 static void RTTM_MethodCall_WithArg_FullDynamic(benchmark::State& state) {
     SimpleClass obj;
@@ -456,6 +602,104 @@ static void RTTM_Batch_PropertyAccess(benchmark::State& state) {
 }
 BENCHMARK(RTTM_Batch_PropertyAccess);
 
+// Batch gather of one field (strided loop, no per-element dispatch)
+static void RTTM_Batch_PropertyGather(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<SimpleClass> objects(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        objects[i].intValue = static_cast<int>(i);
+    }
+    std::vector<int> values(count);
+    
+    auto handle = RTypeHandle::get<SimpleClass>();
+    auto prop = handle.get_property<int>("intValue");
+    
+    for (auto _ : state) {
+        prop.gather(objects, std::span<int>{values});
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(RTTM_Batch_PropertyGather)->Arg(100)->Arg(100000);
+
+// Sum of one field over many objects: row layout through a handle...
+static void RTTM_Batch_FieldSum_Rows(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<SimpleClass> objects(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        objects[i].floatValue = static_cast<float>(i);
+    }
+    auto prop = RTypeHandle::get<SimpleClass>().get_property<float>("floatValue");
+    
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (auto& obj : objects) {
+            sum += prop.get(obj);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(RTTM_Batch_FieldSum_Rows)->Arg(100000);
+
+// ...and the same field as a ReflectedColumns column
+static void RTTM_Batch_FieldSum_Columns(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto columns = rttm::ReflectedColumns::create("SimpleClass");
+    SimpleClass obj;
+    for (std::size_t i = 0; i < count; ++i) {
+        obj.floatValue = static_cast<float>(i);
+        columns.push_back(&obj);
+    }
+    
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (float v : columns.column<float>("floatValue")) {
+            sum += v;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(RTTM_Batch_FieldSum_Columns)->Arg(100000);
+
+// Batch scatter of one field
+static void RTTM_Batch_PropertyScatter(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<SimpleClass> objects(count);
+    std::vector<int> values(count, 7);
+    
+    auto handle = RTypeHandle::get<SimpleClass>();
+    auto prop = handle.get_property<int>("intValue");
+    
+    for (auto _ : state) {
+        prop.scatter(objects, std::span<const int>{values});
+        benchmark::DoNotOptimize(objects.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(RTTM_Batch_PropertyScatter)->Arg(100)->Arg(100000);
+
+// Pure dynamic batch gather (one type check per batch)
+static void RTTM_Batch_DynamicGather(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<SimpleClass> objects(count);
+    std::vector<int> values(count);
+    
+    auto inst = Instance::create("SimpleClass");
+    auto prop = inst.get_property_handle("intValue");
+    
+    for (auto _ : state) {
+        prop.gather(objects.data(), sizeof(SimpleClass), count, values.data());
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(RTTM_Batch_DynamicGather)->Arg(100)->Arg(100000);
+
 // Batch method calls (cached method handle)
 static void RTTM_Batch_MethodCalls(benchmark::State& state) {
     std::vector<SimpleClass> objects(100);
@@ -477,6 +721,55 @@ static void RTTM_Batch_MethodCalls(benchmark::State& state) {
 }
 BENCHMARK(RTTM_Batch_MethodCalls);
 
+// Container traversal: legacy iterator (one RType per element)
+static void RTTM_Container_Iterate_Legacy(benchmark::State& state) {
+    ComplexClass obj;
+    obj.scores.assign(static_cast<std::size_t>(state.range(0)), 1);
+    auto container = make_sequential_container(&obj.scores);
+    
+    for (auto _ : state) {
+        long sum = 0;
+        for (auto it = container->begin(); it->has_current(); it->next()) {
+            sum += *static_cast<int*>(it->current()->raw());
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RTTM_Container_Iterate_Legacy)->Arg(1000)->Arg(100000);
+
+// Container traversal: reflected view, for_each over ElementRefs
+static void RTTM_Container_ForEach(benchmark::State& state) {
+    ComplexClass obj;
+    obj.scores.assign(static_cast<std::size_t>(state.range(0)), 1);
+    auto view = RTypeHandle::get<ComplexClass>().bind_raw(&obj).container("scores");
+    
+    for (auto _ : state) {
+        long sum = 0;
+        view.for_each([&](ElementRef e) { sum += e.as<int>(); });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RTTM_Container_ForEach)->Arg(1000)->Arg(100000);
+
+// Container traversal: contiguous span (bulk read)
+static void RTTM_Container_Span(benchmark::State& state) {
+    ComplexClass obj;
+    obj.scores.assign(static_cast<std::size_t>(state.range(0)), 1);
+    auto view = RTypeHandle::get<ComplexClass>().bind_raw(&obj).container("scores");
+    
+    for (auto _ : state) {
+        long sum = 0;
+        for (int v : view.as_span<int>()) {
+            sum += v;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RTTM_Container_Span)->Arg(1000)->Arg(100000);
+
 // ============================================================================
 // 7. Property Enumeration
 // ============================================================================
@@ -524,6 +817,64 @@ static void RTTM_Instance_Create(benchmark::State& state) {
 }
 BENCHMARK(RTTM_Instance_Create);
 
+// Instance creation into a bump arena (no shared_ptr, no heap)
+static void RTTM_Instance_Create_Arena(benchmark::State& state) {
+    alignas(std::max_align_t) static std::byte buffer[1 << 16];
+    std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer)};
+    const auto* info = rttm::detail::TypeManager::instance().get_type("SimpleClass");
+    std::size_t n = 0;
+    for (auto _ : state) {
+        auto inst = rttm::Instance::create_in(info, arena);
+        benchmark::DoNotOptimize(inst.get_raw());
+        if (++n == 512) {
+            arena.release();
+            n = 0;
+        }
+    }
+}
+BENCHMARK(RTTM_Instance_Create_Arena);
+
+// Bulk creation of one type into a single arena allocation
+static void RTTM_Instance_CreateN_Arena(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::pmr::monotonic_buffer_resource arena;
+    const auto* info = rttm::detail::TypeManager::instance().get_type("SimpleClass");
+    for (auto _ : state) {
+        {
+            auto objects = rttm::Instance::create_n(info, arena, count);
+            benchmark::DoNotOptimize(objects.data());
+        }
+        arena.release();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RTTM_Instance_CreateN_Arena)->Arg(100)->Arg(10000);
+
+// Bulk construction and destruction of a runtime-chosen type
+static void RTTM_ReflectedArray_Create(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto* info = rttm::detail::TypeManager::instance().get_type("SimpleClass");
+    for (auto _ : state) {
+        rttm::ReflectedArray objects(info, count);
+        benchmark::DoNotOptimize(objects.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RTTM_ReflectedArray_Create)->Arg(100)->Arg(10000);
+
+// Bulk copy of a trivially copyable type (one memcpy)
+static void RTTM_ReflectedArray_Copy_Trivial(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto* info = rttm::detail::TypeManager::instance().get_type_by_id(rttm::detail::type_id<Vector3>);
+    rttm::ReflectedArray source(info, count);
+    for (auto _ : state) {
+        rttm::ReflectedArray copy = source;
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RTTM_ReflectedArray_Copy_Trivial)->Arg(100)->Arg(10000);
+
 // Pure dynamic property read (returns Variant)
 static void RTTM_Instance_PropertyRead(benchmark::State& state) {
     auto inst = Instance::create("SimpleClass");
@@ -600,6 +951,46 @@ static void RTTM_Instance_MemberLookup(benchmark::State& state) {
 }
 BENCHMARK(RTTM_Instance_MemberLookup);
 
+// Member lookup with a compile-time hashed name (no runtime hashing)
+static void RTTM_Instance_MemberLookup_Prehashed(benchmark::State& state) {
+    using namespace rttm::literals;
+    auto inst = Instance::create("SimpleClass");
+    const auto* type_info = inst.type_info();
+    
+    for (auto _ : state) {
+        auto member = type_info->find_member("intValue"_rn);
+        benchmark::DoNotOptimize(member);
+    }
+}
+BENCHMARK(RTTM_Instance_MemberLookup_Prehashed);
+
+// Pure dynamic property read with a compile-time hashed name
+static void RTTM_Instance_PropertyRead_Prehashed(benchmark::State& state) {
+    using namespace rttm::literals;
+    auto inst = Instance::create("SimpleClass");
+    inst.set_property_value("intValue"_rn, 42);
+    
+    int sum = 0;
+    for (auto _ : state) {
+        sum += inst.get_property_value<int>("intValue"_rn);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(RTTM_Instance_PropertyRead_Prehashed);
+
+// Pure dynamic property read by member ordinal (array index, no hashing)
+static void RTTM_Instance_PropertyRead_Ordinal(benchmark::State& state) {
+    auto inst = Instance::create("SimpleClass");
+    inst.set_property_value("intValue", 42);
+    const std::size_t ordinal = inst.type_info()->member_ordinal("intValue");
+    
+    for (auto _ : state) {
+        Variant v = inst.get_property(ordinal);
+        benchmark::DoNotOptimize(v.get_raw());
+    }
+}
+BENCHMARK(RTTM_Instance_PropertyRead_Ordinal);
+
 // Test raw property write (no lookup, just write)
 static void RTTM_Instance_RawPropertyWrite(benchmark::State& state) {
     auto inst = Instance::create("SimpleClass");
@@ -708,6 +1099,21 @@ static void RTTM_Instance_MethodCall(benchmark::State& state) {
 }
 BENCHMARK(RTTM_Instance_MethodCall);
 
+// Pure dynamic method call by method ordinal
+static void RTTM_Instance_MethodCall_Ordinal(benchmark::State& state) {
+    auto inst = Instance::create("SimpleClass");
+    inst.set_property_value("intValue", 42);
+    const std::size_t ordinal = inst.type_info()->method_ordinal("getInt");
+    
+    int sum = 0;
+    for (auto _ : state) {
+        Variant result = inst.invoke(ordinal);
+        sum += result.get<int>();
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(RTTM_Instance_MethodCall_Ordinal);
+
 // Pure dynamic method call with args
 static void RTTM_Instance_MethodCall_WithArg(benchmark::State& state) {
     auto inst = Instance::create("SimpleClass");
@@ -767,6 +1173,397 @@ static void RTTM_DynamicMethod_Call_WithArg_Cached(benchmark::State& state) {
 }
 BENCHMARK(RTTM_DynamicMethod_Call_WithArg_Cached);
 
+// Precompiled CallSite (no args): overload and layout resolved once
+static void RTTM_CallSite_Call(benchmark::State& state) {
+    auto inst = Instance::create("SimpleClass");
+    inst.set_property_value("intValue", 42);
+    auto site = inst.get_call_site<>("getInt");
+    void* obj = inst.get_raw();
+    
+    int sum = 0;
+    Variant result;
+    for (auto _ : state) {
+        site.call(obj, nullptr, &result);
+        sum += result.get_unchecked<int>();
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(RTTM_CallSite_Call);
+
+// Precompiled CallSite (with arg)
+static void RTTM_CallSite_Call_WithArg(benchmark::State& state) {
+    auto inst = Instance::create("SimpleClass");
+    auto site = inst.get_call_site<int>("setInt");
+    void* obj = inst.get_raw();
+    
+    int i = 0;
+    for (auto _ : state) {
+        std::array<Variant, 1> args = {Variant::create(i++)};
+        site.call(obj, args.data(), nullptr);
+        benchmark::DoNotOptimize(obj);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(RTTM_CallSite_Call_WithArg);
+
+// Precompiled CallSite with a precomputed argument conversion (double -> int)
+static void RTTM_CallSite_Call_Converting(benchmark::State& state) {
+    auto inst = Instance::create("SimpleClass");
+    auto site = inst.get_call_site<double>("setInt");
+    void* obj = inst.get_raw();
+    
+    double d = 0;
+    for (auto _ : state) {
+        std::array<Variant, 1> args = {Variant::create(d += 1.0)};
+        site.call(obj, args.data(), nullptr);
+        benchmark::DoNotOptimize(obj);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(RTTM_CallSite_Call_Converting);
+
+// ============================================================================
+// Variant Storage - inline buffer vs heap
+// ============================================================================
+
+// Buffer too small for std::string and Vector3: forces the heap path
+using HeapVariant = BasicVariant<8>;
+
+// Read a property into a Variant and copy it once (typical get/forward pattern)
+template<typename V, typename T>
+static void variant_property_roundtrip(benchmark::State& state, std::string_view name, const T& value) {
+    ComplexClass obj;
+    auto prop = RTypeHandle::get<ComplexClass>().get_property<T>(name);
+    prop.set(obj, value);
+    
+    for (auto _ : state) {
+        V v = V::create(prop.get(obj));
+        V copy = v;
+        benchmark::DoNotOptimize(copy.get_raw());
+    }
+}
+
+static void RTTM_Variant_String_Heap(benchmark::State& state) {
+    variant_property_roundtrip<HeapVariant>(state, "name", std::string("player_one"));
+}
+BENCHMARK(RTTM_Variant_String_Heap);
+
+static void RTTM_Variant_String_Inline(benchmark::State& state) {
+    variant_property_roundtrip<Variant>(state, "name", std::string("player_one"));
+}
+BENCHMARK(RTTM_Variant_String_Inline);
+
+static void RTTM_Variant_Vector3_Heap(benchmark::State& state) {
+    variant_property_roundtrip<HeapVariant>(state, "position", Vector3{1.0f, 2.0f, 3.0f});
+}
+BENCHMARK(RTTM_Variant_Vector3_Heap);
+
+static void RTTM_Variant_Vector3_Inline(benchmark::State& state) {
+    variant_property_roundtrip<Variant>(state, "position", Vector3{1.0f, 2.0f, 3.0f});
+}
+BENCHMARK(RTTM_Variant_Vector3_Inline);
+
+// ============================================================================
+// Binary Serialization - compiled plan vs per-member DynamicProperty
+// ============================================================================
+
+static ComplexClass make_serialization_sample() {
+    ComplexClass obj;
+    obj.id = 7;
+    obj.name = "player_one";
+    obj.position = Vector3{1.0f, 2.0f, 3.0f};
+    obj.scores.assign(64, 3);
+    return obj;
+}
+
+// Naive encoding: one Variant per property, type-switched by hand
+static std::size_t naive_serialize(const std::vector<DynamicProperty>& props, void* obj, std::byte* out) {
+    std::byte* cur = out;
+    auto put = [&](const void* src, std::size_t n) {
+        std::memcpy(cur, src, n);
+        cur += n;
+    };
+    for (const auto& prop : props) {
+        Variant v = prop.get_value(obj);
+        if (const int* i = v.try_get<int>()) {
+            put(i, sizeof(int));
+        } else if (const Vector3* p = v.try_get<Vector3>()) {
+            put(p, sizeof(Vector3));
+        } else if (const std::string* str = v.try_get<std::string>()) {
+            const std::size_t n = str->size();
+            put(&n, sizeof(n));
+            put(str->data(), n);
+        } else if (const auto* vec = v.try_get<std::vector<int>>()) {
+            const std::size_t n = vec->size();
+            put(&n, sizeof(n));
+            put(vec->data(), n * sizeof(int));
+        }
+    }
+    return static_cast<std::size_t>(cur - out);
+}
+
+static void RTTM_Serialize_Naive(benchmark::State& state) {
+    ComplexClass obj = make_serialization_sample();
+    auto inst = Instance::from_ref(&obj, RTypeHandle::get<ComplexClass>().type_info());
+    std::vector<DynamicProperty> props;
+    for (auto name : inst.property_names()) {
+        props.push_back(inst.get_property_handle(name));
+    }
+    std::vector<std::byte> buffer(4096);
+    
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(naive_serialize(props, &obj, buffer.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(naive_serialize(props, &obj, buffer.data())));
+}
+BENCHMARK(RTTM_Serialize_Naive);
+
+static void RTTM_Serialize_Plan(benchmark::State& state) {
+    ComplexClass obj = make_serialization_sample();
+    std::vector<std::byte> buffer(4096);
+    
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(serialize(obj, buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(serialized_size(obj)));
+}
+BENCHMARK(RTTM_Serialize_Plan);
+
+static void RTTM_Deserialize_Plan(benchmark::State& state) {
+    ComplexClass obj = make_serialization_sample();
+    std::vector<std::byte> buffer;
+    serialize_append(obj, buffer);
+    ComplexClass out;
+    
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(deserialize(out, buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(RTTM_Deserialize_Plan);
+
+// Flat type: all five ints merge into one memcpy span
+static void RTTM_Serialize_Plan_Flat(benchmark::State& state) {
+    DeepClass obj;
+    obj.level1 = 1;
+    obj.data = "payload";
+    std::array<std::byte, 256> buffer;
+    
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(serialize(obj, buffer));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(RTTM_Serialize_Plan_Flat);
+
+// ============================================================================
+// JSON - streaming plan vs per-field Instance::set_property loader
+// ============================================================================
+
+// What the config loader does today: values already decoded into Variants
+// (parsing not even counted), applied one set_property per field
+static void apply_fields(Instance& inst, const std::vector<std::pair<std::string, Variant>>& fields) {
+    for (const auto& [name, value] : fields) {
+        inst.set_property(std::string_view{name}, value);
+    }
+}
+
+static std::vector<std::pair<std::string, Variant>> loader_fields(const ComplexClass& obj) {
+    return {
+        {"id", Variant::create(obj.id)},
+        {"name", Variant::create(obj.name)},
+        {"position", Variant::create(obj.position)},
+        {"scores", Variant::create(obj.scores)},
+    };
+}
+
+static void RTTM_Json_Write_Complex(benchmark::State& state) {
+    ComplexClass obj = make_serialization_sample();
+    std::string out;
+
+    for (auto _ : state) {
+        out.clear();
+        to_json_append(obj, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(out.size()));
+}
+BENCHMARK(RTTM_Json_Write_Complex);
+
+static void RTTM_Json_Read_Complex(benchmark::State& state) {
+    const std::string text = to_json(make_serialization_sample());
+    ComplexClass out;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from_json(out, text));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(RTTM_Json_Read_Complex);
+
+static void RTTM_Loader_SetProperty_Complex(benchmark::State& state) {
+    const auto fields = loader_fields(make_serialization_sample());
+    ComplexClass out;
+    auto inst = Instance::from_ref(&out, RTypeHandle::get<ComplexClass>().type_info());
+
+    for (auto _ : state) {
+        apply_fields(inst, fields);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(RTTM_Loader_SetProperty_Complex);
+
+// Large arrays: the contiguous number path against a whole-vector Variant copy
+static ComplexClass make_large_sample(std::size_t count) {
+    ComplexClass obj = make_serialization_sample();
+    obj.scores.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        obj.scores[i] = static_cast<int>(i * 2654435761u % 100000) - 50000;
+    }
+    return obj;
+}
+
+static void RTTM_Json_Write_LargeVector(benchmark::State& state) {
+    ComplexClass obj = make_large_sample(static_cast<std::size_t>(state.range(0)));
+    std::string out;
+
+    for (auto _ : state) {
+        out.clear();
+        to_json_append(obj, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(out.size()));
+}
+BENCHMARK(RTTM_Json_Write_LargeVector)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
+static void RTTM_Json_Read_LargeVector(benchmark::State& state) {
+    const std::string text = to_json(make_large_sample(static_cast<std::size_t>(state.range(0))));
+    ComplexClass out;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(from_json(out, text));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(RTTM_Json_Read_LargeVector)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
+static void RTTM_Loader_SetProperty_LargeVector(benchmark::State& state) {
+    const auto fields = loader_fields(make_large_sample(static_cast<std::size_t>(state.range(0))));
+    ComplexClass out;
+    auto inst = Instance::from_ref(&out, RTypeHandle::get<ComplexClass>().type_info());
+
+    for (auto _ : state) {
+        apply_fields(inst, fields);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(RTTM_Loader_SetProperty_LargeVector)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
+// ============================================================================
+// State Diff - compiled diff plan vs per-property Variant comparison
+// ============================================================================
+
+// Today's change detection: read both sides through DynamicProperty and
+// compare the Variants by hand
+static std::size_t naive_changed_count(const std::vector<DynamicProperty>& props, void* old_obj, void* new_obj) {
+    std::size_t changed = 0;
+    for (const auto& prop : props) {
+        Variant a = prop.get_value(old_obj);
+        Variant b = prop.get_value(new_obj);
+        bool equal = false;
+        if (const int* i = a.try_get<int>()) {
+            equal = *i == b.get<int>();
+        } else if (const Vector3* p = a.try_get<Vector3>()) {
+            const Vector3& q = b.get<Vector3>();
+            equal = p->x == q.x && p->y == q.y && p->z == q.z;
+        } else if (const std::string* str = a.try_get<std::string>()) {
+            equal = *str == b.get<std::string>();
+        } else if (const auto* vec = a.try_get<std::vector<int>>()) {
+            equal = *vec == b.get<std::vector<int>>();
+        }
+        changed += equal ? 0 : 1;
+    }
+    return changed;
+}
+
+static void RTTM_Diff_Naive_Variant(benchmark::State& state) {
+    ComplexClass old_obj = make_serialization_sample();
+    ComplexClass new_obj = old_obj;
+    new_obj.scores[10] = 4;
+    auto inst = Instance::from_ref(&new_obj, RTypeHandle::get<ComplexClass>().type_info());
+    std::vector<DynamicProperty> props;
+    for (auto name : inst.property_names()) {
+        props.push_back(inst.get_property_handle(name));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(naive_changed_count(props, &old_obj, &new_obj));
+    }
+}
+BENCHMARK(RTTM_Diff_Naive_Variant);
+
+static void RTTM_Diff_Unchanged(benchmark::State& state) {
+    ComplexClass obj = make_serialization_sample();
+    const Snapshot snap = snapshot(obj);
+    std::vector<std::byte> patch;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(diff(snap, obj, patch));
+    }
+}
+BENCHMARK(RTTM_Diff_Unchanged);
+
+static void RTTM_Diff_OneElement(benchmark::State& state) {
+    ComplexClass obj = make_serialization_sample();
+    const Snapshot snap = snapshot(obj);
+    obj.scores[10] = 4;
+    std::vector<std::byte> patch;
+
+    for (auto _ : state) {
+        patch.clear();
+        benchmark::DoNotOptimize(diff(snap, obj, patch));
+    }
+    state.counters["patch_bytes"] = static_cast<double>(patch.size());
+}
+BENCHMARK(RTTM_Diff_OneElement);
+
+static void RTTM_ApplyPatch_OneElement(benchmark::State& state) {
+    ComplexClass obj = make_serialization_sample();
+    ComplexClass mirror = obj;
+    const Snapshot snap = snapshot(obj);
+    obj.scores[10] = 4;
+    std::vector<std::byte> patch;
+    diff(snap, obj, patch);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(apply_patch(mirror, patch));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(RTTM_ApplyPatch_OneElement);
+
+// One dirty element in a large vector: block memcmp skips the clean parts
+static void RTTM_Diff_LargeVector(benchmark::State& state) {
+    ComplexClass obj = make_large_sample(static_cast<std::size_t>(state.range(0)));
+    const Snapshot snap = snapshot(obj);
+    obj.scores[obj.scores.size() / 2] += 1;
+    std::vector<std::byte> patch;
+
+    for (auto _ : state) {
+        patch.clear();
+        benchmark::DoNotOptimize(diff(snap, obj, patch));
+    }
+    state.counters["patch_bytes"] = static_cast<double>(patch.size());
+}
+BENCHMARK(RTTM_Diff_LargeVector)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+
 // ============================================================================
 // 8. Baseline - Direct Access (for comparison, 8x unrolled)
 // ============================================================================
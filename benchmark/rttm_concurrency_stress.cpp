@@ -0,0 +1,226 @@
+/**
+ * @file rttm_concurrency_stress.cpp
+ * @brief Multithreaded stress test for shared read-only reflection use
+ *
+ * Every round starts all threads on a fresh shared RType at once, so the
+ * first lookups (inline cache fills) race with each other. Threads also
+ * share TypeInfo lookups and TypeManager queries, and drive their own
+ * Instances through names and ordinals. Build with -DRTTM_ENABLE_TSAN=ON
+ * and run it to check the library is free of data races:
+ *
+ *     rttm_concurrency_stress [threads] [rounds]
+ *
+ * Exits with a non-zero status if any thread observes a wrong value.
+ */
+
+#include "RTTM/RTTM.hpp"
+#include "RTTM/detail/Instance.hpp"
+#include "benchmark_common.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <latch>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace rttm;
+
+/**
+ * @brief More properties and methods than RType's inline caches hold
+ */
+struct WideClass {
+    int p0 = 0, p1 = 0, p2 = 0, p3 = 0, p4 = 0, p5 = 0;
+    int p6 = 0, p7 = 0, p8 = 0, p9 = 0, p10 = 0, p11 = 0;
+
+    int get0() const { return p0; }
+    int get1() const { return p1; }
+    int get2() const { return p2; }
+    int get3() const { return p3; }
+    int get4() const { return p4; }
+    int get5() const { return p5; }
+};
+
+RTTM_REGISTRATION {
+    Registry<Vector3>()
+        .property("x", &Vector3::x)
+        .property("y", &Vector3::y)
+        .property("z", &Vector3::z)
+        .method("length", &Vector3::length);
+
+    Registry<SimpleClass>()
+        .property("intValue", &SimpleClass::intValue)
+        .property("floatValue", &SimpleClass::floatValue)
+        .property("stringValue", &SimpleClass::stringValue)
+        .method("getInt", &SimpleClass::getInt)
+        .method("setInt", &SimpleClass::setInt)
+        .method("getFloat", &SimpleClass::getFloat);
+
+    Registry<DeepClass>()
+        .property("level1", &DeepClass::level1)
+        .property("level2", &DeepClass::level2)
+        .property("level3", &DeepClass::level3)
+        .property("level4", &DeepClass::level4)
+        .property("level5", &DeepClass::level5)
+        .property("data", &DeepClass::data);
+
+    Registry<WideClass>()
+        .property("p0", &WideClass::p0)
+        .property("p1", &WideClass::p1)
+        .property("p2", &WideClass::p2)
+        .property("p3", &WideClass::p3)
+        .property("p4", &WideClass::p4)
+        .property("p5", &WideClass::p5)
+        .property("p6", &WideClass::p6)
+        .property("p7", &WideClass::p7)
+        .property("p8", &WideClass::p8)
+        .property("p9", &WideClass::p9)
+        .property("p10", &WideClass::p10)
+        .property("p11", &WideClass::p11)
+        .method("get0", &WideClass::get0)
+        .method("get1", &WideClass::get1)
+        .method("get2", &WideClass::get2)
+        .method("get3", &WideClass::get3)
+        .method("get4", &WideClass::get4)
+        .method("get5", &WideClass::get5);
+}
+
+namespace {
+
+std::atomic<std::size_t> failures{0};
+
+void check(bool ok, const char* what) {
+    if (!ok) [[unlikely]] {
+        if (failures.fetch_add(1, std::memory_order_relaxed) < 10) {
+            std::fprintf(stderr, "mismatch: %s\n", what);
+        }
+    }
+}
+
+/**
+ * @brief Objects shared (read-only) by all threads of one round
+ */
+struct SharedRound {
+    SimpleClass simple;
+    DeepClass deep;
+    WideClass wide;
+    std::shared_ptr<RType> simple_type = RType::get<SimpleClass>();
+    std::shared_ptr<RType> deep_type = RType::get("DeepClass");
+    std::shared_ptr<RType> wide_type = RType::get<WideClass>();
+
+    explicit SharedRound(int seed) {
+        simple.intValue = seed;
+        simple.floatValue = static_cast<float>(seed) * 0.5f;
+        deep.level1 = seed + 1;
+        deep.level2 = seed + 2;
+        deep.level3 = seed + 3;
+        deep.level4 = seed + 4;
+        deep.level5 = seed + 5;
+        int* fields[] = {&wide.p0, &wide.p1, &wide.p2, &wide.p3, &wide.p4, &wide.p5,
+                         &wide.p6, &wide.p7, &wide.p8, &wide.p9, &wide.p10, &wide.p11};
+        for (int i = 0; i < 12; ++i) {
+            *fields[i] = seed * 16 + i;
+        }
+        simple_type->attach(simple);
+        deep_type->attach(deep);
+        wide_type->attach(wide);
+    }
+};
+
+void shared_rtype_reads(SharedRound& round, int seed, int iterations) {
+    for (int i = 0; i < iterations; ++i) {
+        check(round.simple_type->property<int>("intValue") == seed, "RType::property<int>");
+        check(round.simple_type->property<float>("floatValue") == static_cast<float>(seed) * 0.5f,
+              "RType::property<float>");
+        check(round.simple_type->invoke<int>("getInt") == seed, "RType::invoke getInt");
+        check(round.simple_type->invoke<float>("getFloat") == static_cast<float>(seed) * 0.5f,
+              "RType::invoke getFloat");
+
+        check(round.deep_type->property<int>("level1") == seed + 1, "RType::property level1");
+        check(round.deep_type->property<int>("level3") == seed + 3, "RType::property level3");
+        check(round.deep_type->property<int>("level5") == seed + 5, "RType::property level5");
+        check(round.deep_type->property<std::string>("data").empty(), "RType::property data");
+
+        // 12 properties and 6 methods against caches of 8 and 4: every
+        // lap overwrites entries while other threads hit them, so a torn
+        // key/value pair shows up as another member's value
+        static constexpr const char* wide_properties[] = {"p0", "p1", "p2", "p3", "p4", "p5",
+                                                          "p6", "p7", "p8", "p9", "p10", "p11"};
+        static constexpr const char* wide_methods[] = {"get0", "get1", "get2", "get3", "get4", "get5"};
+        const int base = (i * 5) % 12;
+        for (int k = 0; k < 12; ++k) {
+            const int index = (base + k) % 12;
+            check(round.wide_type->property<int>(wide_properties[index]) == seed * 16 + index,
+                  "RType::property (evicting)");
+        }
+        for (int k = 0; k < 6; ++k) {
+            const int index = (base + k) % 6;
+            check(round.wide_type->invoke<int>(wide_methods[index]) == seed * 16 + index,
+                  "RType::invoke (evicting)");
+        }
+    }
+}
+
+void shared_type_info_reads(int iterations) {
+    auto& mgr = detail::TypeManager::instance();
+    for (int i = 0; i < iterations; ++i) {
+        const detail::TypeInfo* info = mgr.get_type("SimpleClass");
+        check(info != nullptr, "TypeManager::get_type");
+        if (!info) return;
+        check(info->find_member("intValue") == info->member_at(info->member_ordinal("intValue")),
+              "TypeInfo member ordinal");
+        check(info->find_methods("getInt") != nullptr, "TypeInfo::find_methods");
+        check(mgr.get_type_by_id(detail::type_id<Vector3>) != nullptr, "TypeManager::get_type_by_id");
+    }
+}
+
+void own_instance_calls(int seed, int iterations) {
+    auto inst = Instance::create("SimpleClass");
+    const detail::TypeInfo* info = inst.type_info();
+    const std::size_t int_value = info->member_ordinal("intValue");
+    const std::size_t get_int = info->method_ordinal("getInt");
+
+    for (int i = 0; i < iterations; ++i) {
+        Variant set_result = inst.invoke("setInt", seed + i);
+        check(inst.get_property(int_value).get<int>() == seed + i, "Instance::get_property(ordinal)");
+        check(inst.invoke(get_int).get<int>() == seed + i, "Instance::invoke(ordinal)");
+    }
+
+    Vector3 v{3.0f, 4.0f, 0.0f};
+    auto ref = Instance::from_ref(&v, detail::TypeManager::instance().get_type_by_id(detail::type_id<Vector3>));
+    check(ref.invoke("length").get<float>() == 5.0f, "Instance::invoke length");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int threads = argc > 1 ? std::atoi(argv[1])
+                                 : static_cast<int>(std::clamp(std::thread::hardware_concurrency(), 2u, 16u));
+    const int rounds = argc > 2 ? std::atoi(argv[2]) : 200;
+    constexpr int kIterations = 64;
+
+    for (int round_index = 0; round_index < rounds; ++round_index) {
+        SharedRound round(round_index);
+        std::latch start(threads);
+        std::vector<std::thread> workers;
+        workers.reserve(static_cast<std::size_t>(threads));
+
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                start.arrive_and_wait();
+                shared_rtype_reads(round, round_index, kIterations);
+                shared_type_info_reads(kIterations);
+                own_instance_calls(t * 1000, kIterations);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    const std::size_t failed = failures.load();
+    std::printf("%d threads x %d rounds: %zu mismatches\n", threads, rounds, failed);
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
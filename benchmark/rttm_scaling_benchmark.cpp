@@ -0,0 +1,353 @@
+/**
+ * @file rttm_scaling_benchmark.cpp
+ * @brief RTTM scaling and throughput regression suite
+ *
+ * Benchmark categories:
+ * 1. Contention - TypeManager::get_type / RType::get at 1..N threads
+ * 2. Concurrent Instance - create and invoke at 1..N threads
+ * 3. Large Registries - lookup with 1k-10k synthetic types of 128 members
+ * 4. Throughput - serialization and container iteration (bytes/items per second)
+ * 5. Frozen Registry - lock-free snapshot lookups (runs last: freeze() is global)
+ *
+ * The tracked subset is compared against benchmark/baseline.json by the
+ * rttm_benchmark_regression target (see check_regression.py).
+ */
+
+#include <benchmark/benchmark.h>
+#include "RTTM/RTTM.hpp"
+#include "RTTM/detail/Instance.hpp"
+#include "benchmark_common.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rttm;
+
+// ============================================================================
+// Type Registration
+// ============================================================================
+
+RTTM_REGISTRATION {
+    Registry<Vector3>()
+        .property("x", &Vector3::x)
+        .property("y", &Vector3::y)
+        .property("z", &Vector3::z)
+        .method("length", &Vector3::length);
+
+    Registry<SimpleClass>()
+        .property("intValue", &SimpleClass::intValue)
+        .property("floatValue", &SimpleClass::floatValue)
+        .property("stringValue", &SimpleClass::stringValue)
+        .method("getInt", &SimpleClass::getInt)
+        .method("setInt", &SimpleClass::setInt);
+
+    Registry<ComplexClass>()
+        .property("id", &ComplexClass::id)
+        .property("name", &ComplexClass::name)
+        .property("position", &ComplexClass::position)
+        .property("scores", &ComplexClass::scores);
+}
+
+static int max_bench_threads() {
+    return static_cast<int>(std::clamp(std::thread::hardware_concurrency(), 2u, 16u));
+}
+
+// ============================================================================
+// Synthetic registry
+// ============================================================================
+
+namespace {
+
+constexpr std::size_t kSyntheticMembers = 128;
+
+/**
+ * @brief Storage layout shared by every synthetic type
+ */
+struct SyntheticObject {
+    int fields[kSyntheticMembers] = {};
+};
+
+struct SyntheticField {
+    int value = 0;
+};
+
+/**
+ * @brief Registers "Synthetic_<i>" types on demand (never unregistered)
+ *
+ * Each type has kSyntheticMembers int members "m0".."m127" laid out over
+ * SyntheticObject, built from one described member with adjusted offsets.
+ */
+class SyntheticRegistry {
+public:
+    static SyntheticRegistry& instance() {
+        static SyntheticRegistry registry;
+        return registry;
+    }
+
+    const std::vector<std::string>& ensure(std::size_t count) {
+        std::lock_guard lock(mutex_);
+        const detail::MemberInfo prototype =
+            Registry<SyntheticField>::describe_member("value", &SyntheticField::value);
+        while (names_.size() < count) {
+            std::string name = "Synthetic_" + std::to_string(names_.size());
+            detail::TypeInfo info = Registry<SyntheticObject>::describe_type();
+            info.name = name;
+            for (std::size_t m = 0; m < kSyntheticMembers; ++m) {
+                detail::MemberInfo member = prototype;
+                member.name = member_names_[m];
+                member.offset = m * sizeof(int);
+                info.add_member(std::move(member));
+            }
+            info.seal();
+            detail::TypeManager::instance().register_type(name, std::move(info));
+            names_.push_back(std::move(name));
+        }
+        return names_;
+    }
+
+    const std::string& member_name(std::size_t i) const { return member_names_[i]; }
+
+private:
+    SyntheticRegistry() {
+        for (std::size_t m = 0; m < kSyntheticMembers; ++m) {
+            member_names_.push_back("m" + std::to_string(m));
+        }
+    }
+
+    std::mutex mutex_;
+    std::vector<std::string> names_;
+    std::vector<std::string> member_names_;
+};
+
+/**
+ * @brief Pseudo-random lookup order over the first count names (fixed seed)
+ */
+std::vector<std::size_t> lookup_order(std::size_t count, std::size_t length) {
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::size_t> pick(0, count - 1);
+    std::vector<std::size_t> order(length);
+    for (auto& i : order) {
+        i = pick(rng);
+    }
+    return order;
+}
+
+} // namespace
+
+// ============================================================================
+// 1. Contention
+// ============================================================================
+
+// Same name from every thread (thread-local cache hits, shared lock on miss)
+static void RTTM_Contended_GetType(benchmark::State& state) {
+    auto& manager = detail::TypeManager::instance();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.get_type("SimpleClass"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RTTM_Contended_GetType)->ThreadRange(1, max_bench_threads())->UseRealTime();
+
+// Many names per thread: every lookup misses the thread-local cache
+static void RTTM_Contended_GetType_Miss(benchmark::State& state) {
+    const auto& names = SyntheticRegistry::instance().ensure(1000);
+    const auto order = lookup_order(names.size(), 4096);
+    auto& manager = detail::TypeManager::instance();
+    std::size_t i = static_cast<std::size_t>(state.thread_index()) * 97;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.get_type(names[order[i++ & 4095]]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RTTM_Contended_GetType_Miss)->ThreadRange(1, max_bench_threads())->UseRealTime();
+
+static void RTTM_Contended_RTypeGet(benchmark::State& state) {
+    for (auto _ : state) {
+        auto type = RType::get("SimpleClass");
+        benchmark::DoNotOptimize(type.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RTTM_Contended_RTypeGet)->ThreadRange(1, max_bench_threads())->UseRealTime();
+
+// ============================================================================
+// 2. Concurrent Instance
+// ============================================================================
+
+static void RTTM_Concurrent_InstanceCreate(benchmark::State& state) {
+    for (auto _ : state) {
+        auto inst = Instance::create("SimpleClass");
+        benchmark::DoNotOptimize(inst.get_raw());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RTTM_Concurrent_InstanceCreate)->ThreadRange(1, max_bench_threads())->UseRealTime();
+
+static void RTTM_Concurrent_InstanceInvoke(benchmark::State& state) {
+    auto inst = Instance::create("SimpleClass");
+    int i = 0;
+    for (auto _ : state) {
+        Variant set_result = inst.invoke("setInt", i++);
+        Variant result = inst.invoke("getInt");
+        benchmark::DoNotOptimize(set_result);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(RTTM_Concurrent_InstanceInvoke)->ThreadRange(1, max_bench_threads())->UseRealTime();
+
+// ============================================================================
+// 3. Large Registries
+// ============================================================================
+
+// Random type lookups over registries of growing size
+static void RTTM_LargeRegistry_TypeLookup(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto& names = SyntheticRegistry::instance().ensure(count);
+    const auto order = lookup_order(count, 4096);
+    auto& manager = detail::TypeManager::instance();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.get_type(names[order[i++ & 4095]]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RTTM_LargeRegistry_TypeLookup)->Arg(1000)->Arg(10000);
+
+// Random (type, member) lookups: sealed tables of 128 members each
+static void RTTM_LargeRegistry_MemberLookup(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto& synthetic = SyntheticRegistry::instance();
+    const auto& names = synthetic.ensure(count);
+    std::vector<const detail::TypeInfo*> types;
+    for (std::size_t t = 0; t < count; ++t) {
+        types.push_back(detail::TypeManager::instance().get_type(names[t]));
+    }
+    const auto type_order = lookup_order(count, 4096);
+    const auto member_order = lookup_order(kSyntheticMembers, 4096);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const std::size_t k = i++ & 4095;
+        benchmark::DoNotOptimize(types[type_order[k]]->find_member(synthetic.member_name(member_order[k])));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RTTM_LargeRegistry_MemberLookup)->Arg(1000)->Arg(10000);
+
+// Dynamic property read through Instance on a 128-member type
+static void RTTM_LargeRegistry_PropertyRead(benchmark::State& state) {
+    const auto& names = SyntheticRegistry::instance().ensure(1000);
+    SyntheticObject object;
+    auto inst = Instance::from_ref(&object, detail::TypeManager::instance().get_type(names[500]));
+    const auto member_order = lookup_order(kSyntheticMembers, 4096);
+    auto& synthetic = SyntheticRegistry::instance();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        Variant value = inst.get_property(synthetic.member_name(member_order[i++ & 4095]));
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RTTM_LargeRegistry_PropertyRead);
+
+// ============================================================================
+// 4. Throughput
+// ============================================================================
+
+static ComplexClass make_throughput_sample(std::size_t scores) {
+    ComplexClass obj;
+    obj.id = 7;
+    obj.name = "throughput sample";
+    obj.position = {1.0f, 2.0f, 3.0f};
+    obj.scores.assign(scores, 5);
+    return obj;
+}
+
+static void RTTM_Throughput_Serialize(benchmark::State& state) {
+    const ComplexClass obj = make_throughput_sample(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::byte> buffer(serialized_size(obj));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(serialize(obj, buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(RTTM_Throughput_Serialize)->Arg(16)->Arg(4096);
+
+static void RTTM_Throughput_Deserialize(benchmark::State& state) {
+    const ComplexClass obj = make_throughput_sample(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::byte> buffer(serialized_size(obj));
+    serialize(obj, buffer);
+    ComplexClass out;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(deserialize(out, buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(RTTM_Throughput_Deserialize)->Arg(16)->Arg(4096);
+
+// Serialization from every thread (plan cache is shared)
+static void RTTM_Throughput_Serialize_Concurrent(benchmark::State& state) {
+    const ComplexClass obj = make_throughput_sample(64);
+    std::vector<std::byte> buffer(serialized_size(obj));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(serialize(obj, buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(RTTM_Throughput_Serialize_Concurrent)->ThreadRange(1, max_bench_threads())->UseRealTime();
+
+static void RTTM_Throughput_ContainerForEach(benchmark::State& state) {
+    ComplexClass obj = make_throughput_sample(static_cast<std::size_t>(state.range(0)));
+    auto view = RTypeHandle::get<ComplexClass>().bind_raw(&obj).container("scores");
+    for (auto _ : state) {
+        long sum = 0;
+        view.for_each([&](ElementRef e) { sum += e.as<int>(); });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RTTM_Throughput_ContainerForEach)->Arg(1000)->Arg(100000);
+
+static void RTTM_Throughput_ContainerSpan(benchmark::State& state) {
+    ComplexClass obj = make_throughput_sample(static_cast<std::size_t>(state.range(0)));
+    auto view = RTypeHandle::get<ComplexClass>().bind_raw(&obj).container("scores");
+    for (auto _ : state) {
+        long sum = 0;
+        for (int v : view.as_span<int>()) {
+            sum += v;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RTTM_Throughput_ContainerSpan)->Arg(1000)->Arg(100000);
+
+// ============================================================================
+// 5. Frozen Registry (must stay last: freeze() affects every later lookup)
+// ============================================================================
+
+static void RTTM_Frozen_TypeLookup(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto& names = SyntheticRegistry::instance().ensure(10000);
+    auto& manager = detail::TypeManager::instance();
+    if (state.thread_index() == 0) {
+        manager.freeze();
+    }
+    const auto order = lookup_order(count, 4096);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.get_type(names[order[i++ & 4095]]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RTTM_Frozen_TypeLookup)->Arg(1000)->Arg(10000)->ThreadRange(1, max_bench_threads())->UseRealTime();
+
+BENCHMARK_MAIN();
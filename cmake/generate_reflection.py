@@ -10,13 +10,20 @@ import clang.cindex
 from clang.cindex import CursorKind, TypeKind, StorageClass
 import json
 import tempfile
+import hashlib
 from collections import defaultdict
+from concurrent.futures import ProcessPoolExecutor
+
+# 解析结果缓存格式版本；生成逻辑变化时同时以脚本内容哈希失效
+CACHE_FORMAT_VERSION = 1
 
 
 class ReflectionGenerator:
-    def __init__(self, output_file, compile_options_file=None, include_paths=None):
+    def __init__(self, output_file, compile_options_file=None, include_paths=None, static_records=False):
         """初始化反射代码生成器"""
         self.output_file = output_file
+        # 静态记录模式：输出 constexpr StaticTypeRecord 表而非 Registry 链
+        self.static_records = static_records
         self.compile_options_file = compile_options_file
         self.include_paths = include_paths or []
         self.index = clang.cindex.Index.create()
@@ -24,6 +31,9 @@ class ReflectionGenerator:
         # 按命名空间组织的注册代码
         self.namespace_registrations = defaultdict(list)
 
+        # 静态记录模式下收集的类型元数据（按生成顺序）
+        self.static_type_records = []
+
         # 记录已处理的源文件
         self.processed_files = set()
 
@@ -45,6 +55,12 @@ class ReflectionGenerator:
         # 跟踪当前的访问修饰符状态
         self.current_access_state = {}
 
+        # 同一批生成的全部头文件：独立解析时，其他头文件中的类型不视为外部类型
+        self.project_headers = set()
+
+        # 最近一次解析涉及的文件（头文件本身及其包含的文件），用于缓存校验
+        self.last_dependencies = []
+
     def load_compile_options(self):
         """从编译选项文件加载选项"""
         # 基础选项
@@ -169,6 +185,13 @@ class ReflectionGenerator:
             # 记录处理的文件
             self.processed_files.add(os.path.normpath(header_file))
 
+            # 记录依赖文件：任何一个内容变化都会使缓存失效
+            dependencies = {os.path.normpath(header_file)}
+            for inclusion in tu.get_includes():
+                if inclusion.include and inclusion.include.name:
+                    dependencies.add(os.path.normpath(str(inclusion.include.name)))
+            self.last_dependencies = sorted(dependencies)
+
             # 清空类型信息和访问状态
             self.type_infos = {}
             self.current_access_state = {}
@@ -377,8 +400,9 @@ class ReflectionGenerator:
             if child.location.file:
                 file_path = os.path.normpath(str(child.location.file.name))
                 if file_path not in self.processed_files:
-                    # 记录外部类型
-                    if child.kind in [CursorKind.CLASS_DECL, CursorKind.STRUCT_DECL, CursorKind.ENUM_DECL]:
+                    # 记录外部类型（同批次的其他头文件由各自的解析负责注册）
+                    if child.kind in [CursorKind.CLASS_DECL, CursorKind.STRUCT_DECL, CursorKind.ENUM_DECL] \
+                            and file_path not in self.project_headers:
                         self.external_types.add(child.spelling)
                     # 不再往下处理外部文件
                     continue
@@ -696,6 +720,23 @@ class ReflectionGenerator:
         registration += "    ;"
         self.namespace_registrations[namespace].append(registration)
 
+        # 静态记录：成员、方法和带参构造函数表
+        static_methods = []
+        for method_info in methods:
+            corrected_return_type = correct_type_name(method_info['return_type_orig'])
+            corrected_param_types = [correct_type_name(pt) for pt in method_info['param_types_orig']]
+            const_suffix = " const" if method_info['is_const'] else ""
+            pointer_type = f"{corrected_return_type} ({fully_qualified_name}::*)({', '.join(corrected_param_types)}){const_suffix}"
+            static_methods.append((method_info['name'],
+                                   f"static_cast<{pointer_type}>(&{fully_qualified_name}::{method_info['name']})"))
+        self.static_type_records.append({
+            'qualified_name': fully_qualified_name,
+            'properties': list(properties),
+            'methods': static_methods,
+            'constructors': [[correct_type_name(pt) for pt in params]
+                             for params in constructors if params],
+        })
+
     def process_enum(self, cursor):
         """处理枚举类型"""
         enum_name = cursor.spelling
@@ -763,6 +804,129 @@ class ReflectionGenerator:
             registration += "    ;"
             self.namespace_registrations[namespace].append(registration)
 
+    def collect_result(self, header_file, success):
+        """把单个头文件的解析结果导出为可序列化的字典（缓存和进程池共用）"""
+        return {
+            'header': os.path.normpath(header_file),
+            'success': success,
+            'namespace_registrations': {ns: list(codes) for ns, codes in self.namespace_registrations.items()},
+            'static_type_records': self.static_type_records,
+            'external_types': sorted(self.external_types),
+            'resolved_types': sorted(self.resolved_types),
+            'skipped_types': list(self.skipped_types),
+            'registered_types': sorted(self.registered_types),
+            'dependencies': self.last_dependencies,
+        }
+
+    def apply_result(self, result):
+        """合并一个头文件的解析结果（按头文件顺序调用，跳过已注册的类型）"""
+        self.processed_files.add(result['header'])
+        duplicated = set(result['registered_types']) & self.registered_types
+        if duplicated:
+            print(f"警告: {result['header']} 中的类型已在其他头文件中注册，跳过: {', '.join(sorted(duplicated))}",
+                  file=sys.stderr)
+            return
+        for namespace, codes in result['namespace_registrations'].items():
+            self.namespace_registrations[namespace].extend(codes)
+        self.static_type_records.extend(result['static_type_records'])
+        self.external_types.update(result['external_types'])
+        self.resolved_types.update(result['resolved_types'])
+        self.skipped_types.extend(result['skipped_types'])
+        self.registered_types.update(result['registered_types'])
+
+    def process_headers(self, headers, jobs=1, cache=None):
+        """
+        处理多个头文件：先查缓存，未命中的头文件各自独立解析（jobs > 1 时使用进程池），
+        结果按输入顺序合并，因此输出与串行处理一致
+        """
+        results = [None] * len(headers)
+        misses = []
+        for i, header in enumerate(headers):
+            cached = cache.load(header) if cache else None
+            if cached is not None:
+                print(f"缓存命中: {header}")
+                results[i] = cached
+            else:
+                misses.append(i)
+
+        project_headers = {os.path.normpath(h) for h in headers} | self.project_headers
+        args = [(self.output_file, self.compile_options_file, self.include_paths,
+                 self.static_records, project_headers, headers[i]) for i in misses]
+        if jobs > 1 and len(misses) > 1:
+            with ProcessPoolExecutor(max_workers=min(jobs, len(misses))) as pool:
+                parsed = list(pool.map(parse_header_isolated, args))
+        else:
+            parsed = [parse_header_isolated(a) for a in args]
+
+        for i, result in zip(misses, parsed):
+            results[i] = result
+            if cache and result['success']:
+                cache.store(headers[i], result)
+
+        success = True
+        for result in results:
+            if not result['success']:
+                success = False
+                print(f"警告: 处理 {result['header']} 时出现错误", file=sys.stderr)
+            self.apply_result(result)
+        return success
+
+    @staticmethod
+    def static_identifier(qualified_name):
+        """把限定名转换为合法的C++标识符"""
+        return re.sub(r'\W', '_', qualified_name)
+
+    def generate_static_records(self, f):
+        """写入 constexpr 静态类型记录（只读元数据，首次查找时才构建 TypeInfo）"""
+        f.write("// 自动生成的静态反射记录，请勿修改\n")
+        f.write("// 名称、成员和方法表均为只读常量数据；启动时只登记表，TypeInfo 在首次查找时构建\n")
+        f.write("// 注意：私有成员、保护成员、静态成员变量和静态方法已被排除；枚举在此模式下不生成\n\n")
+
+        if not self.static_type_records:
+            f.write("// 未找到需要反射的类型\n")
+            return
+
+        f.write("namespace {\n\n")
+        entries = []
+        for record in self.static_type_records:
+            fqn = record['qualified_name']
+            ident = self.static_identifier(fqn)
+            f.write(f"// {fqn}\n")
+
+            members_ref = "{}"
+            if record['properties']:
+                members_ref = f"rttm_members_{ident}"
+                f.write(f"constexpr rttm::detail::StaticMemberRecord {members_ref}[] = {{\n")
+                for prop in record['properties']:
+                    f.write(f"    RTTM_STATIC_MEMBER(\"{prop}\", &{fqn}::{prop}),\n")
+                f.write("};\n")
+
+            methods_ref = "{}"
+            if record['methods']:
+                methods_ref = f"rttm_methods_{ident}"
+                f.write(f"constexpr rttm::detail::StaticMethodRecord {methods_ref}[] = {{\n")
+                for name, pointer in record['methods']:
+                    f.write(f"    RTTM_STATIC_METHOD(\"{name}\", {pointer}),\n")
+                f.write("};\n")
+
+            constructors_ref = "{}"
+            if record['constructors']:
+                constructors_ref = f"rttm_constructors_{ident}"
+                f.write(f"constexpr rttm::detail::ConstructorDescriber {constructors_ref}[] = {{\n")
+                for params in record['constructors']:
+                    f.write(f"    RTTM_STATIC_CONSTRUCTOR({fqn}, {', '.join(params)}),\n")
+                f.write("};\n")
+            f.write("\n")
+
+            entries.append(f"    rttm::detail::static_type_record<{fqn}>({members_ref}, {methods_ref}, {constructors_ref}),\n")
+
+        f.write("constexpr rttm::detail::StaticTypeRecord rttm_static_types[] = {\n")
+        for entry in entries:
+            f.write(entry)
+        f.write("};\n\n")
+        f.write("} // namespace\n\n")
+        f.write("RTTM_STATIC_REGISTRATION(rttm_static_types)\n")
+
     def generate(self):
         """生成反射代码文件"""
         try:
@@ -775,6 +939,11 @@ class ReflectionGenerator:
                     f.write(f"#include \"{header}\"\n")
                 f.write("\n")
 
+                if self.static_records:
+                    self.generate_static_records(f)
+                    print(f"成功生成静态反射记录: {self.output_file}")
+                    return True
+
                 f.write("// 自动生成的反射注册代码，请勿修改\n")
                 f.write("// 此代码仅包含头文件中直接定义的类型，不包含外部库引用\n")
                 f.write("// 注意：私有成员、保护成员、静态成员变量和静态方法已被排除\n")
@@ -834,6 +1003,82 @@ class ReflectionGenerator:
             return False
 
 
+def parse_header_isolated(args):
+    """在独立的生成器中解析单个头文件（可在进程池中运行）"""
+    output_file, compile_options_file, include_paths, static_records, project_headers, header = args
+    generator = ReflectionGenerator(output_file, compile_options_file, include_paths, static_records)
+    generator.project_headers = project_headers
+    success = generator.process_header(header)
+    return generator.collect_result(header, success)
+
+
+def file_digest(path):
+    """文件内容的 SHA-256，文件不存在时返回 None"""
+    try:
+        with open(path, 'rb') as f:
+            return hashlib.sha256(f.read()).hexdigest()
+    except OSError:
+        return None
+
+
+class ParseCache:
+    """
+    按内容哈希缓存单个头文件的解析结果
+
+    键由头文件路径、同批次头文件集合、编译选项、生成模式和生成器脚本内容决定；条目中记录解析时
+    所有依赖文件（含被包含的头文件）的哈希，任一依赖内容变化即视为未命中
+    """
+
+    def __init__(self, cache_dir, compile_options_file, include_paths, static_records, project_headers):
+        self.cache_dir = cache_dir
+        os.makedirs(cache_dir, exist_ok=True)
+        options = ''
+        if compile_options_file and os.path.exists(compile_options_file):
+            with open(compile_options_file, 'r') as f:
+                options = f.read()
+        self.salt = json.dumps({
+            'version': CACHE_FORMAT_VERSION,
+            'generator': file_digest(os.path.abspath(__file__)),
+            'options': options,
+            'include_paths': include_paths,
+            'static_records': static_records,
+            'project_headers': sorted(project_headers),
+        }, sort_keys=True)
+
+    def entry_path(self, header):
+        key = hashlib.sha256((self.salt + '\0' + os.path.normpath(header)).encode('utf-8')).hexdigest()
+        return os.path.join(self.cache_dir, f"{key}.json")
+
+    def load(self, header):
+        try:
+            with open(self.entry_path(header), 'r', encoding='utf-8') as f:
+                entry = json.load(f)
+        except (OSError, ValueError):
+            return None
+        for path, digest in entry.get('dependencies', {}).items():
+            if file_digest(path) != digest:
+                return None
+        return entry.get('result')
+
+    def store(self, header, result):
+        entry = {
+            'dependencies': {path: file_digest(path) for path in result['dependencies']},
+            'result': result,
+        }
+        # 先写临时文件再替换，避免并行构建读到半个条目
+        fd, tmp_path = tempfile.mkstemp(dir=self.cache_dir, suffix='.tmp')
+        try:
+            with os.fdopen(fd, 'w', encoding='utf-8') as f:
+                json.dump(entry, f)
+            os.replace(tmp_path, self.entry_path(header))
+        except OSError as e:
+            print(f"写入解析缓存失败: {e}", file=sys.stderr)
+            try:
+                os.unlink(tmp_path)
+            except OSError:
+                pass
+
+
 def parse_args():
     """解析命令行参数"""
     parser = argparse.ArgumentParser(description='生成C++类的反射代码')
@@ -846,6 +1091,13 @@ def parse_args():
     parser.add_argument('--output', dest='output_file', required=True, help='输出文件路径')
     parser.add_argument('--options', dest='compile_options_file', help='编译选项文件路径')
     parser.add_argument('--include-paths', dest='include_paths', help='包含路径，以逗号分隔')
+    parser.add_argument('--static-records', dest='static_records', action='store_true',
+                        help='生成 constexpr 静态类型记录（启动时不构建 TypeInfo）')
+    parser.add_argument('--cache-dir', dest='cache_dir', help='解析结果缓存目录（按内容哈希复用）')
+    parser.add_argument('--project-headers-list', dest='project_headers_list',
+                        help='同批次全部头文件的列表文件（按分片生成时使用）')
+    parser.add_argument('--jobs', dest='jobs', type=int, default=1,
+                        help='并行解析的进程数，0 表示使用全部 CPU')
 
     # 兼容旧的位置参数格式
     parser.add_argument('old_output_file', nargs='?', help='旧格式的输出文件参数')
@@ -870,7 +1122,8 @@ def main():
     generator = ReflectionGenerator(
         args.output_file,
         args.compile_options_file or args.old_compile_options_file,
-        include_paths
+        include_paths,
+        args.static_records
     )
 
     # 处理头文件
@@ -886,11 +1139,21 @@ def main():
 
         print(f"从 {args.headers_list} 读取了 {len(headers)} 个头文件")
 
-        success = True
-        for header in headers:
-            if not generator.process_header(header):
-                success = False
-                print(f"警告: 处理 {header} 时出现错误", file=sys.stderr)
+        if args.project_headers_list:
+            try:
+                with open(args.project_headers_list, 'r') as f:
+                    generator.project_headers = {os.path.normpath(line.strip()) for line in f if line.strip()}
+            except Exception as e:
+                print(f"读取头文件列表失败: {e}", file=sys.stderr)
+                return 2
+
+        cache = None
+        if args.cache_dir:
+            project_headers = generator.project_headers | {os.path.normpath(h) for h in headers}
+            cache = ParseCache(args.cache_dir, generator.compile_options_file, include_paths,
+                               args.static_records, project_headers)
+        jobs = args.jobs if args.jobs > 0 else (os.cpu_count() or 1)
+        success = generator.process_headers(headers, jobs, cache)
     else:
         # 处理单个头文件
         success = generator.process_header(args.input_file)
@@ -1,8 +1,13 @@
 # 反射代码生成CMake模块
 # 使用方法: include(${CMAKE_CURRENT_LIST_DIR}/reflection.cmake)
-#           generate_reflection(TARGET <目标名> HEADERS <头文件列表>)
+#           generate_reflection(TARGET <目标名> HEADERS <头文件列表> [STATIC_RECORDS] [SHARD_SIZE <n>])
+#           STATIC_RECORDS: 生成 constexpr 静态类型记录，TypeInfo 在首次查找时才构建
+#           SHARD_SIZE: 每个生成文件包含的头文件数；修改一个头文件只重新生成其所在分片（0 表示合并为一个文件）
 
 set(RTTM_SYSTEM_PATHS "" CACHE STRING "系统库路径列表，用于反射生成时排除")
+option(RTTM_STATIC_RECORDS "所有反射生成默认使用静态类型记录" OFF)
+set(RTTM_REFLECTION_SHARD_SIZE 1 CACHE STRING "每个反射生成文件包含的头文件数（0 表示合并为一个文件）")
+set(RTTM_REFLECTION_JOBS 0 CACHE STRING "反射生成时并行解析的进程数（0 表示使用全部 CPU）")
 
 get_filename_component(REFLECTION_CMAKE_DIR "${CMAKE_CURRENT_LIST_FILE}" ABSOLUTE)
 get_filename_component(REFLECTION_CMAKE_DIR "${REFLECTION_CMAKE_DIR}" DIRECTORY)
@@ -84,17 +89,25 @@ function(get_target_include_dirs TARGET OUTPUT_VAR)
     set(${OUTPUT_VAR} "${INCLUDE_DIRS}" PARENT_SCOPE)
 endfunction()
 
+# 仅在内容变化时更新文件，避免重新配置后所有反射生成命令都被触发
+function(write_file_if_different OUTPUT_FILE CONTENT)
+    file(WRITE "${OUTPUT_FILE}.tmp" "${CONTENT}")
+    configure_file("${OUTPUT_FILE}.tmp" "${OUTPUT_FILE}" COPYONLY)
+    file(REMOVE "${OUTPUT_FILE}.tmp")
+endfunction()
+
 # 生成头文件列表文件
 function(generate_headers_list_file OUTPUT_FILE HEADERS)
-    file(WRITE "${OUTPUT_FILE}" "")
+    set(CONTENT "")
     foreach(HEADER ${HEADERS})
         get_filename_component(HEADER_ABS "${HEADER}" ABSOLUTE)
-        file(APPEND "${OUTPUT_FILE}" "${HEADER_ABS}\n")
+        string(APPEND CONTENT "${HEADER_ABS}\n")
     endforeach()
+    write_file_if_different("${OUTPUT_FILE}" "${CONTENT}")
 endfunction()
 
 function(generate_reflection)
-    cmake_parse_arguments(REFL "" "TARGET" "HEADERS;EXCLUDE_PATHS" ${ARGN})
+    cmake_parse_arguments(REFL "STATIC_RECORDS" "TARGET;SHARD_SIZE" "HEADERS;EXCLUDE_PATHS" ${ARGN})
 
     if(NOT DEFINED REFL_TARGET)
         message(FATAL_ERROR "必须指定目标: generate_reflection(TARGET <目标名> ...)")
@@ -121,7 +134,7 @@ function(generate_reflection)
     get_target_include_dirs(${REFL_TARGET} TARGET_ALL_INCLUDE_DIRS)
 
     # 将包含目录写入编译选项文件
-    file(WRITE ${COMPILE_OPTIONS_FILE} "{\n  \"options\": [\n")
+    set(COMPILE_OPTIONS_CONTENT "{\n  \"options\": [\n")
     set(FIRST_ENTRY TRUE)
     foreach(INCLUDE_DIR ${TARGET_ALL_INCLUDE_DIRS})
         # 跳过生成器表达式
@@ -129,12 +142,13 @@ function(generate_reflection)
             if(FIRST_ENTRY)
                 set(FIRST_ENTRY FALSE)
             else()
-                file(APPEND ${COMPILE_OPTIONS_FILE} ",\n")
+                string(APPEND COMPILE_OPTIONS_CONTENT ",\n")
             endif()
-            file(APPEND ${COMPILE_OPTIONS_FILE} "    \"-I${INCLUDE_DIR}\"")
+            string(APPEND COMPILE_OPTIONS_CONTENT "    \"-I${INCLUDE_DIR}\"")
         endif()
     endforeach()
-    file(APPEND ${COMPILE_OPTIONS_FILE} "\n  ]\n}\n")
+    string(APPEND COMPILE_OPTIONS_CONTENT "\n  ]\n}\n")
+    write_file_if_different("${COMPILE_OPTIONS_FILE}" "${COMPILE_OPTIONS_CONTENT}")
 
     # 将所有包含目录转换为逗号分隔的字符串
     string(REPLACE ";" "," INCLUDE_PATHS_STR "${TARGET_ALL_INCLUDE_DIRS}")
@@ -163,35 +177,68 @@ function(generate_reflection)
     # 更新已处理头文件列表
     set_property(GLOBAL APPEND PROPERTY RTTM_PROCESSED_HEADERS ${UNPROCESSED_HEADERS})
 
-    # 生成单一反射文件
-    set(REFLECTION_FILE "${REFLECTION_OUTPUT_DIR}/${REFL_TARGET}_reflection.cpp")
-
-    # 生成头文件列表文件
+    # 生成头文件列表文件（全部头文件，分片解析时用于区分外部类型）
     set(HEADERS_LIST_FILE "${REFLECTION_OUTPUT_DIR}/${REFL_TARGET}_headers.txt")
     generate_headers_list_file(${HEADERS_LIST_FILE} "${UNPROCESSED_HEADERS}")
 
-    # 创建自定义命令，一次性处理所有头文件
-    add_custom_command(
-            OUTPUT "${REFLECTION_FILE}"
-            COMMAND ${Python3_EXECUTABLE} "${GENERATOR_SCRIPT}"
-            "--headers-list=${HEADERS_LIST_FILE}"
-            "--output=${REFLECTION_FILE}"
-            "--options=${COMPILE_OPTIONS_FILE}"
-            "--include-paths=${INCLUDE_PATHS_STR}"
-            DEPENDS "${HEADERS_LIST_FILE}" "${GENERATOR_SCRIPT}" "${COMPILE_OPTIONS_FILE}" ${UNPROCESSED_HEADERS}
-            COMMENT "为目标 ${REFL_TARGET} 生成合并的反射代码"
-            VERBATIM
-    )
-    message("命令:" ${Python3_EXECUTABLE} " ${GENERATOR_SCRIPT}"
-            " --headers-list=${HEADERS_LIST_FILE}"
-            " --output=${REFLECTION_FILE}"
-            " --options=${COMPILE_OPTIONS_FILE}"
-            " --include-paths=${INCLUDE_PATHS_STR}")
+    # 静态记录模式：元数据为只读表，启动时不构建 TypeInfo
+    set(GENERATOR_MODE_ARGS "")
+    if(REFL_STATIC_RECORDS OR RTTM_STATIC_RECORDS)
+        list(APPEND GENERATOR_MODE_ARGS "--static-records")
+    endif()
+
+    # 解析结果按内容哈希缓存，未变化的头文件不再调用 libclang
+    list(APPEND GENERATOR_MODE_ARGS
+            "--cache-dir=${REFLECTION_OUTPUT_DIR}/cache"
+            "--jobs=${RTTM_REFLECTION_JOBS}")
+
+    if(NOT DEFINED REFL_SHARD_SIZE)
+        set(REFL_SHARD_SIZE ${RTTM_REFLECTION_SHARD_SIZE})
+    endif()
+    list(LENGTH UNPROCESSED_HEADERS HEADER_COUNT)
+    if(REFL_SHARD_SIZE LESS_EQUAL 0 OR REFL_SHARD_SIZE GREATER_EQUAL HEADER_COUNT)
+        set(REFL_SHARD_SIZE ${HEADER_COUNT})
+    endif()
+
+    # 按分片生成：每个分片只依赖自己的头文件，修改一个头文件只重新生成并编译一个文件
+    set(REFLECTION_FILES "")
+    set(SHARD_INDEX 0)
+    set(HEADER_BEGIN 0)
+    while(HEADER_BEGIN LESS HEADER_COUNT)
+        list(SUBLIST UNPROCESSED_HEADERS ${HEADER_BEGIN} ${REFL_SHARD_SIZE} SHARD_HEADERS)
+
+        if(REFL_SHARD_SIZE EQUAL HEADER_COUNT)
+            set(REFLECTION_FILE "${REFLECTION_OUTPUT_DIR}/${REFL_TARGET}_reflection.cpp")
+            set(SHARD_LIST_FILE "${HEADERS_LIST_FILE}")
+        else()
+            set(REFLECTION_FILE "${REFLECTION_OUTPUT_DIR}/${REFL_TARGET}_reflection_${SHARD_INDEX}.cpp")
+            set(SHARD_LIST_FILE "${REFLECTION_OUTPUT_DIR}/${REFL_TARGET}_headers_${SHARD_INDEX}.txt")
+            generate_headers_list_file(${SHARD_LIST_FILE} "${SHARD_HEADERS}")
+        endif()
+
+        add_custom_command(
+                OUTPUT "${REFLECTION_FILE}"
+                COMMAND ${Python3_EXECUTABLE} "${GENERATOR_SCRIPT}"
+                "--headers-list=${SHARD_LIST_FILE}"
+                "--project-headers-list=${HEADERS_LIST_FILE}"
+                "--output=${REFLECTION_FILE}"
+                "--options=${COMPILE_OPTIONS_FILE}"
+                "--include-paths=${INCLUDE_PATHS_STR}"
+                ${GENERATOR_MODE_ARGS}
+                DEPENDS "${SHARD_LIST_FILE}" "${GENERATOR_SCRIPT}" "${COMPILE_OPTIONS_FILE}" ${SHARD_HEADERS}
+                COMMENT "为目标 ${REFL_TARGET} 生成反射代码 (分片 ${SHARD_INDEX})"
+                VERBATIM
+        )
+        list(APPEND REFLECTION_FILES "${REFLECTION_FILE}")
+
+        math(EXPR SHARD_INDEX "${SHARD_INDEX} + 1")
+        math(EXPR HEADER_BEGIN "${HEADER_BEGIN} + ${REFL_SHARD_SIZE}")
+    endwhile()
 
     # 将生成的反射代码文件直接添加到原始目标中
-    target_sources(${REFL_TARGET} PRIVATE ${REFLECTION_FILE})
+    target_sources(${REFL_TARGET} PRIVATE ${REFLECTION_FILES})
 
-    message(STATUS "成功添加反射代码到目标 ${REFL_TARGET} (包含 ${UNPROCESSED_HEADERS} 个头文件)")
+    message(STATUS "成功添加反射代码到目标 ${REFL_TARGET} (包含 ${HEADER_COUNT} 个头文件, ${SHARD_INDEX} 个分片)")
 endfunction()
 
 function(rttm_add_reflection TARGET)
@@ -28,6 +28,7 @@
 
 // Core type traits and concepts
 #include "detail/TypeTraits.hpp"
+#include "detail/Name.hpp"
 
 // Type information and management
 #include "detail/TypeInfo.hpp"
@@ -47,12 +48,40 @@
 #include "detail/RTypeHandle.hpp"
 
 // Container reflection support
+#include "detail/ContainerView.hpp"
 #include "detail/Container.hpp"
 #include "detail/ContainerImpl.hpp"
 
 // Pure dynamic reflection (RTTR-like)
 #include "detail/Variant.hpp"
 #include "detail/Instance.hpp"
+#include "detail/ReflectedArray.hpp"
+#include "detail/ReflectedColumns.hpp"
+
+// Overloads bound to a fixed argument layout
+#include "detail/CallSite.hpp"
+
+// Awaitable invocation of methods returning futures/tasks
+#include "detail/Async.hpp"
+
+// Deferred registration
+#include "detail/LazyRegistration.hpp"
+
+// Plugin modules that load and unload their types
+#include "detail/ModuleRegistration.hpp"
+
+// Binary and JSON serialization
+#include "detail/Serializer.hpp"
+#include "detail/JsonSerializer.hpp"
+
+// Snapshots, diffs and patches for state replication
+#include "detail/Diff.hpp"
+
+// Field layout and cache-line analysis
+#include "detail/Layout.hpp"
+
+// Slow-path instrumentation (RTTM_ENABLE_PROFILING)
+#include "detail/Profiling.hpp"
 
 /**
  * @brief Macro for registering types with RTTM
@@ -75,4 +104,75 @@
     } \
     static void rttm_register_types_()
 
+#define RTTM_DETAIL_CONCAT_IMPL(a, b) a##b
+#define RTTM_DETAIL_CONCAT(a, b) RTTM_DETAIL_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Register one type on its first lookup instead of at static init
+ * 
+ * The block must register T (and may register helpers it owns). See
+ * rttm::warm_up() to run all pending blocks ahead of time.
+ * 
+ * Usage:
+ * @code
+ * RTTM_LAZY_REGISTRATION(MyClass) {
+ *     rttm::Registry<MyClass>()
+ *         .property("name", &MyClass::name);
+ * }
+ * @endcode
+ */
+#define RTTM_LAZY_REGISTRATION(...) \
+    RTTM_DETAIL_LAZY_REGISTRATION(__COUNTER__, __VA_ARGS__)
+
+#define RTTM_DETAIL_LAZY_REGISTRATION(id, ...) \
+    static void RTTM_DETAIL_CONCAT(rttm_lazy_register_, id)(); \
+    namespace { \
+        [[maybe_unused]] const bool RTTM_DETAIL_CONCAT(rttm_lazy_registered_, id) = \
+            ::rttm::detail::register_lazy<__VA_ARGS__>(&RTTM_DETAIL_CONCAT(rttm_lazy_register_, id)); \
+    } \
+    static void RTTM_DETAIL_CONCAT(rttm_lazy_register_, id)()
+
+/**
+ * @brief Register a shared object's types as one module
+ * 
+ * The types are published together when the module is loaded and
+ * unregistered when it is unloaded (see ModuleRegistration.hpp).
+ * 
+ * Usage:
+ * @code
+ * RTTM_MODULE_REGISTRATION {
+ *     rttm::Registry<Enemy>()
+ *         .property("hp", &Enemy::hp);
+ * }
+ * @endcode
+ */
+#define RTTM_MODULE_REGISTRATION \
+    static void rttm_register_module_(); \
+    namespace { \
+        const ::rttm::ModuleRegistration rttm_module_registration_{&rttm_register_module_}; \
+    } \
+    static void rttm_register_module_()
+
+/**
+ * @brief Publish a constexpr table of StaticTypeRecord at static initialization
+ * 
+ * Only the table is remembered; each type's TypeInfo is built on its first lookup.
+ * 
+ * Usage:
+ * @code
+ * constexpr rttm::detail::StaticMemberRecord player_members[] = {
+ *     RTTM_STATIC_MEMBER("hp", &Player::hp),
+ * };
+ * constexpr rttm::detail::StaticTypeRecord types[] = {
+ *     rttm::detail::static_type_record<Player>(player_members),
+ * };
+ * RTTM_STATIC_REGISTRATION(types)
+ * @endcode
+ */
+#define RTTM_STATIC_REGISTRATION(records) \
+    namespace { \
+        [[maybe_unused]] const bool rttm_static_registered_ = \
+            ::rttm::detail::TypeManager::instance().register_static(records); \
+    }
+
 #endif // RTTM_RTTM_HPP
@@ -0,0 +1,373 @@
+/**
+ * @file Async.hpp
+ * @brief Awaitable results for reflected methods returning futures or tasks
+ *
+ * Registry<T>::method() detects return types that can be co_awaited
+ * (anything with await_ready/await_suspend/await_resume or an operator
+ * co_await) as well as std::future and std::shared_future, and registers
+ * an async invoker next to the synchronous ones. Instance::invoke_async()
+ * and DynamicMethod::invoke_async() start such a method and hand back an
+ * AsyncResult that a coroutine can co_await without blocking its thread:
+ * @code
+ * Task<void> handle(rttm::Instance& service, Request req) {
+ *     rttm::Variant reply = co_await service.invoke_async(req.method, req.args);
+ *     co_await send(reply);
+ * }
+ * @endcode
+ *
+ * The awaiting coroutine resumes on the thread that completes the method.
+ * std::future has no completion callback; pending futures are polled by a
+ * single background thread shared by all in-flight calls. The reflected
+ * object must outlive the call; converted arguments are owned by the call.
+ */
+
+#ifndef RTTM_DETAIL_ASYNC_HPP
+#define RTTM_DETAIL_ASYNC_HPP
+
+#include "Variant.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace rttm {
+
+namespace detail {
+
+template<typename T>
+struct is_future : std::false_type {};
+
+template<typename T>
+struct is_future<std::future<T>> : std::true_type {};
+
+template<typename T>
+struct is_future<std::shared_future<T>> : std::true_type {};
+
+/**
+ * @brief Type with the three awaiter member functions
+ */
+template<typename T>
+concept Awaiter = requires(T& a, std::coroutine_handle<> h) {
+    { a.await_ready() } -> std::convertible_to<bool>;
+    a.await_suspend(h);
+    a.await_resume();
+};
+
+/**
+ * @brief Type usable as the operand of co_await in a coroutine without await_transform
+ */
+template<typename T>
+concept Awaitable = Awaiter<T>
+    || requires(T&& a) { { std::forward<T>(a).operator co_await() } -> Awaiter; }
+    || requires(T&& a) { { operator co_await(std::forward<T>(a)) } -> Awaiter; };
+
+/**
+ * @brief Return type registered with an async invoker
+ */
+template<typename R>
+concept AsyncReturn = is_future<std::remove_cvref_t<R>>::value || Awaitable<std::remove_cvref_t<R>>;
+
+/**
+ * @brief Wait for std::future / std::shared_future without blocking the awaiting thread
+ */
+void watch_future(std::function<bool()> ready, std::coroutine_handle<> continuation);
+
+template<typename Future>
+class FutureAwaiter {
+public:
+    explicit FutureAwaiter(Future future) noexcept : future_(std::move(future)) {}
+
+    [[nodiscard]] bool await_ready() const {
+        // Deferred futures never become ready on their own; get() runs them inline
+        return future_.wait_for(std::chrono::seconds(0)) != std::future_status::timeout;
+    }
+
+    void await_suspend(std::coroutine_handle<> continuation) {
+        watch_future([this] { return await_ready(); }, continuation);
+    }
+
+    decltype(auto) await_resume() { return future_.get(); }
+
+private:
+    Future future_;
+};
+
+template<typename T>
+FutureAwaiter<std::future<T>> as_awaitable(std::future<T>&& future) noexcept {
+    return FutureAwaiter<std::future<T>>{std::move(future)};
+}
+
+template<typename T>
+FutureAwaiter<std::shared_future<T>> as_awaitable(std::shared_future<T> future) noexcept {
+    return FutureAwaiter<std::shared_future<T>>{std::move(future)};
+}
+
+template<typename A>
+requires (!is_future<std::remove_cvref_t<A>>::value)
+A&& as_awaitable(A&& awaitable) noexcept {
+    return std::forward<A>(awaitable);
+}
+
+template<typename A>
+decltype(auto) get_awaiter(A&& awaitable) {
+    if constexpr (requires { std::forward<A>(awaitable).operator co_await(); }) {
+        return std::forward<A>(awaitable).operator co_await();
+    } else if constexpr (requires { operator co_await(std::forward<A>(awaitable)); }) {
+        return operator co_await(std::forward<A>(awaitable));
+    } else {
+        return std::forward<A>(awaitable);
+    }
+}
+
+/**
+ * @brief Value produced by co_await on an R returned from a reflected method
+ */
+template<typename R>
+using await_result_t = decltype(get_awaiter(as_awaitable(std::declval<R>())).await_resume());
+
+/**
+ * @brief await_result_t without references and cv (what a Variant stores)
+ */
+template<typename R>
+using await_value_t = std::remove_cvref_t<await_result_t<R>>;
+
+/**
+ * @brief Completion shared by a running async call and its AsyncResult
+ *
+ * Completion and suspension race through a single atomic state word: the
+ * side that comes second resumes the continuation (or skips suspending).
+ */
+class AsyncState {
+public:
+    void set_value(Variant value) noexcept {
+        value_ = std::move(value);
+        complete();
+    }
+
+    void set_exception(std::exception_ptr error) noexcept {
+        error_ = std::move(error);
+        complete();
+    }
+
+    [[nodiscard]] bool is_ready() const noexcept {
+        return state_.load(std::memory_order_acquire) == Done;
+    }
+
+    /**
+     * @brief Park continuation until completion; false if already complete
+     */
+    [[nodiscard]] bool try_suspend(std::coroutine_handle<> continuation) noexcept {
+        continuation_ = continuation;
+        int expected = Pending;
+        return state_.compare_exchange_strong(expected, Waiting,
+                                              std::memory_order_acq_rel, std::memory_order_acquire);
+    }
+
+    void wait() const noexcept {
+        int current = state_.load(std::memory_order_acquire);
+        while (current != Done) {
+            state_.wait(current, std::memory_order_acquire);
+            current = state_.load(std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Move the result out (requires is_ready); rethrows a stored exception
+     */
+    Variant take() {
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        return std::move(value_);
+    }
+
+private:
+    enum : int { Pending, Waiting, Done };
+
+    void complete() noexcept {
+        const int previous = state_.exchange(Done, std::memory_order_acq_rel);
+        state_.notify_all();
+        if (previous == Waiting) {
+            continuation_.resume();
+        }
+    }
+
+    std::atomic<int> state_{Pending};
+    std::coroutine_handle<> continuation_;
+    Variant value_;
+    std::exception_ptr error_;
+};
+
+/**
+ * @brief Eagerly started, self-destroying coroutine driving one async call
+ */
+struct AsyncDriver {
+    struct promise_type {
+        template<typename... Rest>
+        explicit promise_type(const std::shared_ptr<AsyncState>& s, const Rest&...) noexcept : state(s) {}
+
+        AsyncDriver get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { state->set_exception(std::current_exception()); }
+
+        std::shared_ptr<AsyncState> state;
+    };
+};
+
+/**
+ * @brief Run call() and publish the awaited value into state
+ *
+ * call is stored in the coroutine frame, so values it captured (the
+ * converted arguments) stay alive until the awaitable completes.
+ */
+template<typename F>
+AsyncDriver drive_async(std::shared_ptr<AsyncState> state, F call) {
+    using R = std::invoke_result_t<F&>;
+    if constexpr (std::is_void_v<await_result_t<R>>) {
+        co_await as_awaitable(call());
+        state->set_value(Variant{});
+    } else {
+        state->set_value(Variant::create(co_await as_awaitable(call())));
+    }
+}
+
+/**
+ * @brief Block the calling thread until awaitable completes
+ *
+ * Backs the synchronous invokers of methods whose awaitable cannot be
+ * copied into a result. Deadlocks if the awaitable needs the calling
+ * thread to make progress.
+ */
+template<typename R>
+await_value_t<R> sync_await(R&& awaitable) {
+    if constexpr (is_future<std::remove_cvref_t<R>>::value) {
+        return awaitable.get();
+    } else {
+        auto state = std::make_shared<AsyncState>();
+        drive_async(state, [&awaitable]() -> R&& { return std::forward<R>(awaitable); });
+        state->wait();
+        Variant value = state->take();
+        if constexpr (!std::is_void_v<await_value_t<R>>) {
+            return std::move(value.get<await_value_t<R>>());
+        }
+    }
+}
+
+/**
+ * @brief Async return type that the synchronous invokers resolve by waiting
+ *
+ * Awaitables that can be copied are returned as-is by invoke(); the rest
+ * (std::future, move-only tasks) would not fit in a Variant or std::any.
+ */
+template<typename R>
+concept SettledByWait = AsyncReturn<R> && !std::is_copy_constructible_v<std::remove_cvref_t<R>>;
+
+template<typename R, bool = SettledByWait<R>>
+struct settled { using type = R; };
+
+template<typename R>
+struct settled<R, true> { using type = await_value_t<R>; };
+
+/**
+ * @brief What the synchronous invokers of a method returning R produce
+ */
+template<typename R>
+using settled_t = typename settled<R>::type;
+
+/**
+ * @brief Call f() and wait for its result if the synchronous paths cannot hold it
+ */
+template<typename F>
+decltype(auto) settled_invoke(F&& f) {
+    if constexpr (SettledByWait<std::invoke_result_t<F&&>>) {
+        return sync_await(std::forward<F>(f)());
+    } else {
+        return std::forward<F>(f)();
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Awaitable outcome of Instance::invoke_async / DynamicMethod::invoke_async
+ *
+ * co_await yields the method's result as a Variant (empty for void) or
+ * rethrows the exception it ended with. Callers outside a coroutine can
+ * use wait() and get() instead.
+ */
+class AsyncResult {
+public:
+    AsyncResult() = default;
+
+    explicit AsyncResult(std::shared_ptr<detail::AsyncState> state) noexcept : state_(std::move(state)) {}
+
+    /**
+     * @brief Already completed result (used for synchronous methods)
+     */
+    [[nodiscard]] static AsyncResult ready(Variant value) {
+        auto state = std::make_shared<detail::AsyncState>();
+        state->set_value(std::move(value));
+        return AsyncResult{std::move(state)};
+    }
+
+    /**
+     * @brief Already failed result
+     */
+    [[nodiscard]] static AsyncResult failed(std::exception_ptr error) {
+        auto state = std::make_shared<detail::AsyncState>();
+        state->set_exception(std::move(error));
+        return AsyncResult{std::move(state)};
+    }
+
+    [[nodiscard]] bool is_valid() const noexcept { return state_ != nullptr; }
+    [[nodiscard]] explicit operator bool() const noexcept { return is_valid(); }
+
+    [[nodiscard]] bool is_ready() const noexcept { return state_ && state_->is_ready(); }
+
+    /**
+     * @brief Block until the call completed
+     */
+    void wait() const noexcept {
+        if (state_) state_->wait();
+    }
+
+    /**
+     * @brief Block until completion and take the result (once)
+     */
+    [[nodiscard]] Variant get() {
+        wait();
+        return take();
+    }
+
+    // Awaiter interface
+    [[nodiscard]] bool await_ready() const noexcept { return !state_ || state_->is_ready(); }
+
+    [[nodiscard]] bool await_suspend(std::coroutine_handle<> continuation) noexcept {
+        return state_->try_suspend(continuation);
+    }
+
+    Variant await_resume() { return take(); }
+
+private:
+    Variant take() {
+        if (!state_) [[unlikely]] {
+            throw ReflectionError("AsyncResult has no associated call");
+        }
+        return state_->take();
+    }
+
+    std::shared_ptr<detail::AsyncState> state_;
+};
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_ASYNC_HPP
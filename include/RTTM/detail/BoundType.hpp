@@ -6,15 +6,19 @@
  * fast property and method access without shared_ptr overhead.
  * 
  * This is the "hot path" API for RTTM - use it when you need maximum
- * performance for property reads/writes and method calls.
+ * performance for property reads/writes and method calls. Nested
+ * traversal (property(), path()) returns further BoundTypes, so walking
+ * an object graph performs no heap allocation.
  */
 
 #ifndef RTTM_DETAIL_BOUND_TYPE_HPP
 #define RTTM_DETAIL_BOUND_TYPE_HPP
 
 #include "TypeInfo.hpp"
+#include "TypeManager.hpp"
 #include "TypeTraits.hpp"
 #include "Exceptions.hpp"
+#include "Name.hpp"
 
 #include <string_view>
 #include <any>
@@ -24,11 +28,6 @@
 
 namespace rttm {
 
-namespace detail {
-    // Use the hash from TypeInfo.hpp
-    using detail::type_info_hash;
-}
-
 /**
  * @brief Lightweight bound type for fast property/method access
  * 
@@ -49,6 +48,9 @@ namespace detail {
  * 
  * // Fast method call
  * int result = bound.call<int>("getValue");
+ * 
+ * // Nested traversal without allocation
+ * float& x = bound.path("transform.position.x").as<float>();
  * @endcode
  */
 class BoundType {
@@ -98,25 +100,16 @@ public:
      */
     template<typename T>
     [[nodiscard]] T& get(std::string_view name) const {
-        // Look up member info (no allocation with transparent hash)
-        const detail::MemberInfo* member = info_->find_member(name);
-        if (!member) [[unlikely]] {
-            if (!is_valid()) {
-                throw ObjectNotCreatedError(info_ ? info_->name : "unknown");
-            }
-            throw PropertyNotFoundError(info_->name, name, info_->member_names());
-        }
-        
-#ifndef NDEBUG
-        // Type check only in debug builds
-        if (member->type_index != std::type_index(typeid(T))) [[unlikely]] {
-            throw PropertyTypeMismatchError(name, member->type_name,
-                                            std::string{detail::type_name<T>()});
-        }
-#endif
-        
+        return get<T>(Name{name});
+    }
+    
+    /**
+     * @brief Get property by pre-hashed name (no hashing on the hot path)
+     */
+    template<typename T>
+    [[nodiscard]] T& get(Name name) const {
         // Direct pointer arithmetic - this is the hot path
-        void* ptr = static_cast<char*>(obj_) + member->offset;
+        void* ptr = static_cast<char*>(obj_) + typed_member<T>(name).offset;
         return *static_cast<T*>(ptr);
     }
     
@@ -125,6 +118,14 @@ public:
      */
     template<typename T>
     [[nodiscard]] const T& cget(std::string_view name) const {
+        return cget<T>(Name{name});
+    }
+    
+    /**
+     * @brief Get property by pre-hashed name (const version)
+     */
+    template<typename T>
+    [[nodiscard]] const T& cget(Name name) const {
         if (!is_valid()) [[unlikely]] {
             throw ObjectNotCreatedError(info_ ? info_->name : "unknown");
         }
@@ -154,7 +155,18 @@ public:
      */
     template<typename T>
     void set(std::string_view name, T&& value) const {
-        get<std::remove_cvref_t<T>>(name) = std::forward<T>(value);
+        set(Name{name}, std::forward<T>(value));
+    }
+    
+    /**
+     * @brief Set property by pre-hashed name
+     */
+    template<typename T>
+    void set(Name name, T&& value) const {
+        using Value = std::remove_cvref_t<T>;
+        const detail::MemberInfo& member = typed_member<Value>(name);
+        *reinterpret_cast<Value*>(static_cast<char*>(obj_) + member.offset) = std::forward<T>(value);
+        detail::mark_dirty(member, obj_);
     }
     
     /**
@@ -180,6 +192,13 @@ public:
      * @return Offset in bytes, or SIZE_MAX if not found
      */
     [[nodiscard]] std::size_t get_property_offset(std::string_view name) const noexcept {
+        return get_property_offset(Name{name});
+    }
+    
+    /**
+     * @brief Get property offset by pre-hashed name
+     */
+    [[nodiscard]] std::size_t get_property_offset(Name name) const noexcept {
         if (!info_) return SIZE_MAX;
         const detail::MemberInfo* member = info_->find_member(name);
         return member ? member->offset : SIZE_MAX;
@@ -194,6 +213,14 @@ public:
      */
     template<typename R>
     [[nodiscard]] R call(std::string_view name) const {
+        return call<R>(Name{name});
+    }
+    
+    /**
+     * @brief Call method by pre-hashed name (no arguments)
+     */
+    template<typename R>
+    [[nodiscard]] R call(Name name) const {
         if (!is_valid()) [[unlikely]] {
             throw ObjectNotCreatedError(info_ ? info_->name : "unknown");
         }
@@ -216,6 +243,10 @@ public:
             throw MethodSignatureMismatchError(name, "()", "no matching overload");
         }
         
+        if (matched->matches_exactly<R>()) [[likely]] {
+            return matched->call_direct<R>(obj_);
+        }
+        
         std::span<std::any> empty_args;
         std::any result = matched->call(obj_, empty_args);
         
@@ -240,6 +271,14 @@ public:
      */
     template<typename R, typename... Args>
     [[nodiscard]] R call(std::string_view name, Args&&... args) const {
+        return call<R>(Name{name}, std::forward<Args>(args)...);
+    }
+    
+    /**
+     * @brief Call method by pre-hashed name with arguments
+     */
+    template<typename R, typename... Args>
+    [[nodiscard]] R call(Name name, Args&&... args) const {
         if (!is_valid()) [[unlikely]] {
             throw ObjectNotCreatedError(info_ ? info_->name : "unknown");
         }
@@ -262,6 +301,11 @@ public:
             throw MethodSignatureMismatchError(name, "expected args", "no matching overload");
         }
         
+        // Exact signature match: typed call, no std::any round-trip
+        if (matched->matches_exactly<R, Args...>()) [[likely]] {
+            return matched->call_direct<R>(obj_, std::forward<Args>(args)...);
+        }
+        
         if constexpr (sizeof...(Args) == 0) {
             std::span<std::any> empty_args;
             std::any result = matched->call(obj_, empty_args);
@@ -293,9 +337,208 @@ public:
      */
     template<typename... Args>
     void call_void(std::string_view name, Args&&... args) const {
+        call<void>(Name{name}, std::forward<Args>(args)...);
+    }
+    
+    /**
+     * @brief Call void method by pre-hashed name
+     */
+    template<typename... Args>
+    void call_void(Name name, Args&&... args) const {
         call<void>(name, std::forward<Args>(args)...);
     }
     
+    // ==================== Nested Traversal ====================
+    
+    /**
+     * @brief Bind to a member object (no allocation)
+     * 
+     * The result points at the member inside this object. If the member
+     * type is not registered, the result has no TypeInfo (is_valid() is
+     * false) but raw() and as<T>() still address the member.
+     * 
+     * @param name Property name
+     * @return BoundType for the member
+     * @throws ObjectNotCreatedError if this BoundType is not bound
+     * @throws PropertyNotFoundError if property doesn't exist
+     */
+    [[nodiscard]] BoundType property(std::string_view name) const {
+        return property(Name{name});
+    }
+    
+    /**
+     * @brief Bind to a member object by pre-hashed name
+     */
+    [[nodiscard]] BoundType property(Name name) const {
+        if (!is_valid()) [[unlikely]] {
+            throw ObjectNotCreatedError(info_ ? info_->name : "unknown");
+        }
+        const detail::MemberInfo* member = info_->find_member(name);
+        if (!member) [[unlikely]] {
+            throw PropertyNotFoundError(info_->name, name, info_->member_names());
+        }
+        return BoundType{member_type_info(*member), static_cast<char*>(obj_) + member->offset};
+    }
+    
+    /**
+     * @brief Follow a dot-separated member path, e.g. "a.b.c"
+     * 
+     * Equivalent to property("a").property("b").property("c").
+     * 
+     * @param dotted_path Member names separated by '.'
+     * @return BoundType for the final member
+     * @throws PropertyNotFoundError if any segment doesn't exist
+     */
+    [[nodiscard]] BoundType path(std::string_view dotted_path) const {
+        BoundType current = *this;
+        while (true) {
+            const auto dot = dotted_path.find('.');
+            current = current.property(dotted_path.substr(0, dot));
+            if (dot == std::string_view::npos) {
+                return current;
+            }
+            dotted_path.remove_prefix(dot + 1);
+        }
+    }
+    
+    // ==================== Queries ====================
+    
+    /**
+     * @brief Check if a property exists
+     */
+    [[nodiscard]] bool has_property(std::string_view name) const {
+        return info_ && info_->has_member(name);
+    }
+    
+    /**
+     * @brief Check if a property exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_property(Name name) const {
+        return info_ && info_->has_member(name);
+    }
+    
+    /**
+     * @brief Check if a method exists
+     */
+    [[nodiscard]] bool has_method(std::string_view name) const {
+        return info_ && info_->has_method(name);
+    }
+    
+    /**
+     * @brief Check if a method exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_method(Name name) const {
+        return info_ && info_->has_method(name);
+    }
+    
+    /**
+     * @brief Get all property names
+     */
+    [[nodiscard]] const std::vector<std::string_view>& property_names() const noexcept {
+        static const std::vector<std::string_view> empty;
+        return info_ ? info_->member_names() : empty;
+    }
+    
+    /**
+     * @brief Get all method names
+     */
+    [[nodiscard]] const std::vector<std::string_view>& method_names() const noexcept {
+        static const std::vector<std::string_view> empty;
+        return info_ ? info_->method_names() : empty;
+    }
+    
+    /**
+     * @brief Get member metadata, or nullptr if not found
+     */
+    [[nodiscard]] const detail::MemberInfo* get_member_info(Name name) const noexcept {
+        return info_ ? info_->find_member(name) : nullptr;
+    }
+    
+    /**
+     * @brief Get property category
+     * @throws PropertyNotFoundError if property doesn't exist
+     */
+    [[nodiscard]] detail::MemberCategory property_category(Name name) const {
+        return require_member(name).category;
+    }
+    
+    /**
+     * @brief Get property type name
+     * @throws PropertyNotFoundError if property doesn't exist
+     */
+    [[nodiscard]] std::string_view property_type_name(Name name) const {
+        return require_member(name).type_name;
+    }
+    
+    /**
+     * @brief Check if a property is a sequential container
+     */
+    [[nodiscard]] bool is_sequential_container(Name name) const noexcept {
+        const auto* member = get_member_info(name);
+        return member && member->category == detail::MemberCategory::Sequential;
+    }
+    
+    /**
+     * @brief Check if a property is an associative container
+     */
+    [[nodiscard]] bool is_associative_container(Name name) const noexcept {
+        const auto* member = get_member_info(name);
+        return member && member->category == detail::MemberCategory::Associative;
+    }
+    
+    /**
+     * @brief Allocation-free view of a container property
+     * 
+     * @throws PropertyNotFoundError if the property doesn't exist
+     * @throws PropertyTypeMismatchError if the property is not a container
+     */
+    [[nodiscard]] ContainerView container(Name name) const {
+        const detail::MemberInfo& member = require_member(name);
+        if (!member.container_ops) [[unlikely]] {
+            throw PropertyTypeMismatchError(name, "container", member.type_name);
+        }
+        return ContainerView{static_cast<char*>(obj_) + member.offset, member.container_ops};
+    }
+    
+    [[nodiscard]] ContainerView container(std::string_view name) const {
+        return container(Name{name});
+    }
+    
+    /**
+     * @brief Get member metadata by name, or nullptr if not found
+     */
+    [[nodiscard]] const detail::MemberInfo* get_member_info(std::string_view name) const noexcept {
+        return get_member_info(Name{name});
+    }
+    
+    /**
+     * @brief Get property category by name
+     */
+    [[nodiscard]] detail::MemberCategory property_category(std::string_view name) const {
+        return property_category(Name{name});
+    }
+    
+    /**
+     * @brief Get property type name by name
+     */
+    [[nodiscard]] std::string_view property_type_name(std::string_view name) const {
+        return property_type_name(Name{name});
+    }
+    
+    /**
+     * @brief Check if a property is a sequential container (by name)
+     */
+    [[nodiscard]] bool is_sequential_container(std::string_view name) const noexcept {
+        return is_sequential_container(Name{name});
+    }
+    
+    /**
+     * @brief Check if a property is an associative container (by name)
+     */
+    [[nodiscard]] bool is_associative_container(std::string_view name) const noexcept {
+        return is_associative_container(Name{name});
+    }
+    
     /**
      * @brief Get type name
      */
@@ -326,6 +569,49 @@ public:
     }
 
 private:
+    /**
+     * @brief Member holding a T (type checked in debug builds), throwing as get() documents
+     */
+    template<typename T>
+    const detail::MemberInfo& typed_member(Name name) const {
+        // Look up member info (no allocation with transparent hash)
+        const detail::MemberInfo* member = info_->find_member(name);
+        if (!member) [[unlikely]] {
+            if (!obj_) {
+                throw ObjectNotCreatedError(info_->name);
+            }
+            throw PropertyNotFoundError(info_->name, name, info_->member_names());
+        }
+        
+#ifndef NDEBUG
+        // Type check only in debug builds
+        if (member->type_index != std::type_index(typeid(T))) [[unlikely]] {
+            throw PropertyTypeMismatchError(name, member->type_name,
+                                            std::string{detail::type_name<T>()});
+        }
+#endif
+        return *member;
+    }
+    
+    const detail::MemberInfo& require_member(Name name) const {
+        if (!info_) [[unlikely]] {
+            throw ReflectionError("No type info available");
+        }
+        const detail::MemberInfo* member = info_->find_member(name);
+        if (!member) [[unlikely]] {
+            throw PropertyNotFoundError(info_->name, name, info_->member_names());
+        }
+        return *member;
+    }
+    
+    static const detail::TypeInfo* member_type_info(const detail::MemberInfo& member) {
+        auto& mgr = detail::TypeManager::instance();
+        if (member.type_id) [[likely]] {
+            return mgr.get_type_by_id(member.type_id);
+        }
+        return mgr.get_type(member.type_index);
+    }
+    
     const detail::TypeInfo* info_;
     void* obj_;
 };
@@ -0,0 +1,187 @@
+/**
+ * @file CallSite.hpp
+ * @brief Method calls bound once to a fixed argument layout
+ *
+ * A CallSite resolves one overload by the exact argument types a caller
+ * will pass and precomputes the arithmetic conversions between them and
+ * the registered parameters. call() is then a single indirect call into a
+ * per-arity entry and the method's ExactInvoker: no overload search, no
+ * argument count switch and no per-argument type checks.
+ *
+ * CallSites are small and copyable, meant to be cached per caller
+ * location (e.g. per VM bytecode instruction):
+ * @code
+ * const std::type_index arg_types[] = {typeid(int), typeid(double)};
+ * auto site = rttm::CallSite::resolve(*inst.type_info(), "move"_rn, arg_types);
+ *
+ * rttm::Variant args[] = {Variant::create(1), Variant::create(2.5)};
+ * rttm::Variant ret;
+ * site.call(inst.get_raw(), args, &ret);
+ * @endcode
+ *
+ * A site stays valid as long as the TypeInfo it was resolved from.
+ */
+
+#ifndef RTTM_DETAIL_CALL_SITE_HPP
+#define RTTM_DETAIL_CALL_SITE_HPP
+
+#include "TypeInfo.hpp"
+#include "Variant.hpp"
+#include "Name.hpp"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <type_traits>
+#include <vector>
+
+namespace rttm {
+
+/**
+ * @brief Overload resolved for a fixed argument layout
+ */
+class CallSite {
+public:
+    /**
+     * @brief Argument type and its arithmetic kind (None if not arithmetic/enum)
+     */
+    struct ArgType {
+        std::type_index type;
+        detail::ArithmeticKind kind;
+    };
+
+    CallSite() noexcept = default;
+
+    /**
+     * @brief Resolve method for arguments of the given types
+     *
+     * Prefers the overload whose parameters match exactly; otherwise picks
+     * the overload needing the fewest arithmetic conversions (first
+     * registered on a tie).
+     *
+     * @throws MethodNotFoundError if type has no method of that name
+     * @throws MethodSignatureMismatchError if no overload accepts the types
+     */
+    [[nodiscard]] static CallSite resolve(const detail::TypeInfo& type, Name method,
+                                          std::span<const ArgType> arg_types);
+
+    /**
+     * @brief Resolve by argument types known only at runtime
+     *
+     * Enum arguments are not recognized as converting to integers here;
+     * use the sample-argument or template overload for those.
+     */
+    [[nodiscard]] static CallSite resolve(const detail::TypeInfo& type, Name method,
+                                          std::span<const std::type_index> arg_types);
+
+    /**
+     * @brief Resolve by the types of representative arguments
+     */
+    [[nodiscard]] static CallSite resolve(const detail::TypeInfo& type, Name method,
+                                          std::span<const Variant> sample_args);
+
+    /**
+     * @brief Resolve by compile-time argument types
+     */
+    template<typename... Args>
+    [[nodiscard]] static CallSite resolve(const detail::TypeInfo& type, Name method) {
+        if constexpr (sizeof...(Args) == 0) {
+            return resolve(type, method, std::span<const ArgType>{});
+        } else {
+            const ArgType arg_types[] = {
+                ArgType{std::type_index(typeid(std::decay_t<Args>)), detail::arithmetic_kind_v<std::decay_t<Args>>}...
+            };
+            return resolve(type, method, std::span<const ArgType>{arg_types});
+        }
+    }
+
+    template<typename... Args>
+    [[nodiscard]] static CallSite resolve(const detail::TypeInfo& type, std::string_view method) {
+        return resolve<Args...>(type, Name{method});
+    }
+
+    [[nodiscard]] static CallSite resolve(const detail::TypeInfo& type, std::string_view method,
+                                          std::span<const std::type_index> arg_types) {
+        return resolve(type, Name{method}, arg_types);
+    }
+
+    [[nodiscard]] static CallSite resolve(const detail::TypeInfo& type, std::string_view method,
+                                          std::span<const Variant> sample_args) {
+        return resolve(type, Name{method}, sample_args);
+    }
+
+    [[nodiscard]] bool is_valid() const noexcept { return method_ != nullptr; }
+    [[nodiscard]] explicit operator bool() const noexcept { return is_valid(); }
+
+    [[nodiscard]] const detail::MethodInfo* method_info() const noexcept { return method_; }
+
+    [[nodiscard]] std::string_view name() const noexcept {
+        return method_ ? std::string_view{method_->name} : std::string_view{};
+    }
+
+    [[nodiscard]] std::size_t arity() const noexcept { return arg_types_.size(); }
+
+    /**
+     * @brief Number of arguments converted on every call
+     */
+    [[nodiscard]] std::size_t conversions() const noexcept { return conversions_; }
+
+    /**
+     * @brief Check that args has the layout the site was resolved for
+     *
+     * call() trusts its arguments; use this as a guard where the layout
+     * is not guaranteed (e.g. a VM's inline cache check).
+     */
+    [[nodiscard]] bool accepts(std::span<const Variant> args) const noexcept;
+
+    /**
+     * @brief Invoke on obj with arity() arguments of the resolved types
+     *
+     * @param obj Object of the type the site was resolved on
+     * @param args arity() Variants holding exactly the resolved argument types
+     * @param ret Receives the result (nullptr to discard it)
+     */
+    void call(void* obj, const Variant* args, Variant* ret) const {
+        entry_(*this, obj, args, ret);
+    }
+
+    /**
+     * @brief Convenience form returning the result
+     * @throws MethodSignatureMismatchError if args does not hold arity() arguments
+     */
+    [[nodiscard]] Variant invoke(void* obj, std::span<const Variant> args) const {
+        if (args.size() != arity()) [[unlikely]] {
+            throw MethodSignatureMismatchError(name(), std::to_string(arity()) + " arguments",
+                                               std::to_string(args.size()) + " arguments");
+        }
+        Variant ret;
+        entry_(*this, obj, args.data(), &ret);
+        return ret;
+    }
+
+private:
+    using Entry = void(*)(const CallSite& site, void* obj, const Variant* args, Variant* ret);
+
+    template<std::size_t N>
+    static void call_exact(const CallSite& site, void* obj, const Variant* args, Variant* ret);
+
+    template<std::size_t N>
+    static void call_converting(const CallSite& site, void* obj, const Variant* args, Variant* ret);
+
+    static void call_dynamic(const CallSite& site, void* obj, const Variant* args, Variant* ret);
+    static void call_invalid(const CallSite& site, void* obj, const Variant* args, Variant* ret);
+
+    const detail::MethodInfo* method_ = nullptr;
+    detail::ExactInvoker invoker_ = nullptr;
+    const void* method_ptr_ = nullptr;
+    std::size_t this_offset_ = 0;
+    Entry entry_ = &call_invalid;
+    std::vector<std::type_index> arg_types_;
+    std::vector<detail::ArithmeticConvertFn> converters_;   ///< nullptr where the argument is passed as-is
+    std::size_t conversions_ = 0;
+};
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_CALL_SITE_HPP
@@ -8,12 +8,17 @@
  * 
  * These interfaces allow uniform access to container members through reflection
  * without knowing the specific container type at compile time.
+ * 
+ * Element-wise traversal should prefer view() / for_each() / cursor(), which
+ * hand out ElementRefs without allocating; at() and begin() wrap every
+ * element in a new RType.
  */
 
 #ifndef RTTM_DETAIL_CONTAINER_HPP
 #define RTTM_DETAIL_CONTAINER_HPP
 
 #include "TypeTraits.hpp"
+#include "ContainerView.hpp"
 
 #include <memory>
 #include <cstddef>
@@ -40,11 +45,10 @@ class RType;
  * 
  * Usage:
  * @code
- * auto container = rtype->property("items")->as_sequential();
- * for (auto it = container->begin(); it->has_current(); it->next()) {
- *     auto item = it->current();
- *     // Process item...
- * }
+ * auto container = make_sequential_container(&obj.items);
+ * container->for_each([](ElementRef item) {
+ *     // Process item.as<int>() ...
+ * });
  * @endcode
  */
 class ISequentialContainer {
@@ -130,6 +134,46 @@ public:
      * @return Unique pointer to Iterator
      */
     [[nodiscard]] virtual std::unique_ptr<Iterator> begin() = 0;
+    
+    // ==================== Allocation-free Traversal ====================
+    
+    /**
+     * @brief Non-virtual, allocation-free view of the wrapped container
+     * 
+     * Implementations outside RTTM that don't override it return an empty
+     * (invalid) view, so view-based traversal visits nothing.
+     */
+    [[nodiscard]] virtual ContainerView view() { return {}; }
+    
+    /**
+     * @brief Stack-allocated cursor at the first element
+     */
+    [[nodiscard]] ContainerCursor cursor() { return view().cursor(); }
+    
+    /**
+     * @brief Call f(ElementRef) for every element (see ContainerView::for_each)
+     */
+    template<typename F>
+    bool for_each(F&& f) { return view().for_each(std::forward<F>(f)); }
+    
+    /**
+     * @brief Call f(ElementRef) for elements [first, first + count)
+     */
+    template<typename F>
+    bool visit_range(std::size_t first, std::size_t count, F&& f) {
+        return view().visit_range(first, count, std::forward<F>(f));
+    }
+    
+    /**
+     * @brief First element of a contiguous container (nullptr otherwise)
+     */
+    [[nodiscard]] void* data() { return view().data(); }
+    
+    /**
+     * @brief Typed span over a contiguous container (empty on type mismatch)
+     */
+    template<typename T>
+    [[nodiscard]] std::span<T> as_span() { return view().as_span<T>(); }
 };
 
 /**
@@ -252,6 +296,29 @@ public:
      * @return Unique pointer to KeyValueIterator
      */
     [[nodiscard]] virtual std::unique_ptr<KeyValueIterator> begin() = 0;
+    
+    // ==================== Allocation-free Traversal ====================
+    
+    /**
+     * @brief Non-virtual, allocation-free view of the wrapped container
+     * 
+     * Implementations outside RTTM that don't override it return an empty
+     * (invalid) view, so view-based traversal visits nothing.
+     */
+    [[nodiscard]] virtual ContainerView view() { return {}; }
+    
+    /**
+     * @brief Stack-allocated cursor at the first entry
+     */
+    [[nodiscard]] ContainerCursor cursor() { return view().cursor(); }
+    
+    /**
+     * @brief Call f(ElementRef key, ElementRef value) for every entry
+     * 
+     * For sets key and value refer to the same element.
+     */
+    template<typename F>
+    bool for_each(F&& f) { return view().for_each(std::forward<F>(f)); }
 };
 
 } // namespace rttm
@@ -362,6 +429,10 @@ public:
         return std::make_unique<IteratorImpl>(container_);
     }
     
+    [[nodiscard]] ContainerView view() override {
+        return ContainerView{container_, container_ops_for<Container>()};
+    }
+    
 private:
     Container* container_;
     
@@ -474,6 +545,10 @@ public:
         return std::make_unique<KeyValueIteratorImpl>(container_);
     }
     
+    [[nodiscard]] ContainerView view() override {
+        return ContainerView{container_, container_ops_for<Container>()};
+    }
+    
 private:
     Container* container_;
     
@@ -584,6 +659,10 @@ public:
         return std::make_unique<SetIteratorImpl>(container_);
     }
     
+    [[nodiscard]] ContainerView view() override {
+        return ContainerView{container_, container_ops_for<Container>()};
+    }
+    
 private:
     Container* container_;
     
@@ -0,0 +1,654 @@
+/**
+ * @file ContainerView.hpp
+ * @brief Allocation-free, non-virtual container traversal
+ *
+ * This file defines:
+ * - ElementRef: raw pointer plus static type of one element
+ * - ContainerOps: per-container-type table of plain function pointers
+ * - ContainerCursor: stack-allocated cursor with inline iterator storage
+ * - ContainerView: type-erased view of a container (for_each, visit_range,
+ *   data/size for contiguous containers)
+ *
+ * Registry records a ContainerOps table for every container member, so a
+ * container reached through reflection can be walked without creating an
+ * RType or any heap object per element.
+ *
+ * Usage:
+ * @code
+ * auto view = bound.container("scores");
+ * view.for_each([](rttm::ElementRef e) { total += e.as<int>(); });
+ *
+ * if (auto values = view.as_span<int>(); !values.empty()) {
+ *     // contiguous fast path
+ * }
+ * @endcode
+ */
+
+#ifndef RTTM_DETAIL_CONTAINER_VIEW_HPP
+#define RTTM_DETAIL_CONTAINER_VIEW_HPP
+
+#include "TypeTraits.hpp"
+#include "Conversion.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace rttm {
+
+/**
+ * @brief Non-owning reference to one container element
+ *
+ * Valid until the container is modified.
+ */
+struct ElementRef {
+    void* ptr = nullptr;                    ///< Address of the element
+    const std::type_info* type = nullptr;   ///< Static type of the element
+
+    [[nodiscard]] explicit operator bool() const noexcept { return ptr != nullptr; }
+
+    template<typename T>
+    [[nodiscard]] bool is() const noexcept {
+        return type && *type == typeid(T);
+    }
+
+    /**
+     * @brief Access the element as T (unchecked)
+     */
+    template<typename T>
+    [[nodiscard]] T& as() const noexcept {
+        return *static_cast<T*>(ptr);
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief Visitor called per element; return false to stop the traversal
+ *
+ * key is nullptr for sequential containers; for sets key == value.
+ */
+using ElementVisitor = bool(*)(void* ctx, void* key, void* value);
+
+/**
+ * @brief How the binary serializer encodes a value of a given type
+ */
+enum class CodecKind : std::uint8_t {
+    Unsupported = 0,    ///< Pointers, move-only handles, ...
+    Trivial,            ///< Trivially copyable: raw bytes
+    String,             ///< std::string: length + bytes
+    Class,              ///< Registered class: its members, recursively
+    Container           ///< Element count + elements via ContainerOps
+};
+
+struct ContainerOps;
+
+/**
+ * @brief Compile-time encoding descriptor of a type (one constexpr instance per type)
+ */
+struct TypeCodec {
+    CodecKind kind;
+    std::uint32_t size;                 ///< sizeof(T)
+    TypeId type_id;                     ///< Class: TypeManager lookup key
+    const ContainerOps* container;      ///< Container: traversal/insertion table
+    ArithmeticKind arithmetic;          ///< Arithmetic/enum representation (None otherwise)
+};
+
+/**
+ * @brief Callback filling a freshly constructed element during deserialization
+ */
+using ElementReader = void(*)(void* ctx, void* obj, const TypeCodec& codec);
+
+/**
+ * @brief Inline storage reserved for a cursor's iterator pair
+ */
+inline constexpr std::size_t CURSOR_STORAGE_SIZE = 8 * sizeof(void*);
+
+/**
+ * @brief Type-erased container operations (plain function pointers)
+ */
+struct ContainerOps {
+    const std::type_info* key_type;     ///< Key type (nullptr for sequential containers)
+    const std::type_info* value_type;   ///< Element type (mapped_type for maps)
+    std::size_t value_size;             ///< sizeof(value element); stride for contiguous data
+    bool associative;                   ///< Key-value or set container
+    bool mapped;                        ///< Key-value container (elements are key + mapped value)
+    bool contiguous;                    ///< Elements stored contiguously (data() valid)
+    const TypeCodec* key_codec;         ///< Key encoding (nullptr for sequential containers)
+    const TypeCodec* value_codec;       ///< Element encoding (mapped_type for maps)
+
+    std::size_t (*size)(const void* container) noexcept;
+    void* (*data)(void* container) noexcept;    ///< nullptr if not contiguous
+    bool (*visit)(void* container, std::size_t first, std::size_t count,
+                  ElementVisitor visitor, void* ctx);
+    
+    // Building: clear, reserve (no-op unless supported), then append one
+    // default-constructed element/entry filled by the reader.
+    // append_element is nullptr if elements aren't default constructible.
+    void (*clear)(void* container);
+    void (*reserve)(void* container, std::size_t count);
+    void (*append_element)(void* container, ElementReader reader, void* ctx);
+    void* (*resize_data)(void* container, std::size_t count);  ///< Contiguous + resizable only, else nullptr
+
+    // Cursor state: iterator pair constructed in place in CURSOR_STORAGE_SIZE bytes
+    void (*cursor_init)(void* container, void* state) noexcept;
+    void (*cursor_copy)(void* dst, const void* src) noexcept;
+    void (*cursor_destroy)(void* state) noexcept;
+    bool (*cursor_valid)(const void* state) noexcept;
+    void (*cursor_next)(void* state) noexcept;
+    void* (*cursor_key)(const void* state) noexcept;
+    void* (*cursor_value)(const void* state) noexcept;
+};
+
+/**
+ * @brief Containers that ContainerOps can describe
+ *
+ * Elements must be addressable (excludes proxy containers such as
+ * std::vector<bool>).
+ */
+template<typename C>
+concept ViewableContainer =
+    (SequentialContainer<C> || AssociativeContainer<C>) &&
+    std::is_lvalue_reference_v<decltype(*std::declval<typename C::iterator&>())>;
+
+template<typename T>
+struct TypeCodecImpl;
+
+template<ViewableContainer C>
+struct ContainerOpsImpl {
+    using iterator = typename C::iterator;
+
+    struct State {
+        iterator current;
+        iterator end;
+    };
+    static_assert(sizeof(State) <= CURSOR_STORAGE_SIZE && alignof(State) <= alignof(std::max_align_t),
+                  "Container iterator too large for ContainerCursor storage");
+
+    static constexpr bool is_map = KeyValueContainer<C>;
+    static constexpr bool is_associative = AssociativeContainer<C>;
+
+    static void* key_of(iterator it) noexcept {
+        if constexpr (is_map) {
+            return const_cast<void*>(static_cast<const void*>(std::addressof(it->first)));
+        } else if constexpr (is_associative) {
+            return const_cast<void*>(static_cast<const void*>(std::addressof(*it)));
+        } else {
+            return nullptr;
+        }
+    }
+
+    static void* value_of(iterator it) noexcept {
+        if constexpr (is_map) {
+            return static_cast<void*>(std::addressof(it->second));
+        } else {
+            return const_cast<void*>(static_cast<const void*>(std::addressof(*it)));
+        }
+    }
+
+    static constexpr const std::type_info* key_type() noexcept {
+        if constexpr (is_associative) {
+            return &typeid(typename C::key_type);
+        } else {
+            return nullptr;
+        }
+    }
+
+    static constexpr const std::type_info* value_type() noexcept {
+        if constexpr (is_map) {
+            return &typeid(typename C::mapped_type);
+        } else {
+            return &typeid(typename C::value_type);
+        }
+    }
+
+    static constexpr std::size_t value_size() noexcept {
+        if constexpr (is_map) {
+            return sizeof(typename C::mapped_type);
+        } else {
+            return sizeof(typename C::value_type);
+        }
+    }
+
+    static std::size_t size(const void* c) noexcept {
+        return static_cast<const C*>(c)->size();
+    }
+
+    static void* data(void* c) noexcept {
+        if constexpr (std::ranges::contiguous_range<C>) {
+            return static_cast<void*>(std::ranges::data(*static_cast<C*>(c)));
+        } else {
+            return nullptr;
+        }
+    }
+
+    static bool visit(void* c, std::size_t first, std::size_t count, ElementVisitor visitor, void* ctx) {
+        C& container = *static_cast<C*>(c);
+        const std::size_t n = container.size();
+        if (first >= n) return true;
+        const std::size_t last = first + std::min(count, n - first);
+
+        if constexpr (std::ranges::contiguous_range<C> && !is_associative) {
+            auto* p = std::ranges::data(container);
+            for (std::size_t i = first; i < last; ++i) {
+                if (!visitor(ctx, nullptr, static_cast<void*>(std::addressof(p[i])))) return false;
+            }
+        } else {
+            auto it = std::next(container.begin(), static_cast<std::ptrdiff_t>(first));
+            for (std::size_t i = first; i < last; ++i, ++it) {
+                if (!visitor(ctx, key_of(it), value_of(it))) return false;
+            }
+        }
+        return true;
+    }
+
+    static void clear(void* c) {
+        static_cast<C*>(c)->clear();
+    }
+
+    static void reserve(void* c, std::size_t count) {
+        if constexpr (requires(C& x) { x.reserve(count); }) {
+            static_cast<C*>(c)->reserve(count);
+        }
+    }
+
+    static void append_element(void* c, ElementReader reader, void* ctx) {
+        C& container = *static_cast<C*>(c);
+        if constexpr (!can_append) {
+            (void)container; (void)reader; (void)ctx;
+        } else if constexpr (is_map) {
+            typename C::key_type key{};
+            reader(ctx, std::addressof(key), TypeCodecImpl<typename C::key_type>::codec);
+            auto [it, inserted] = container.try_emplace(std::move(key));
+            reader(ctx, std::addressof(it->second), TypeCodecImpl<typename C::mapped_type>::codec);
+        } else if constexpr (is_associative) {
+            typename C::key_type key{};
+            reader(ctx, std::addressof(key), TypeCodecImpl<typename C::key_type>::codec);
+            container.insert(std::move(key));
+        } else if constexpr (requires { container.emplace_back(); }) {
+            auto& element = container.emplace_back();
+            reader(ctx, std::addressof(element), TypeCodecImpl<typename C::value_type>::codec);
+        } else {
+            container.push_back(typename C::value_type{});
+            reader(ctx, std::addressof(container.back()), TypeCodecImpl<typename C::value_type>::codec);
+        }
+    }
+
+    static void* resize_data(void* c, std::size_t count) {
+        if constexpr (std::ranges::contiguous_range<C> && requires(C& x) { x.resize(count); }) {
+            C& container = *static_cast<C*>(c);
+            container.resize(count);
+            return static_cast<void*>(std::ranges::data(container));
+        } else {
+            return nullptr;
+        }
+    }
+
+    static constexpr bool can_resize = std::ranges::contiguous_range<C> &&
+                                       requires(C& x, std::size_t n) { x.resize(n); };
+
+    static constexpr bool can_append = [] {
+        if constexpr (is_map) {
+            return std::is_default_constructible_v<typename C::key_type> &&
+                   std::is_default_constructible_v<typename C::mapped_type>;
+        } else if constexpr (is_associative) {
+            return std::is_default_constructible_v<typename C::key_type>;
+        } else {
+            return std::is_default_constructible_v<typename C::value_type> &&
+                   requires(C& x) { x.push_back(typename C::value_type{}); x.back(); };
+        }
+    }();
+
+    static constexpr const TypeCodec* key_codec() noexcept {
+        if constexpr (is_associative) {
+            return &TypeCodecImpl<typename C::key_type>::codec;
+        } else {
+            return nullptr;
+        }
+    }
+
+    static constexpr const TypeCodec* value_codec() noexcept {
+        if constexpr (is_map) {
+            return &TypeCodecImpl<typename C::mapped_type>::codec;
+        } else {
+            return &TypeCodecImpl<typename C::value_type>::codec;
+        }
+    }
+
+    static void cursor_init(void* c, void* state) noexcept {
+        C& container = *static_cast<C*>(c);
+        ::new (state) State{container.begin(), container.end()};
+    }
+
+    static void cursor_copy(void* dst, const void* src) noexcept {
+        ::new (dst) State(*static_cast<const State*>(src));
+    }
+
+    static void cursor_destroy(void* state) noexcept {
+        static_cast<State*>(state)->~State();
+    }
+
+    static bool cursor_valid(const void* state) noexcept {
+        const State& s = *static_cast<const State*>(state);
+        return s.current != s.end;
+    }
+
+    static void cursor_next(void* state) noexcept {
+        ++static_cast<State*>(state)->current;
+    }
+
+    static void* cursor_key(const void* state) noexcept {
+        return key_of(static_cast<const State*>(state)->current);
+    }
+
+    static void* cursor_value(const void* state) noexcept {
+        return value_of(static_cast<const State*>(state)->current);
+    }
+
+    static constexpr ContainerOps ops = {
+        key_type(),
+        value_type(),
+        value_size(),
+        is_associative,
+        is_map,
+        std::ranges::contiguous_range<C>,
+        key_codec(),
+        value_codec(),
+        &size,
+        &data,
+        &visit,
+        &clear,
+        &reserve,
+        can_append ? &append_element : nullptr,
+        can_resize ? &resize_data : nullptr,
+        &cursor_init,
+        &cursor_copy,
+        &cursor_destroy,
+        &cursor_valid,
+        &cursor_next,
+        &cursor_key,
+        &cursor_value
+    };
+};
+
+/**
+ * @brief Encoding descriptor for T
+ */
+template<typename T>
+struct TypeCodecImpl {
+    static constexpr CodecKind kind() noexcept {
+        if constexpr (std::is_same_v<T, std::string>) {
+            return CodecKind::String;
+        } else if constexpr (std::is_pointer_v<T> || std::is_member_pointer_v<T>) {
+            return CodecKind::Unsupported;
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            return CodecKind::Trivial;
+        } else if constexpr (ViewableContainer<T>) {
+            return CodecKind::Container;
+        } else if constexpr (std::is_class_v<T>) {
+            return CodecKind::Class;
+        } else {
+            return CodecKind::Unsupported;
+        }
+    }
+
+    static constexpr const ContainerOps* container() noexcept {
+        if constexpr (kind() == CodecKind::Container) {
+            return &ContainerOpsImpl<T>::ops;
+        } else {
+            return nullptr;
+        }
+    }
+
+    static constexpr TypeCodec codec = {
+        kind(),
+        static_cast<std::uint32_t>(sizeof(T)),
+        type_id<T>,
+        container(),
+        arithmetic_kind_v<T>
+    };
+};
+
+/**
+ * @brief Encoding descriptor for T
+ */
+template<typename T>
+[[nodiscard]] constexpr const TypeCodec* type_codec_for() noexcept {
+    return &TypeCodecImpl<std::remove_cv_t<T>>::codec;
+}
+
+/**
+ * @brief ContainerOps table for C, or nullptr if C is not viewable
+ */
+template<typename C>
+[[nodiscard]] constexpr const ContainerOps* container_ops_for() noexcept {
+    if constexpr (ViewableContainer<C>) {
+        return &ContainerOpsImpl<C>::ops;
+    } else {
+        return nullptr;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Stack-allocated, non-virtual container cursor
+ *
+ * Holds the container's iterator pair inline; advancing and reading are
+ * plain function-pointer calls with no allocation.
+ *
+ * @code
+ * for (auto cur = view.cursor(); cur.has_current(); cur.next()) {
+ *     int& v = cur.value().as<int>();
+ * }
+ * @endcode
+ */
+class ContainerCursor {
+public:
+    ContainerCursor() noexcept = default;
+
+    ContainerCursor(void* container, const detail::ContainerOps* ops) noexcept : ops_(ops) {
+        ops_->cursor_init(container, state_);
+    }
+
+    ContainerCursor(const ContainerCursor& other) noexcept : ops_(other.ops_) {
+        if (ops_) ops_->cursor_copy(state_, other.state_);
+    }
+
+    ContainerCursor& operator=(const ContainerCursor& other) noexcept {
+        if (this != &other) {
+            reset();
+            ops_ = other.ops_;
+            if (ops_) ops_->cursor_copy(state_, other.state_);
+        }
+        return *this;
+    }
+
+    ~ContainerCursor() {
+        reset();
+    }
+
+    [[nodiscard]] bool has_current() const noexcept {
+        return ops_ && ops_->cursor_valid(state_);
+    }
+
+    void next() noexcept {
+        ops_->cursor_next(state_);
+    }
+
+    /**
+     * @brief Current key (empty for sequential containers; the element for sets)
+     */
+    [[nodiscard]] ElementRef key() const noexcept {
+        return {ops_->cursor_key(state_), ops_->key_type};
+    }
+
+    /**
+     * @brief Current element (mapped value for maps)
+     */
+    [[nodiscard]] ElementRef value() const noexcept {
+        return {ops_->cursor_value(state_), ops_->value_type};
+    }
+
+    [[nodiscard]] ElementRef current() const noexcept {
+        return value();
+    }
+
+private:
+    void reset() noexcept {
+        if (ops_) {
+            ops_->cursor_destroy(state_);
+            ops_ = nullptr;
+        }
+    }
+
+    const detail::ContainerOps* ops_ = nullptr;
+    alignas(std::max_align_t) unsigned char state_[detail::CURSOR_STORAGE_SIZE];
+};
+
+/**
+ * @brief Lightweight type-erased view of a reflected container
+ *
+ * Two pointers, trivially copyable. The container must outlive the view.
+ * A default-constructed (invalid) view behaves as an empty container.
+ */
+class ContainerView {
+public:
+    ContainerView() noexcept = default;
+
+    ContainerView(void* container, const detail::ContainerOps* ops) noexcept
+        : container_(container), ops_(ops) {}
+
+    /**
+     * @brief Create a view of a statically known container
+     */
+    template<detail::ViewableContainer C>
+    [[nodiscard]] static ContainerView of(C& container) noexcept {
+        return {static_cast<void*>(std::addressof(container)), detail::container_ops_for<C>()};
+    }
+
+    [[nodiscard]] bool is_valid() const noexcept { return container_ && ops_; }
+    [[nodiscard]] explicit operator bool() const noexcept { return is_valid(); }
+
+    [[nodiscard]] std::size_t size() const noexcept { return ops_ ? ops_->size(container_) : 0; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    [[nodiscard]] bool is_associative() const noexcept { return ops_ && ops_->associative; }
+
+    /**
+     * @brief Element type (mapped_type for maps), typeid(void) for an empty view
+     */
+    [[nodiscard]] const std::type_info& value_type() const noexcept { return ops_ ? *ops_->value_type : typeid(void); }
+
+    /**
+     * @brief Key type, or nullptr for sequential containers
+     */
+    [[nodiscard]] const std::type_info* key_type() const noexcept { return ops_ ? ops_->key_type : nullptr; }
+
+    /**
+     * @brief Check whether elements are stored contiguously (data() is valid)
+     */
+    [[nodiscard]] bool is_contiguous() const noexcept { return ops_ && ops_->contiguous; }
+
+    /**
+     * @brief Pointer to the first element of a contiguous container
+     *
+     * nullptr for non-contiguous containers (and possibly when empty).
+     *
+     * Elements are value_size() bytes apart.
+     */
+    [[nodiscard]] void* data() const noexcept { return ops_ ? ops_->data(container_) : nullptr; }
+    [[nodiscard]] std::size_t value_size() const noexcept { return ops_ ? ops_->value_size : 0; }
+
+    /**
+     * @brief Typed bulk access to a contiguous container
+     * @return The elements, or an empty span if T doesn't match or the
+     *         container isn't contiguous
+     */
+    template<typename T>
+    [[nodiscard]] std::span<T> as_span() const noexcept {
+        if (!ops_ || *ops_->value_type != typeid(std::remove_cv_t<T>)) return {};
+        void* p = ops_->data(container_);
+        return p ? std::span<T>{static_cast<T*>(p), ops_->size(container_)} : std::span<T>{};
+    }
+
+    /**
+     * @brief Stack-allocated cursor at the first element
+     */
+    [[nodiscard]] ContainerCursor cursor() const noexcept {
+        return is_valid() ? ContainerCursor{container_, ops_} : ContainerCursor{};
+    }
+
+    /**
+     * @brief Call f for every element
+     *
+     * f takes (ElementRef value) or (ElementRef key, ElementRef value) and
+     * may return bool; returning false stops the traversal.
+     *
+     * @return false if f stopped the traversal early
+     */
+    template<typename F>
+    bool for_each(F&& f) const {
+        return visit_range(0, static_cast<std::size_t>(-1), std::forward<F>(f));
+    }
+
+    /**
+     * @brief Call f for elements [first, first + count) in iteration order
+     *
+     * Contiguous containers are walked by pointer; others advance an
+     * iterator to first, then step.
+     *
+     * @return false if f stopped the traversal early
+     */
+    template<typename F>
+    bool visit_range(std::size_t first, std::size_t count, F&& f) const {
+        if (!is_valid()) return true;
+        
+        using Fn = std::remove_reference_t<F>;
+        struct Ctx {
+            Fn* fn;
+            const detail::ContainerOps* ops;
+        } ctx{std::addressof(f), ops_};
+
+        return ops_->visit(container_, first, count, [](void* c, void* key, void* value) -> bool {
+            auto& x = *static_cast<Ctx*>(c);
+            ElementRef v{value, x.ops->value_type};
+            if constexpr (std::is_invocable_v<Fn&, ElementRef, ElementRef>) {
+                ElementRef k{key, x.ops->key_type};
+                if constexpr (std::is_same_v<std::invoke_result_t<Fn&, ElementRef, ElementRef>, bool>) {
+                    return (*x.fn)(k, v);
+                } else {
+                    (*x.fn)(k, v);
+                    return true;
+                }
+            } else {
+                if constexpr (std::is_same_v<std::invoke_result_t<Fn&, ElementRef>, bool>) {
+                    return (*x.fn)(v);
+                } else {
+                    (*x.fn)(v);
+                    return true;
+                }
+            }
+        }, &ctx);
+    }
+
+    [[nodiscard]] void* get_raw() const noexcept { return container_; }
+    [[nodiscard]] const detail::ContainerOps* ops() const noexcept { return ops_; }
+
+private:
+    void* container_ = nullptr;
+    const detail::ContainerOps* ops_ = nullptr;
+};
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_CONTAINER_VIEW_HPP
@@ -0,0 +1,174 @@
+/**
+ * @file Conversion.hpp
+ * @brief Precomputed arithmetic conversion matrix
+ *
+ * This file defines:
+ * - ArithmeticKind: compact tag for every built-in arithmetic type
+ * - arithmetic_kind_v: maps a type (or an enum, via its underlying type)
+ *   to its kind
+ * - convert_arithmetic: converts between any two kinds with one indexed
+ *   indirect call instead of a chain of typeid comparisons
+ * - arithmetic_kind_of: runtime kind lookup by type_index (setup paths)
+ */
+
+#ifndef RTTM_DETAIL_CONVERSION_HPP
+#define RTTM_DETAIL_CONVERSION_HPP
+
+#include <array>
+#include <tuple>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <typeindex>
+
+namespace rttm::detail {
+
+/**
+ * @brief Built-in arithmetic type tag (None for everything else)
+ */
+enum class ArithmeticKind : std::uint8_t {
+    None = 0,
+    Bool,
+    Char,
+    SignedChar,
+    UnsignedChar,
+    Short,
+    UnsignedShort,
+    Int,
+    UnsignedInt,
+    Long,
+    UnsignedLong,
+    LongLong,
+    UnsignedLongLong,
+    Float,
+    Double,
+    LongDouble
+};
+
+/**
+ * @brief Types of the conversion matrix, in ArithmeticKind order (minus None)
+ */
+using ArithmeticTypes = std::tuple<
+    bool, char, signed char, unsigned char,
+    short, unsigned short, int, unsigned int,
+    long, unsigned long, long long, unsigned long long,
+    float, double, long double>;
+
+inline constexpr std::size_t ARITHMETIC_KIND_COUNT = std::tuple_size_v<ArithmeticTypes>;
+
+namespace conversion_detail {
+
+template<typename T, std::size_t I = 0>
+constexpr ArithmeticKind kind_of() noexcept {
+    if constexpr (I == ARITHMETIC_KIND_COUNT) {
+        return ArithmeticKind::None;
+    } else if constexpr (std::is_same_v<T, std::tuple_element_t<I, ArithmeticTypes>>) {
+        return static_cast<ArithmeticKind>(I + 1);
+    } else {
+        return kind_of<T, I + 1>();
+    }
+}
+
+template<typename T, bool = std::is_enum_v<T>>
+struct underlying_or_self { using type = T; };
+
+template<typename T>
+struct underlying_or_self<T, true> { using type = std::underlying_type_t<T>; };
+
+} // namespace conversion_detail
+
+/**
+ * @brief Arithmetic representation of T
+ *
+ * Enums are represented by their underlying integer type.
+ */
+template<typename T>
+using arithmetic_repr_t = typename conversion_detail::underlying_or_self<std::remove_cv_t<T>>::type;
+
+/**
+ * @brief ArithmeticKind of T (enums map to their underlying type)
+ */
+template<typename T>
+inline constexpr ArithmeticKind arithmetic_kind_v = conversion_detail::kind_of<arithmetic_repr_t<T>>();
+
+namespace conversion_detail {
+
+template<std::size_t... I>
+ArithmeticKind kind_of_runtime(std::type_index type, std::index_sequence<I...>) noexcept {
+    ArithmeticKind kind = ArithmeticKind::None;
+    (void)((type == std::type_index(typeid(std::tuple_element_t<I, ArithmeticTypes>))
+            && (kind = static_cast<ArithmeticKind>(I + 1), true)) || ...);
+    return kind;
+}
+
+} // namespace conversion_detail
+
+/**
+ * @brief ArithmeticKind of a type known only at runtime
+ *
+ * Compares against every arithmetic type, so meant for one-time setup
+ * (call site resolution), not per-value paths. Enums are not recognized:
+ * their kind is only known through arithmetic_kind_v or a Variant.
+ */
+[[nodiscard]] inline ArithmeticKind arithmetic_kind_of(std::type_index type) noexcept {
+    return conversion_detail::kind_of_runtime(type, std::make_index_sequence<ARITHMETIC_KIND_COUNT>{});
+}
+
+/**
+ * @brief Converts *src (of the row type) into *dst (of the column type)
+ */
+using ArithmeticConvertFn = void(*)(const void* src, void* dst) noexcept;
+
+namespace conversion_detail {
+
+template<typename From, typename To>
+void convert_one(const void* src, void* dst) noexcept {
+    *static_cast<To*>(dst) = static_cast<To>(*static_cast<const From*>(src));
+}
+
+template<typename From, std::size_t... J>
+constexpr std::array<ArithmeticConvertFn, ARITHMETIC_KIND_COUNT> make_row(std::index_sequence<J...>) noexcept {
+    return {{ &convert_one<From, std::tuple_element_t<J, ArithmeticTypes>>... }};
+}
+
+template<std::size_t... I>
+constexpr auto make_matrix(std::index_sequence<I...>) noexcept {
+    return std::array<std::array<ArithmeticConvertFn, ARITHMETIC_KIND_COUNT>, ARITHMETIC_KIND_COUNT>{{
+        make_row<std::tuple_element_t<I, ArithmeticTypes>>(std::make_index_sequence<ARITHMETIC_KIND_COUNT>{})...
+    }};
+}
+
+} // namespace conversion_detail
+
+/**
+ * @brief conversion_matrix[from - 1][to - 1] converts between two kinds
+ */
+inline constexpr auto conversion_matrix =
+    conversion_detail::make_matrix(std::make_index_sequence<ARITHMETIC_KIND_COUNT>{});
+
+/**
+ * @brief Convert an arithmetic value between two kinds
+ * @return false if either kind is None (dst untouched)
+ */
+inline bool convert_arithmetic(ArithmeticKind from, const void* src, ArithmeticKind to, void* dst) noexcept {
+    if (from == ArithmeticKind::None || to == ArithmeticKind::None) [[unlikely]] {
+        return false;
+    }
+    conversion_matrix[static_cast<std::size_t>(from) - 1][static_cast<std::size_t>(to) - 1](src, dst);
+    return true;
+}
+
+/**
+ * @brief Convert an arithmetic value of the given kind to T (arithmetic or enum)
+ */
+template<typename T>
+[[nodiscard]] inline T convert_arithmetic_to(ArithmeticKind from, const void* src) noexcept {
+    static_assert(arithmetic_kind_v<T> != ArithmeticKind::None, "T must be arithmetic or an enum");
+    arithmetic_repr_t<T> out{};
+    convert_arithmetic(from, src, arithmetic_kind_v<T>, &out);
+    return static_cast<T>(out);
+}
+
+} // namespace rttm::detail
+
+#endif // RTTM_DETAIL_CONVERSION_HPP
@@ -0,0 +1,169 @@
+/**
+ * @file Diff.hpp
+ * @brief Snapshots, structural diffs and patches of registered objects
+ *
+ * For state replication: diff() compares two objects of the same type
+ * member by member, straight through their memory, and writes only what
+ * changed; apply_patch() replays that onto another copy. No Variant is
+ * built on either side.
+ * - runs of adjacent trivially copyable members are compared with one
+ *   memcmp, then bisected per member only when the run differs
+ * - registered class members produce nested patches
+ * - vector-like containers (contiguous and resizable) produce dirty
+ *   element ranges; other containers are resent whole when they differ
+ *
+ * Patch format (builds on the Serializer.hpp encoding, native
+ * endianness, same registration required on both sides):
+ * - class: change mask of ceil(members / 8) bytes, bit i for the i-th
+ *   member in offset order, followed by the change of each set member
+ * - trivially copyable member: its bytes
+ * - class member: its nested class patch
+ * - vector-like member: LEB128 new size, then (skip, count) LEB128 pairs
+ *   each followed by count elements, ending with the pair (0, 0)
+ * - anything else: its serialized value
+ *
+ * Typical server loop, keeping one snapshot per replicated object:
+ * @code
+ * auto last_sent = rttm::snapshot(player);
+ *
+ * std::vector<std::byte> patch;
+ * if (rttm::diff(last_sent, player, patch)) {
+ *     send(patch);
+ *     rttm::apply_patch(last_sent, patch);   // snapshot catches up
+ * }
+ * @endcode
+ *
+ * Comparison is bitwise for trivially copyable members: padding inside a
+ * trivially copyable struct or a float flipping between 0.0 and -0.0
+ * counts as a change. Unordered containers holding equal elements in a
+ * different iteration order are also reported as changed. Both only cost
+ * bytes, never correctness.
+ */
+
+#ifndef RTTM_DETAIL_DIFF_HPP
+#define RTTM_DETAIL_DIFF_HPP
+
+#include "TypeInfo.hpp"
+#include "Serializer.hpp"
+#include "Exceptions.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace rttm {
+
+/**
+ * @brief Owned copy of a registered object, for diffing against later
+ */
+class Snapshot {
+public:
+    Snapshot() noexcept = default;
+
+    /**
+     * @brief Copy-construct obj into storage owned by the snapshot
+     * @throws ObjectNotCreatedError if the type is not copy constructible
+     */
+    Snapshot(const void* obj, const detail::TypeInfo& type);
+
+    Snapshot(Snapshot&&) noexcept = default;
+    Snapshot& operator=(Snapshot&&) noexcept = default;
+
+    [[nodiscard]] bool is_valid() const noexcept { return storage_ != nullptr; }
+    [[nodiscard]] explicit operator bool() const noexcept { return is_valid(); }
+
+    [[nodiscard]] const detail::TypeInfo* type_info() const noexcept { return type_; }
+
+    [[nodiscard]] void* get() noexcept { return storage_.get(); }
+    [[nodiscard]] const void* get() const noexcept { return storage_.get(); }
+
+    /**
+     * @brief Replace the copy with the current state of obj
+     */
+    void update(const void* obj);
+
+private:
+    struct Deleter {
+        const detail::TypeInfo* type;
+        void operator()(void* obj) const noexcept;
+    };
+
+    const detail::TypeInfo* type_ = nullptr;
+    std::unique_ptr<void, Deleter> storage_;
+};
+
+/**
+ * @brief Take a snapshot of obj
+ */
+[[nodiscard]] inline Snapshot snapshot(const void* obj, const detail::TypeInfo& type) {
+    return Snapshot(obj, type);
+}
+
+/**
+ * @brief Append a patch turning old_obj into new_obj
+ *
+ * Appends nothing when the objects compare equal.
+ *
+ * @return true if anything changed
+ * @throws SerializationError if a member has no binary encoding
+ */
+bool diff(const void* old_obj, const void* new_obj, const detail::TypeInfo& type, std::vector<std::byte>& out);
+
+/**
+ * @brief Apply a patch produced by diff() to an object equal to its old_obj
+ *
+ * An empty patch is a no-op.
+ *
+ * @return Number of bytes consumed
+ * @throws SerializationError on truncated or malformed input
+ */
+std::size_t apply_patch(void* obj, const detail::TypeInfo& type, std::span<const std::byte> patch);
+
+namespace detail {
+
+// Checks the held type by type_index: no TypeManager lookup per diff
+template<typename T>
+[[nodiscard]] const TypeInfo& require_snapshot_of(const Snapshot& snap) {
+    const TypeInfo* type = snap.type_info();
+    if (!type || type->type_index != std::type_index(typeid(T))) [[unlikely]] {
+        throw ReflectionError("Snapshot does not hold a " + std::string(type_name<T>()));
+    }
+    return *type;
+}
+
+} // namespace detail
+
+template<typename T>
+[[nodiscard]] Snapshot snapshot(const T& obj) {
+    return Snapshot(static_cast<const void*>(&obj), detail::require_type_info<T>());
+}
+
+template<typename T>
+bool diff(const T& old_obj, const T& new_obj, std::vector<std::byte>& out) {
+    return diff(static_cast<const void*>(&old_obj), static_cast<const void*>(&new_obj),
+                detail::require_type_info<T>(), out);
+}
+
+template<typename T>
+bool diff(const Snapshot& old_state, const T& new_obj, std::vector<std::byte>& out) {
+    return diff(old_state.get(), static_cast<const void*>(&new_obj), detail::require_snapshot_of<T>(old_state), out);
+}
+
+template<typename T>
+std::size_t apply_patch(T& obj, std::span<const std::byte> patch) {
+    return apply_patch(static_cast<void*>(&obj), detail::require_type_info<T>(), patch);
+}
+
+inline std::size_t apply_patch(Snapshot& state, std::span<const std::byte> patch) {
+    if (!state) [[unlikely]] {
+        throw ReflectionError("Cannot apply a patch to an empty snapshot");
+    }
+    return apply_patch(state.get(), *state.type_info(), patch);
+}
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_DIFF_HPP
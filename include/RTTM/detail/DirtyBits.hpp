@@ -0,0 +1,108 @@
+/**
+ * @file DirtyBits.hpp
+ * @brief Per-instance changed-member bitset for change-tracked types
+ *
+ * A type opts in by holding a DirtyBits member and naming it at
+ * registration:
+ * @code
+ * struct Player {
+ *     int hp;
+ *     std::string name;
+ *     rttm::DirtyBits<> dirty;
+ * };
+ *
+ * Registry<Player>()
+ *     .property("hp", &Player::hp)
+ *     .property("name", &Player::name)
+ *     .track_changes(&Player::dirty);
+ * @endcode
+ *
+ * Reflected writes (PropertyHandle::set, DynamicProperty::set_value,
+ * BoundType::set, Instance::set_property) then set the bit of the
+ * member's ordinal. Writes through references handed out by get() and
+ * plain C++ assignments are not seen. Types registered without
+ * track_changes() keep zero dirty state, and their writes only skip a
+ * predicted branch on data the write already loaded.
+ */
+
+#ifndef RTTM_DETAIL_DIRTY_BITS_HPP
+#define RTTM_DETAIL_DIRTY_BITS_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace rttm {
+
+/**
+ * @brief Fixed-capacity bitset indexed by member ordinal
+ *
+ * @tparam N Number of member ordinals it can hold (registration fails if
+ *           the type has more members)
+ */
+template<std::size_t N = 64>
+class DirtyBits {
+    static_assert(N > 0, "DirtyBits needs at least one bit");
+
+public:
+    static constexpr std::size_t capacity = N;
+    static constexpr std::size_t word_count = (N + 63) / 64;
+
+    [[nodiscard]] constexpr bool test(std::size_t ordinal) const noexcept {
+        return (words_[ordinal / 64] >> (ordinal % 64)) & 1u;
+    }
+
+    constexpr void set(std::size_t ordinal) noexcept {
+        words_[ordinal / 64] |= std::uint64_t{1} << (ordinal % 64);
+    }
+
+    constexpr void reset(std::size_t ordinal) noexcept {
+        words_[ordinal / 64] &= ~(std::uint64_t{1} << (ordinal % 64));
+    }
+
+    constexpr void clear() noexcept {
+        words_ = {};
+    }
+
+    [[nodiscard]] constexpr bool any() const noexcept {
+        for (std::uint64_t word : words_) {
+            if (word) return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] constexpr std::size_t count() const noexcept {
+        std::size_t n = 0;
+        for (std::uint64_t word : words_) {
+            n += static_cast<std::size_t>(std::popcount(word));
+        }
+        return n;
+    }
+
+    /**
+     * @brief Call f(ordinal) for every set bit, in ascending order
+     */
+    template<typename F>
+    constexpr void for_each(F&& f) const {
+        for (std::size_t w = 0; w < word_count; ++w) {
+            for (std::uint64_t word = words_[w]; word; word &= word - 1) {
+                f(w * 64 + static_cast<std::size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr std::span<const std::uint64_t, word_count> words() const noexcept {
+        return words_;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const DirtyBits&) const noexcept = default;
+
+private:
+    std::array<std::uint64_t, word_count> words_{};
+};
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_DIRTY_BITS_HPP
@@ -10,6 +10,7 @@
  * - ObjectNotCreatedError: Thrown when object has not been created
  * - PropertyTypeMismatchError: Thrown for type mismatch during property access
  * - MethodNotFoundError: Thrown when a method is not found
+ * - SerializationError: Thrown when a value can't be serialized or deserialized
  */
 
 #ifndef RTTM_DETAIL_EXCEPTIONS_HPP
@@ -388,6 +389,25 @@ private:
     std::vector<std::string> available_methods_;
 };
 
+/**
+ * @brief Exception thrown by the binary serializer
+ * 
+ * Raised when a member type has no binary encoding, when an output buffer
+ * is too small, or when input data is truncated or malformed.
+ * 
+ * @code
+ * try {
+ *     rttm::deserialize(obj, bytes);
+ * } catch (const SerializationError& e) {
+ *     std::cout << "Bad message: " << e.what() << std::endl;
+ * }
+ * @endcode
+ */
+class SerializationError : public ReflectionError {
+public:
+    using ReflectionError::ReflectionError;
+};
+
 } // namespace rttm
 
 #endif // RTTM_DETAIL_EXCEPTIONS_HPP
@@ -0,0 +1,85 @@
+/**
+ * @file InlineCache.hpp
+ * @brief Fixed-size lock-free cache used on reflection hot paths
+ */
+
+#ifndef RTTM_DETAIL_INLINE_CACHE_HPP
+#define RTTM_DETAIL_INLINE_CACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace rttm::detail {
+
+/**
+ * @brief Small inline cache for hot path optimization
+ * 
+ * Safe for concurrent find() and insert(): each entry is a seqlock over
+ * atomic words, so readers never block and never see a torn key/value
+ * pair. The writer's release fence after taking the odd sequence pairs
+ * with the reader's acquire fence before its re-check: a reader that sees
+ * any of the new key/value stores also sees the odd (or newer) sequence
+ * and retries. A writer that loses the race for a slot just skips caching.
+ * Copies start empty.
+ */
+template<typename Key, typename Value, std::size_t N = 4>
+class InlineCache {
+    static_assert(std::atomic<Key>::is_always_lock_free && std::atomic<Value>::is_always_lock_free,
+                  "InlineCache entries must be lock-free atomics");
+
+public:
+    struct Entry {
+        std::atomic<std::uint32_t> seq{0};  ///< 0 = empty, odd = being written
+        std::atomic<Key> key{};
+        std::atomic<Value> value{};
+    };
+
+    InlineCache() noexcept = default;
+    InlineCache(const InlineCache&) noexcept {}
+    InlineCache& operator=(const InlineCache&) noexcept { return *this; }
+
+    bool find(const Key& key, Value& out) const noexcept {
+        for (const auto& entry : entries_) {
+            const std::uint32_t seq = entry.seq.load(std::memory_order_acquire);
+            if (seq == 0 || (seq & 1u) || entry.key.load(std::memory_order_relaxed) != key) {
+                continue;
+            }
+            Value value = entry.value.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (entry.seq.load(std::memory_order_relaxed) == seq) [[likely]] {
+                out = value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void insert(const Key& key, const Value& value) noexcept {
+        // Find empty slot or replace first entry (simple eviction)
+        Entry* slot = &entries_[0];
+        for (auto& entry : entries_) {
+            if (entry.seq.load(std::memory_order_relaxed) == 0) {
+                slot = &entry;
+                break;
+            }
+        }
+
+        std::uint32_t seq = slot->seq.load(std::memory_order_relaxed);
+        if ((seq & 1u) || !slot->seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire)) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        slot->key.store(key, std::memory_order_relaxed);
+        slot->value.store(value, std::memory_order_relaxed);
+        slot->seq.store(seq + 2, std::memory_order_release);
+    }
+
+private:
+    std::array<Entry, N> entries_{};
+};
+
+} // namespace rttm::detail
+
+#endif // RTTM_DETAIL_INLINE_CACHE_HPP
@@ -0,0 +1,159 @@
+/**
+ * @file InplaceFunction.hpp
+ * @brief Non-allocating type-erased callable with inline storage
+ *
+ * InplaceFunction replaces std::function for the callables TypeInfo and
+ * MethodInfo keep (factories, destructor, copier, fallback invoker):
+ * - the callable always lives in an inline buffer (Capacity bytes, 32 by
+ *   default); one that does not fit is a compile error, never a heap
+ *   allocation
+ * - a call is one indirect call through a function pointer, with no
+ *   virtual dispatch and no empty-check branch inside the wrapper
+ * - trivially copyable callables (captureless lambdas, lambdas capturing
+ *   member function pointers) are copied with memcpy and need no
+ *   destructor call
+ *
+ * Unlike a strictly move-only wrapper it is copyable, because MethodInfo
+ * is copied when Registry<T>::base() flattens inherited methods; stored
+ * callables must therefore be copy constructible.
+ */
+
+#ifndef RTTM_DETAIL_INPLACE_FUNCTION_HPP
+#define RTTM_DETAIL_INPLACE_FUNCTION_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rttm::detail {
+
+template<typename Signature, std::size_t Capacity = 32>
+class InplaceFunction;
+
+template<typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+    static constexpr std::size_t capacity = Capacity;
+
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Store a callable inline
+     *
+     * F must fit in Capacity bytes, be copy constructible and nothrow move
+     * constructible, and be invocable as R(Args...).
+     */
+    template<typename F>
+        requires (!std::is_same_v<std::decay_t<F>, InplaceFunction> &&
+                  std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    InplaceFunction(F&& f) {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= Capacity, "Callable does not fit in InplaceFunction storage");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t), "Callable is over-aligned for InplaceFunction");
+        static_assert(std::is_copy_constructible_v<Fn>, "InplaceFunction callables must be copyable");
+        static_assert(std::is_nothrow_move_constructible_v<Fn>, "InplaceFunction callables must be nothrow movable");
+
+        ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(f));
+        invoke_ = &invoke_impl<Fn>;
+        if constexpr (!std::is_trivially_copyable_v<Fn>) {
+            manage_ = &manage_impl<Fn>;
+        }
+    }
+
+    InplaceFunction(const InplaceFunction& other) : invoke_(other.invoke_), manage_(other.manage_) {
+        if (manage_) {
+            manage_(Op::Copy, storage_, const_cast<std::byte*>(other.storage_));
+        } else {
+            std::memcpy(storage_, other.storage_, Capacity);
+        }
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept {
+        take(other);
+    }
+
+    InplaceFunction& operator=(const InplaceFunction& other) {
+        if (this != &other) {
+            InplaceFunction copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            take(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    ~InplaceFunction() {
+        reset();
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept { return invoke_ != nullptr; }
+
+    /**
+     * @brief Call the stored callable (must not be empty)
+     */
+    R operator()(Args... args) const {
+        return invoke_(const_cast<std::byte*>(storage_), std::forward<Args>(args)...);
+    }
+
+private:
+    enum class Op { Copy, Move, Destroy };
+
+    using Invoke = R(*)(void* storage, Args&&... args);
+    using Manage = void(*)(Op op, void* dst, void* src);
+
+    template<typename Fn>
+    static R invoke_impl(void* storage, Args&&... args) {
+        return std::invoke(*static_cast<Fn*>(storage), std::forward<Args>(args)...);
+    }
+
+    template<typename Fn>
+    static void manage_impl(Op op, void* dst, void* src) {
+        switch (op) {
+            case Op::Copy:    ::new (dst) Fn(*static_cast<const Fn*>(src)); break;
+            case Op::Move:    ::new (dst) Fn(std::move(*static_cast<Fn*>(src))); break;
+            case Op::Destroy: static_cast<Fn*>(dst)->~Fn(); break;
+        }
+    }
+
+    // Source keeps its (moved-from) callable and destroys it itself
+    void take(InplaceFunction& other) noexcept {
+        invoke_ = other.invoke_;
+        manage_ = other.manage_;
+        if (manage_) {
+            manage_(Op::Move, storage_, other.storage_);
+        } else {
+            std::memcpy(storage_, other.storage_, Capacity);
+        }
+    }
+
+    void reset() noexcept {
+        if (manage_) {
+            manage_(Op::Destroy, storage_, nullptr);
+        }
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+
+    alignas(std::max_align_t) std::byte storage_[Capacity]{};
+    Invoke invoke_ = nullptr;
+    Manage manage_ = nullptr;   ///< nullptr for trivially copyable callables
+};
+
+} // namespace rttm::detail
+
+#endif // RTTM_DETAIL_INPLACE_FUNCTION_HPP
@@ -18,12 +18,19 @@
 #include "TypeInfo.hpp"
 #include "TypeManager.hpp"
 #include "Variant.hpp"
+#include "Async.hpp"
+#include "CallSite.hpp"
 #include "Exceptions.hpp"
+#include "PropertyHandle.hpp"
+#include "Name.hpp"
 
 #include <memory>
+#include <memory_resource>
 #include <string_view>
 #include <any>
 #include <span>
+#include <utility>
+#include <stdexcept>
 
 namespace rttm {
 
@@ -31,6 +38,7 @@ namespace rttm {
 class RTypeHandle;
 class DynamicProperty;
 class DynamicMethod;
+class InstanceArray;
 
 /**
  * @brief Cached property handle for pure dynamic access
@@ -76,19 +84,15 @@ public:
         
         if (member_->type_index == typeid(T)) [[likely]] {
             *static_cast<T*>(prop_ptr) = value;
+            detail::mark_dirty(*member_, obj);
             return;
         }
         
-        // Handle numeric conversions
-        if constexpr (std::is_arithmetic_v<T>) {
-            if (member_->type_index == typeid(int)) {
-                *static_cast<int*>(prop_ptr) = static_cast<int>(value);
-            } else if (member_->type_index == typeid(float)) {
-                *static_cast<float*>(prop_ptr) = static_cast<float>(value);
-            } else if (member_->type_index == typeid(double)) {
-                *static_cast<double*>(prop_ptr) = static_cast<double>(value);
-            } else if (member_->type_index == typeid(long)) {
-                *static_cast<long*>(prop_ptr) = static_cast<long>(value);
+        // Arithmetic/enum conversion via the conversion matrix
+        if constexpr (detail::arithmetic_kind_v<T> != detail::ArithmeticKind::None) {
+            const detail::arithmetic_repr_t<T> repr = static_cast<detail::arithmetic_repr_t<T>>(value);
+            if (detail::convert_arithmetic(detail::arithmetic_kind_v<T>, &repr, member_->arithmetic_kind, prop_ptr)) {
+                detail::mark_dirty(*member_, obj);
             }
         }
     }
@@ -105,18 +109,104 @@ public:
             return *static_cast<T*>(prop_ptr);
         }
         
-        // Handle numeric conversions
-        if constexpr (std::is_arithmetic_v<T>) {
-            if (member_->type_index == typeid(int)) {
-                return static_cast<T>(*static_cast<int*>(prop_ptr));
-            } else if (member_->type_index == typeid(float)) {
-                return static_cast<T>(*static_cast<float*>(prop_ptr));
-            } else if (member_->type_index == typeid(double)) {
-                return static_cast<T>(*static_cast<double*>(prop_ptr));
+        // Arithmetic/enum conversion via the conversion matrix
+        if constexpr (detail::arithmetic_kind_v<T> != detail::ArithmeticKind::None) {
+            if (member_->arithmetic_kind != detail::ArithmeticKind::None) {
+                return detail::convert_arithmetic_to<T>(member_->arithmetic_kind, prop_ptr);
             }
         }
         return T{};
     }
+    
+    /**
+     * @brief Read this property from count objects stride bytes apart
+     * 
+     * The type check and conversion choice happen once for the whole
+     * batch; the loop itself is a plain strided copy. Arithmetic and enum
+     * output types convert from any arithmetic/enum member through the
+     * conversion matrix, like get_value_direct().
+     * 
+     * @param first Pointer to the first object
+     * @param stride Distance between objects in bytes (sizeof for arrays)
+     * @param count Number of objects
+     * @param out Output values, one per object
+     * @throws ReflectionError if the member type can't convert to T
+     */
+    template<typename T>
+    void gather(const void* first, std::size_t stride, std::size_t count, T* out) const {
+        if (!member_ || count == 0) [[unlikely]] return;
+        const char* field = static_cast<const char*>(first) + member_->offset;
+        
+        if (member_->type_index == typeid(T)) [[likely]] {
+            detail::strided_gather<T>(field, stride, count, out);
+            return;
+        }
+        
+        if constexpr (detail::arithmetic_kind_v<T> != detail::ArithmeticKind::None) {
+            const detail::ArithmeticKind kind = member_->arithmetic_kind;
+            if (kind != detail::ArithmeticKind::None) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = detail::convert_arithmetic_to<T>(kind, field + i * stride);
+                }
+                return;
+            }
+        }
+        
+        throw ReflectionError("Type mismatch in DynamicProperty::gather");
+    }
+    
+    /**
+     * @brief Write this property into count objects stride bytes apart
+     * 
+     * @param first Pointer to the first object
+     * @param stride Distance between objects in bytes
+     * @param count Number of objects
+     * @param in Input values, one per object
+     * @throws ReflectionError if T can't convert to the member type
+     */
+    template<typename T>
+    void scatter(void* first, std::size_t stride, std::size_t count, const T* in) const {
+        if (!member_ || count == 0) [[unlikely]] return;
+        char* field = static_cast<char*>(first) + member_->offset;
+        
+        if (member_->type_index == typeid(T)) [[likely]] {
+            detail::strided_scatter<T>(field, stride, count, in);
+            return;
+        }
+        
+        if constexpr (detail::arithmetic_kind_v<T> != detail::ArithmeticKind::None) {
+            const detail::ArithmeticKind kind = member_->arithmetic_kind;
+            if (kind != detail::ArithmeticKind::None) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    const detail::arithmetic_repr_t<T> repr = static_cast<detail::arithmetic_repr_t<T>>(in[i]);
+                    detail::convert_arithmetic(detail::arithmetic_kind_v<T>, &repr, kind, field + i * stride);
+                }
+                return;
+            }
+        }
+        
+        throw ReflectionError("Type mismatch in DynamicProperty::scatter");
+    }
+    
+    /**
+     * @brief Read this property from an array of objects of the owning type
+     * 
+     * Uses the registered type size as stride.
+     */
+    template<typename T>
+    void gather(const void* first, std::span<T> out) const {
+        if (!type_info_) [[unlikely]] return;
+        gather(first, type_info_->size, out.size(), out.data());
+    }
+    
+    /**
+     * @brief Write this property into an array of objects of the owning type
+     */
+    template<typename T>
+    void scatter(void* first, std::span<const T> in) const {
+        if (!type_info_) [[unlikely]] return;
+        scatter(first, type_info_->size, in.size(), in.data());
+    }
 
 private:
     const detail::MemberInfo* member_ = nullptr;
@@ -144,6 +234,21 @@ public:
      * @brief Invoke method on object pointer
      */
     [[nodiscard]] Variant invoke(void* obj, std::span<const Variant> args = {}) const;
+    
+    /**
+     * @brief Whether the method returns an awaitable or future
+     */
+    [[nodiscard]] bool is_async() const noexcept {
+        return method_ && method_->is_async();
+    }
+    
+    /**
+     * @brief Start the method and return an awaitable for its result
+     * 
+     * Synchronous methods run inline and return a completed result.
+     * Exceptions from the call are rethrown when the result is awaited.
+     */
+    [[nodiscard]] AsyncResult invoke_async(void* obj, std::span<const Variant> args = {}) const;
 
 private:
     const detail::MethodInfo* method_ = nullptr;
@@ -172,6 +277,10 @@ private:
  * Variant result = inst.invoke("getInt");
  * inst.invoke("setInt", {Variant::create(100)});
  * 
+ * // Ordinal access (resolve names once, then index)
+ * std::uint32_t prop = inst.type_info()->member_ordinal("intValue");
+ * Variant same = inst.get_property(prop);
+ * 
  * // Get raw pointer for interop
  * void* ptr = inst.get_raw();
  * @endcode
@@ -186,6 +295,35 @@ public:
      */
     [[nodiscard]] static Instance create(std::string_view type_name);
     
+    /**
+     * @brief Create instance in a caller-supplied memory resource
+     * 
+     * The object is default-constructed in storage allocated from the
+     * resource; no shared_ptr or control block is involved. The Instance
+     * owns the object and, on destruction, runs TypeInfo's destructor and
+     * returns the storage to the resource. With a bump arena such as
+     * std::pmr::monotonic_buffer_resource the deallocation is a no-op.
+     * 
+     * The resource must outlive the Instance.
+     * 
+     * @code
+     * std::byte buffer[4096];
+     * std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer)};
+     * auto inst = Instance::create_in("MyClass", arena);
+     * @endcode
+     */
+    [[nodiscard]] static Instance create_in(std::string_view type_name, std::pmr::memory_resource& arena);
+    [[nodiscard]] static Instance create_in(const detail::TypeInfo* type_info, std::pmr::memory_resource& arena);
+    
+    /**
+     * @brief Create count default-constructed objects contiguously in a memory resource
+     * 
+     * One allocation for the whole array; objects are laid out with
+     * TypeInfo::size stride, like a C array of the type.
+     */
+    [[nodiscard]] static InstanceArray create_n(std::string_view type_name, std::pmr::memory_resource& arena, std::size_t count);
+    [[nodiscard]] static InstanceArray create_n(const detail::TypeInfo* type_info, std::pmr::memory_resource& arena, std::size_t count);
+    
     /**
      * @brief Create instance from existing object (takes ownership)
      */
@@ -214,8 +352,26 @@ public:
     // Move only (no copy to avoid ownership issues)
     Instance(const Instance&) = delete;
     Instance& operator=(const Instance&) = delete;
-    Instance(Instance&&) noexcept = default;
-    Instance& operator=(Instance&&) noexcept = default;
+    Instance(Instance&& other) noexcept
+        : owned_obj_(std::move(other.owned_obj_))
+        , ref_obj_(std::exchange(other.ref_obj_, nullptr))
+        , type_info_(std::exchange(other.type_info_, nullptr))
+        , arena_(std::exchange(other.arena_, nullptr)) {}
+    
+    Instance& operator=(Instance&& other) noexcept {
+        if (this != &other) {
+            release_arena();
+            owned_obj_ = std::move(other.owned_obj_);
+            ref_obj_ = std::exchange(other.ref_obj_, nullptr);
+            type_info_ = std::exchange(other.type_info_, nullptr);
+            arena_ = std::exchange(other.arena_, nullptr);
+        }
+        return *this;
+    }
+    
+    ~Instance() {
+        release_arena();
+    }
     
     /**
      * @brief Check if instance is valid
@@ -264,7 +420,14 @@ public:
      * @brief Check if instance owns the object
      */
     [[nodiscard]] bool is_owned() const noexcept {
-        return owned_obj_ != nullptr;
+        return owned_obj_ != nullptr || arena_ != nullptr;
+    }
+    
+    /**
+     * @brief Check if the object lives in a memory resource (create_in)
+     */
+    [[nodiscard]] bool is_arena_owned() const noexcept {
+        return arena_ != nullptr;
     }
     
     // ========================================================================
@@ -277,12 +440,37 @@ public:
      * This is the pure dynamic API - no template parameters needed.
      * The returned Variant contains the property value.
      */
-    [[nodiscard]] Variant get_property(std::string_view name) const;
+    [[nodiscard]] Variant get_property(std::string_view name) const {
+        return get_property(Name{name});
+    }
+    
+    /**
+     * @brief Get property value as Variant by pre-hashed name
+     */
+    [[nodiscard]] Variant get_property(Name name) const;
+    
+    /**
+     * @brief Get property value as Variant by member ordinal (no hashing)
+     * @see detail::TypeInfo::member_ordinal
+     */
+    [[nodiscard]] Variant get_property(std::size_t ordinal) const;
     
     /**
      * @brief Set property value from Variant
      */
-    void set_property(std::string_view name, const Variant& value);
+    void set_property(std::string_view name, const Variant& value) {
+        set_property(Name{name}, value);
+    }
+    
+    /**
+     * @brief Set property value from Variant by pre-hashed name
+     */
+    void set_property(Name name, const Variant& value);
+    
+    /**
+     * @brief Set property value from Variant by member ordinal (no hashing)
+     */
+    void set_property(std::size_t ordinal, const Variant& value);
     
     /**
      * @brief Set property value from any type (like RTTR's set_value)
@@ -295,6 +483,17 @@ public:
     __attribute__((always_inline))
 #endif
     inline void set_property(std::string_view name, T value) {
+        set_property<T>(Name{name}, value);
+    }
+    
+    /**
+     * @brief Set property value from any type by pre-hashed name
+     */
+    template<typename T>
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((always_inline))
+#endif
+    inline void set_property(Name name, T value) {
         const detail::MemberInfo* member = type_info_->find_member(name);
         if (!member) [[unlikely]] {
             if (!is_valid()) {
@@ -309,16 +508,17 @@ public:
         // Direct write for matching types
         if (ti == typeid(T)) [[likely]] {
             *static_cast<T*>(prop_ptr) = value;
+            detail::mark_dirty(*member, get_raw());
             return;
         }
         
-        // Handle numeric conversions
-        if constexpr (std::is_arithmetic_v<T>) {
-            if (ti == typeid(int)) { *static_cast<int*>(prop_ptr) = static_cast<int>(value); return; }
-            if (ti == typeid(float)) { *static_cast<float*>(prop_ptr) = static_cast<float>(value); return; }
-            if (ti == typeid(double)) { *static_cast<double*>(prop_ptr) = static_cast<double>(value); return; }
-            if (ti == typeid(long)) { *static_cast<long*>(prop_ptr) = static_cast<long>(value); return; }
-            if (ti == typeid(bool)) { *static_cast<bool*>(prop_ptr) = static_cast<bool>(value); return; }
+        // Arithmetic/enum conversion via the conversion matrix
+        if constexpr (detail::arithmetic_kind_v<T> != detail::ArithmeticKind::None) {
+            const detail::arithmetic_repr_t<T> repr = static_cast<detail::arithmetic_repr_t<T>>(value);
+            if (detail::convert_arithmetic(detail::arithmetic_kind_v<T>, &repr, member->arithmetic_kind, prop_ptr)) {
+                detail::mark_dirty(*member, get_raw());
+                return;
+            }
         }
         
         throw ReflectionError("Type mismatch in set_property");
@@ -330,13 +530,30 @@ public:
      * This is the optimized API for setting primitive types directly.
      */
     template<typename T>
-    void set_property_direct(std::string_view name, T value);
+    void set_property_direct(std::string_view name, T value) {
+        set_property_direct<T>(Name{name}, value);
+    }
+    
+    /**
+     * @brief Set property value directly by pre-hashed name
+     */
+    template<typename T>
+    void set_property_direct(Name name, T value);
     
     /**
      * @brief Get property as specific type (convenience)
      */
     template<typename T>
     [[nodiscard]] T get_property_as(std::string_view name) const {
+        Variant v = get_property(Name{name});
+        return v.get<T>();
+    }
+    
+    /**
+     * @brief Get property as specific type by pre-hashed name
+     */
+    template<typename T>
+    [[nodiscard]] T get_property_as(Name name) const {
         Variant v = get_property(name);
         return v.get<T>();
     }
@@ -349,6 +566,17 @@ public:
     __attribute__((always_inline))
 #endif
     inline void set_property_value(std::string_view name, T value) {
+        set_property_direct(Name{name}, value);
+    }
+    
+    /**
+     * @brief Set property from value by pre-hashed name
+     */
+    template<typename T>
+#if defined(__GNUC__) || defined(__clang__)
+    __attribute__((always_inline))
+#endif
+    inline void set_property_value(Name name, T value) {
         set_property_direct(name, value);
     }
     
@@ -356,7 +584,15 @@ public:
      * @brief Get property value directly as type (fast path)
      */
     template<typename T>
-    [[nodiscard]] T get_property_value(std::string_view name) const;
+    [[nodiscard]] T get_property_value(std::string_view name) const {
+        return get_property_value<T>(Name{name});
+    }
+    
+    /**
+     * @brief Get property value directly as type by pre-hashed name
+     */
+    template<typename T>
+    [[nodiscard]] T get_property_value(Name name) const;
     
     /**
      * @brief Check if property exists
@@ -365,6 +601,13 @@ public:
         return type_info_ && type_info_->has_member(name);
     }
     
+    /**
+     * @brief Check if property exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_property(Name name) const noexcept {
+        return type_info_ && type_info_->has_member(name);
+    }
+    
     /**
      * @brief Get all property names
      */
@@ -377,11 +620,42 @@ public:
      * @brief Get cached property handle for fast repeated access
      */
     [[nodiscard]] DynamicProperty get_property_handle(std::string_view name) const {
+        return get_property_handle(Name{name});
+    }
+    
+    /**
+     * @brief Get cached property handle by pre-hashed name
+     */
+    [[nodiscard]] DynamicProperty get_property_handle(Name name) const {
         if (!type_info_) return DynamicProperty{};
         const detail::MemberInfo* member = type_info_->find_member(name);
         return DynamicProperty{member, type_info_};
     }
     
+    /**
+     * @brief Allocation-free view of a container property
+     * 
+     * @throws PropertyNotFoundError if property doesn't exist
+     * @throws PropertyTypeMismatchError if the property is not a container
+     */
+    [[nodiscard]] ContainerView container(Name name) const {
+        if (!is_valid()) [[unlikely]] {
+            throw ObjectNotCreatedError(type_name().empty() ? "unknown" : std::string(type_name()));
+        }
+        const detail::MemberInfo* member = type_info_->find_member(name);
+        if (!member) [[unlikely]] {
+            throw PropertyNotFoundError(std::string(type_name()), name, type_info_->member_names());
+        }
+        if (!member->container_ops) [[unlikely]] {
+            throw PropertyTypeMismatchError(name, "container", member->type_name);
+        }
+        return ContainerView{static_cast<char*>(const_cast<void*>(get_raw())) + member->offset, member->container_ops};
+    }
+    
+    [[nodiscard]] ContainerView container(std::string_view name) const {
+        return container(Name{name});
+    }
+    
     // ========================================================================
     // Pure Dynamic Method Invocation (no templates needed)
     // ========================================================================
@@ -391,7 +665,20 @@ public:
      * 
      * This is the pure dynamic API - no template parameters needed.
      */
-    [[nodiscard]] Variant invoke(std::string_view name, std::span<const Variant> args = {}) const;
+    [[nodiscard]] Variant invoke(std::string_view name, std::span<const Variant> args = {}) const {
+        return invoke(Name{name}, args);
+    }
+    
+    /**
+     * @brief Invoke method with Variant arguments by pre-hashed name
+     */
+    [[nodiscard]] Variant invoke(Name name, std::span<const Variant> args = {}) const;
+    
+    /**
+     * @brief Invoke method with Variant arguments by method ordinal (no hashing)
+     * @see detail::TypeInfo::method_ordinal
+     */
+    [[nodiscard]] Variant invoke(std::size_t ordinal, std::span<const Variant> args = {}) const;
     
     /**
      * @brief Invoke method with raw arguments (like RTTR's invoke)
@@ -400,6 +687,14 @@ public:
      */
     template<typename... Args>
     [[nodiscard]] Variant invoke(std::string_view name, Args&&... args) const {
+        return invoke(Name{name}, std::forward<Args>(args)...);
+    }
+    
+    /**
+     * @brief Invoke method with raw arguments by pre-hashed name
+     */
+    template<typename... Args>
+    [[nodiscard]] Variant invoke(Name name, Args&&... args) const {
         if constexpr (sizeof...(Args) == 0) {
             return invoke(name, std::span<const Variant>{});
         } else {
@@ -408,13 +703,73 @@ public:
         }
     }
     
+    /**
+     * @brief Invoke method with raw arguments by method ordinal
+     */
+    template<typename... Args>
+    [[nodiscard]] Variant invoke(std::size_t ordinal, Args&&... args) const {
+        if constexpr (sizeof...(Args) == 0) {
+            return invoke(ordinal, std::span<const Variant>{});
+        } else {
+            std::array<Variant, sizeof...(Args)> var_args = {Variant::create(std::forward<Args>(args))...};
+            return invoke(ordinal, std::span<const Variant>{var_args});
+        }
+    }
+    
+    /**
+     * @brief Invoke method without blocking on its awaitable result
+     * 
+     * Methods returning an awaitable or std::future are started through
+     * their async invoker; co_await on the result suspends until they
+     * complete. Synchronous methods run inline and return a completed
+     * result. Lookup errors throw immediately, errors of the call itself
+     * are rethrown by co_await.
+     */
+    [[nodiscard]] AsyncResult invoke_async(std::string_view name, std::span<const Variant> args = {}) const {
+        return invoke_async(Name{name}, args);
+    }
+    
+    /**
+     * @brief Invoke method without blocking, by pre-hashed name
+     */
+    [[nodiscard]] AsyncResult invoke_async(Name name, std::span<const Variant> args = {}) const;
+    
+    /**
+     * @brief Invoke method without blocking, with raw arguments
+     */
+    template<typename... Args>
+    [[nodiscard]] AsyncResult invoke_async(std::string_view name, Args&&... args) const {
+        return invoke_async(Name{name}, std::forward<Args>(args)...);
+    }
+    
+    /**
+     * @brief Invoke method without blocking, with raw arguments by pre-hashed name
+     */
+    template<typename... Args>
+    [[nodiscard]] AsyncResult invoke_async(Name name, Args&&... args) const {
+        if constexpr (sizeof...(Args) == 0) {
+            return invoke_async(name, std::span<const Variant>{});
+        } else {
+            std::array<Variant, sizeof...(Args)> var_args = {Variant::create(std::forward<Args>(args))...};
+            return invoke_async(name, std::span<const Variant>{var_args});
+        }
+    }
+    
     /**
      * @brief Invoke method with typed arguments (convenience)
      */
     template<typename R, typename... Args>
     [[nodiscard]] R invoke_as(std::string_view name, Args&&... args) const {
+        return invoke_as<R>(Name{name}, std::forward<Args>(args)...);
+    }
+    
+    /**
+     * @brief Invoke method with typed arguments by pre-hashed name
+     */
+    template<typename R, typename... Args>
+    [[nodiscard]] R invoke_as(Name name, Args&&... args) const {
         std::array<Variant, sizeof...(Args)> var_args = {Variant::create(std::forward<Args>(args))...};
-        Variant result = invoke(name, var_args);
+        Variant result = invoke(name, std::span<const Variant>{var_args});
         if constexpr (std::is_void_v<R>) {
             return;
         } else {
@@ -429,6 +784,13 @@ public:
         return type_info_ && type_info_->has_method(name);
     }
     
+    /**
+     * @brief Check if method exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_method(Name name) const noexcept {
+        return type_info_ && type_info_->has_method(name);
+    }
+    
     /**
      * @brief Get all method names
      */
@@ -441,6 +803,13 @@ public:
      * @brief Get cached method handle for fast repeated access
      */
     [[nodiscard]] DynamicMethod get_method_handle(std::string_view name, std::size_t arg_count = 0) const {
+        return get_method_handle(Name{name}, arg_count);
+    }
+    
+    /**
+     * @brief Get cached method handle by pre-hashed name
+     */
+    [[nodiscard]] DynamicMethod get_method_handle(Name name, std::size_t arg_count = 0) const {
         if (!type_info_) return DynamicMethod{};
         const auto* method_list = type_info_->find_methods(name);
         if (!method_list || method_list->empty()) return DynamicMethod{};
@@ -454,6 +823,38 @@ public:
         return DynamicMethod{&(*method_list)[0], type_info_};
     }
     
+    /**
+     * @brief Resolve a call site for arguments shaped like sample_args
+     * 
+     * @see CallSite::resolve
+     */
+    [[nodiscard]] CallSite get_call_site(Name name, std::span<const Variant> sample_args) const {
+        if (!type_info_) [[unlikely]] {
+            throw ObjectNotCreatedError("unknown");
+        }
+        return CallSite::resolve(*type_info_, name, sample_args);
+    }
+    
+    [[nodiscard]] CallSite get_call_site(std::string_view name, std::span<const Variant> sample_args) const {
+        return get_call_site(Name{name}, sample_args);
+    }
+    
+    /**
+     * @brief Resolve a call site for compile-time argument types
+     */
+    template<typename... Args>
+    [[nodiscard]] CallSite get_call_site(Name name) const {
+        if (!type_info_) [[unlikely]] {
+            throw ObjectNotCreatedError("unknown");
+        }
+        return CallSite::resolve<Args...>(*type_info_, name);
+    }
+    
+    template<typename... Args>
+    [[nodiscard]] CallSite get_call_site(std::string_view name) const {
+        return get_call_site<Args...>(Name{name});
+    }
+    
     // ========================================================================
     // Type Casting
     // ========================================================================
@@ -496,6 +897,25 @@ private:
     Instance(std::shared_ptr<void> owned, void* ref, const detail::TypeInfo* info)
         : owned_obj_(std::move(owned)), ref_obj_(ref), type_info_(info) {}
     
+    // Destroy and deallocate an arena-owned object
+    void release_arena() noexcept {
+        if (arena_ && ref_obj_) {
+            type_info_->destroy_at(ref_obj_);
+            arena_->deallocate(ref_obj_, type_info_->size, type_info_->alignment);
+        }
+        arena_ = nullptr;
+    }
+    
+    // Overload of name taking nargs arguments; throws if there is none
+    const detail::MethodInfo& resolve_method(Name name, std::size_t nargs) const;
+    const detail::MethodInfo& resolve_method(std::size_t ordinal, std::size_t nargs) const;
+    
+    // Member by ordinal; throws if the instance is empty or there is none
+    const detail::MemberInfo& resolve_member(std::size_t ordinal) const;
+    
+    // Call a resolved overload with Variant arguments
+    Variant call_method(const detail::MethodInfo& method, std::span<const Variant> args) const;
+    
     // Helper functions for invoke optimization
     static std::any variant_to_any(const Variant& v);
     static Variant convert_result(const std::any& result, std::type_index return_type);
@@ -505,8 +925,112 @@ private:
     void set_property_direct_impl(const detail::MemberInfo* member, T value);
     
     std::shared_ptr<void> owned_obj_;  // Owned object (if any)
-    void* ref_obj_ = nullptr;           // Referenced object (if not owned)
+    void* ref_obj_ = nullptr;           // Referenced or arena-owned object
     const detail::TypeInfo* type_info_ = nullptr;
+    std::pmr::memory_resource* arena_ = nullptr;  // Owning resource for create_in
+};
+
+/**
+ * @brief Contiguous array of reflected objects in a memory resource
+ * 
+ * Returned by Instance::create_n. Owns the objects: destroys them in
+ * reverse order and releases the single allocation on destruction.
+ * Elements are accessed as non-owning Instances or raw pointers.
+ */
+class InstanceArray {
+public:
+    InstanceArray() noexcept = default;
+    
+    InstanceArray(const InstanceArray&) = delete;
+    InstanceArray& operator=(const InstanceArray&) = delete;
+    
+    InstanceArray(InstanceArray&& other) noexcept
+        : arena_(std::exchange(other.arena_, nullptr))
+        , type_info_(std::exchange(other.type_info_, nullptr))
+        , data_(std::exchange(other.data_, nullptr))
+        , count_(std::exchange(other.count_, 0)) {}
+    
+    InstanceArray& operator=(InstanceArray&& other) noexcept {
+        if (this != &other) {
+            release();
+            arena_ = std::exchange(other.arena_, nullptr);
+            type_info_ = std::exchange(other.type_info_, nullptr);
+            data_ = std::exchange(other.data_, nullptr);
+            count_ = std::exchange(other.count_, 0);
+        }
+        return *this;
+    }
+    
+    ~InstanceArray() {
+        release();
+    }
+    
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+    
+    /**
+     * @brief Distance in bytes between consecutive elements
+     */
+    [[nodiscard]] std::size_t stride() const noexcept {
+        return type_info_ ? type_info_->size : 0;
+    }
+    
+    [[nodiscard]] const detail::TypeInfo* type_info() const noexcept { return type_info_; }
+    
+    /**
+     * @brief Pointer to the first element (usable with PropertyHandle::gather)
+     */
+    [[nodiscard]] void* data() noexcept { return data_; }
+    [[nodiscard]] const void* data() const noexcept { return data_; }
+    
+    /**
+     * @brief Raw pointer to element i (unchecked)
+     */
+    [[nodiscard]] void* get_raw(std::size_t i) noexcept {
+        return static_cast<char*>(data_) + i * type_info_->size;
+    }
+    
+    [[nodiscard]] const void* get_raw(std::size_t i) const noexcept {
+        return static_cast<const char*>(data_) + i * type_info_->size;
+    }
+    
+    /**
+     * @brief Non-owning Instance view of element i (unchecked)
+     */
+    [[nodiscard]] Instance operator[](std::size_t i) noexcept {
+        return Instance::from_ref(get_raw(i), type_info_);
+    }
+    
+    /**
+     * @brief Non-owning Instance view of element i
+     * @throws std::out_of_range if i >= size()
+     */
+    [[nodiscard]] Instance at(std::size_t i) {
+        if (i >= count_) [[unlikely]] {
+            throw std::out_of_range("InstanceArray index out of range");
+        }
+        return (*this)[i];
+    }
+
+private:
+    friend class Instance;
+    
+    InstanceArray(std::pmr::memory_resource* arena, const detail::TypeInfo* info, void* data, std::size_t count) noexcept
+        : arena_(arena), type_info_(info), data_(data), count_(count) {}
+    
+    void release() noexcept {
+        if (data_) {
+            type_info_->destroy_n(data_, count_);
+            arena_->deallocate(data_, count_ * type_info_->size, type_info_->alignment);
+        }
+        data_ = nullptr;
+        count_ = 0;
+    }
+    
+    std::pmr::memory_resource* arena_ = nullptr;
+    const detail::TypeInfo* type_info_ = nullptr;
+    void* data_ = nullptr;
+    std::size_t count_ = 0;
 };
 
 // Template implementation for set_property_direct
@@ -514,7 +1038,7 @@ template<typename T>
 #if defined(__GNUC__) || defined(__clang__)
 __attribute__((always_inline))
 #endif
-inline void Instance::set_property_direct(std::string_view name, T value) {
+inline void Instance::set_property_direct(Name name, T value) {
     const detail::MemberInfo* member = type_info_->find_member(name);
     if (!member) [[unlikely]] {
         if (!is_valid()) {
@@ -528,16 +1052,17 @@ inline void Instance::set_property_direct(std::string_view name, T value) {
     // Type check for safety
     if (member->type_index == typeid(T)) [[likely]] {
         *static_cast<T*>(prop_ptr) = value;
+        detail::mark_dirty(*member, get_raw());
         return;
     }
     
-    // Handle numeric conversions
-    if constexpr (std::is_arithmetic_v<T>) {
-        auto ti = member->type_index;
-        if (ti == typeid(int)) { *static_cast<int*>(prop_ptr) = static_cast<int>(value); return; }
-        if (ti == typeid(float)) { *static_cast<float*>(prop_ptr) = static_cast<float>(value); return; }
-        if (ti == typeid(double)) { *static_cast<double*>(prop_ptr) = static_cast<double>(value); return; }
-        if (ti == typeid(long)) { *static_cast<long*>(prop_ptr) = static_cast<long>(value); return; }
+    // Arithmetic/enum conversion via the conversion matrix
+    if constexpr (detail::arithmetic_kind_v<T> != detail::ArithmeticKind::None) {
+        const detail::arithmetic_repr_t<T> repr = static_cast<detail::arithmetic_repr_t<T>>(value);
+        if (detail::convert_arithmetic(detail::arithmetic_kind_v<T>, &repr, member->arithmetic_kind, prop_ptr)) {
+            detail::mark_dirty(*member, get_raw());
+            return;
+        }
     }
     
     throw ReflectionError("Type mismatch in set_property_direct");
@@ -548,7 +1073,7 @@ template<typename T>
 #if defined(__GNUC__) || defined(__clang__)
 __attribute__((always_inline))
 #endif
-inline T Instance::get_property_value(std::string_view name) const {
+inline T Instance::get_property_value(Name name) const {
     const detail::MemberInfo* member = type_info_->find_member(name);
     if (!member) [[unlikely]] {
         if (!is_valid()) {
@@ -564,13 +1089,11 @@ inline T Instance::get_property_value(std::string_view name) const {
         return *static_cast<T*>(prop_ptr);
     }
     
-    // Handle numeric conversions
-    if constexpr (std::is_arithmetic_v<T>) {
-        auto ti = member->type_index;
-        if (ti == typeid(int)) return static_cast<T>(*static_cast<int*>(prop_ptr));
-        if (ti == typeid(float)) return static_cast<T>(*static_cast<float*>(prop_ptr));
-        if (ti == typeid(double)) return static_cast<T>(*static_cast<double*>(prop_ptr));
-        if (ti == typeid(long)) return static_cast<T>(*static_cast<long*>(prop_ptr));
+    // Arithmetic/enum conversion via the conversion matrix
+    if constexpr (detail::arithmetic_kind_v<T> != detail::ArithmeticKind::None) {
+        if (member->arithmetic_kind != detail::ArithmeticKind::None) {
+            return detail::convert_arithmetic_to<T>(member->arithmetic_kind, prop_ptr);
+        }
     }
     
     throw ReflectionError("Type mismatch in get_property_value");
@@ -0,0 +1,82 @@
+/**
+ * @file JsonSerializer.hpp
+ * @brief Streaming JSON writer and reader driven by TypeInfo
+ *
+ * The text counterpart of Serializer.hpp. Each registered type is compiled
+ * once into a JSON plan: members in offset order, each with its key
+ * already quoted and escaped ("name":), and containers walked through
+ * their ContainerOps. Nothing builds a DOM:
+ * - the writer appends straight into a growable std::string
+ * - the reader parses in one pass and stores into the object as it goes
+ *
+ * Mapping:
+ * - bool: true/false; other arithmetic types and enums: numbers
+ *   (non-finite floats are written as null)
+ * - std::string: string
+ * - registered class: object of its members
+ * - sequential containers and sets: array
+ * - maps with string or arithmetic keys: object (numeric keys quoted)
+ *
+ * Reading matches keys by hash against the member table and expects them
+ * in member order first, so input produced by the writer needs no table
+ * lookup at all. Unknown keys are skipped, absent members and null values
+ * leave the member untouched, containers are cleared and refilled.
+ *
+ * Usage:
+ * @code
+ * std::string text = rttm::to_json(player);
+ *
+ * Player copy;
+ * rttm::from_json(copy, text);
+ * @endcode
+ */
+
+#ifndef RTTM_DETAIL_JSON_SERIALIZER_HPP
+#define RTTM_DETAIL_JSON_SERIALIZER_HPP
+
+#include "TypeInfo.hpp"
+#include "Serializer.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace rttm {
+
+/**
+ * @brief Serialize an object as compact JSON
+ * @throws SerializationError if a member has no JSON mapping
+ */
+[[nodiscard]] std::string to_json(const void* obj, const detail::TypeInfo& type);
+
+/**
+ * @brief Serialize an object as compact JSON, appending to out
+ */
+void to_json_append(const void* obj, const detail::TypeInfo& type, std::string& out);
+
+/**
+ * @brief Read a JSON object into an existing object
+ *
+ * @return Number of characters consumed (trailing whitespace included)
+ * @throws SerializationError on malformed input or mismatched value types
+ */
+std::size_t from_json(void* obj, const detail::TypeInfo& type, std::string_view in);
+
+template<typename T>
+[[nodiscard]] std::string to_json(const T& obj) {
+    return to_json(static_cast<const void*>(&obj), detail::require_type_info<T>());
+}
+
+template<typename T>
+void to_json_append(const T& obj, std::string& out) {
+    to_json_append(static_cast<const void*>(&obj), detail::require_type_info<T>(), out);
+}
+
+template<typename T>
+std::size_t from_json(T& obj, std::string_view in) {
+    return from_json(static_cast<void*>(&obj), detail::require_type_info<T>(), in);
+}
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_JSON_SERIALIZER_HPP
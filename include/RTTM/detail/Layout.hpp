@@ -0,0 +1,107 @@
+/**
+ * @file Layout.hpp
+ * @brief Field layout, padding and cache-line analysis of registered types
+ *
+ * analyze_layout() walks a TypeInfo's members by offset and reports:
+ * - gaps between members and at the tail (padding, or unreflected members)
+ * - members that straddle a cache line in a line-aligned object, and in how
+ *   many elements of an array (ReflectedArray, InstanceArray) they do
+ * - synchronization members (atomics, mutexes) sharing a line with other
+ *   members, and objects that share lines with their array neighbours
+ * - a member order that minimizes padding, with the resulting size
+ *
+ * @code
+ * const auto* info = rttm::detail::TypeManager::instance().get_type("Particle");
+ * rttm::write_layout_report(std::cout, rttm::analyze_layout(*info));
+ * @endcode
+ *
+ * The rttm_layout tool prints this report for every registered type.
+ */
+
+#ifndef RTTM_DETAIL_LAYOUT_HPP
+#define RTTM_DETAIL_LAYOUT_HPP
+
+#include "TypeInfo.hpp"
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace rttm {
+
+/**
+ * @brief Cache line size assumed by the layout analysis
+ */
+inline constexpr std::size_t default_cache_line = 64;
+
+/**
+ * @brief Placement of one member within its type
+ */
+struct MemberLayout {
+    const detail::MemberInfo* member = nullptr;
+    std::size_t gap_before = 0;         ///< Unused bytes between the previous member and this one
+    std::size_t first_line = 0;         ///< First cache line touched (object at a line boundary)
+    std::size_t last_line = 0;          ///< Last cache line touched
+    bool straddles_line = false;        ///< Touches more lines than its size requires
+    std::size_t array_splits = 0;       ///< Elements of TypeLayout::array_period that split this member
+    bool inherited = false;             ///< Lives in a base class subobject
+    bool synchronization = false;       ///< Atomic or mutex member
+    bool false_sharing_risk = false;    ///< Synchronization member sharing a line with another member
+};
+
+/**
+ * @brief Layout report of one type
+ *
+ * Gaps are computed from reflected members only. Gap bytes that member
+ * alignment does not explain (unexplained_gap) hold unreflected members
+ * or come from alignas; the rest is padding.
+ */
+struct TypeLayout {
+    const detail::TypeInfo* type = nullptr;
+    std::size_t cache_line = default_cache_line;
+    std::vector<MemberLayout> members;          ///< Ascending offset
+    std::size_t reflected_bytes = 0;            ///< Sum of reflected member sizes
+    std::size_t interior_gap = 0;               ///< Gaps between members
+    std::size_t tail_gap = 0;                   ///< Gap after the last member
+    std::size_t unexplained_gap = 0;            ///< Gap bytes beyond alignment padding (unreflected data, alignas)
+    std::size_t lines = 0;                      ///< Cache lines of one line-aligned object
+    std::size_t array_period = 1;               ///< Elements after which array line offsets repeat
+    bool shares_lines_in_arrays = false;        ///< Adjacent array elements share a cache line
+
+    std::vector<const detail::MemberInfo*> suggested_order;  ///< Own members, padding-minimizing order
+    std::size_t suggested_size = 0;             ///< sizeof with suggested_order (reflected members only)
+
+    /**
+     * @brief Bytes not covered by reflected members
+     */
+    [[nodiscard]] std::size_t gap_bytes() const noexcept {
+        return interior_gap + tail_gap;
+    }
+
+    /**
+     * @brief Bytes the suggested order saves (0 if none)
+     */
+    [[nodiscard]] std::size_t suggested_savings() const noexcept {
+        return type && suggested_size < type->size ? type->size - suggested_size : 0;
+    }
+
+    /**
+     * @brief Any member straddles a line or is at risk of false sharing
+     */
+    [[nodiscard]] bool has_line_issues() const noexcept;
+};
+
+/**
+ * @brief Analyze the member layout of a type
+ * @param cache_line Cache line size in bytes (power of two)
+ */
+[[nodiscard]] TypeLayout analyze_layout(const detail::TypeInfo& type, std::size_t cache_line = default_cache_line);
+
+/**
+ * @brief Write a human-readable report of layout
+ */
+void write_layout_report(std::ostream& os, const TypeLayout& layout);
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_LAYOUT_HPP
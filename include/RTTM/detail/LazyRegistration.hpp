@@ -0,0 +1,119 @@
+/**
+ * @file LazyRegistration.hpp
+ * @brief Registration deferred to first lookup, with optional parallel warm-up
+ *
+ * RTTM_LAZY_REGISTRATION(T) records a per-type thunk at static
+ * initialization instead of running the Registry<T> chain. The thunk runs
+ * on the type's first get_type()/get_type_by_id() miss, so a process only
+ * pays for the types it touches.
+ *
+ * warm_up() runs every remaining thunk ahead of time, either on the
+ * calling thread or spread over an executor:
+ * @code
+ * RTTM_LAZY_REGISTRATION(Player) {
+ *     rttm::Registry<Player>()
+ *         .property("hp", &Player::hp);
+ * }
+ *
+ * rttm::warm_up([&](std::function<void()> task) { pool.post(std::move(task)); });
+ * @endcode
+ */
+
+#ifndef RTTM_DETAIL_LAZY_REGISTRATION_HPP
+#define RTTM_DETAIL_LAZY_REGISTRATION_HPP
+
+#include "TypeManager.hpp"
+#include "TypeTraits.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <exception>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <typeindex>
+
+namespace rttm {
+
+namespace detail {
+
+/**
+ * @brief Record fn as the lazy registration of T
+ */
+template<typename T>
+bool register_lazy(LazyRegistrationFn fn) {
+    return TypeManager::instance().register_lazy(type_name<T>(), type_id<T>, std::type_index(typeid(T)), fn);
+}
+
+} // namespace detail
+
+/**
+ * @brief Run every pending lazy registration on the calling thread
+ */
+inline void warm_up() {
+    auto& mgr = detail::TypeManager::instance();
+    while (mgr.run_next_lazy()) {}
+}
+
+/**
+ * @brief Run pending lazy registrations in parallel on an executor
+ * 
+ * Submits `workers` draining tasks through submit(std::function<void()>)
+ * and blocks until they finish. Registrations that depend on each other
+ * (base<Base>()) resolve on whichever worker needs them first. The first
+ * exception thrown by a registration is rethrown here; that registration
+ * stays pending and the next warm_up() or lookup of its type retries it.
+ * If submit() throws, the tasks already submitted are waited for before
+ * the exception propagates.
+ * 
+ * @param submit Callable enqueuing a task on some thread pool
+ * @param workers Number of draining tasks (defaults to hardware threads)
+ */
+template<typename Submit>
+requires std::invocable<Submit&, std::function<void()>>
+void warm_up(Submit&& submit, std::size_t workers = std::max(1u, std::thread::hardware_concurrency())) {
+    auto& mgr = detail::TypeManager::instance();
+    workers = std::max<std::size_t>(1, std::min(workers, mgr.pending_lazy_count()));
+    
+    std::latch done(static_cast<std::ptrdiff_t>(workers));
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    
+    for (std::size_t i = 0; i < workers; ++i) {
+        try {
+            submit(std::function<void()>([&] {
+                try {
+                    while (mgr.run_next_lazy()) {}
+                } catch (...) {
+                    std::lock_guard lock(error_mutex);
+                    if (!error) error = std::current_exception();
+                }
+                done.count_down();
+            }));
+        } catch (...) {
+            // Submitted tasks still reference done/error: wait for them first
+            done.count_down(static_cast<std::ptrdiff_t>(workers - i));
+            done.wait();
+            throw;
+        }
+    }
+    done.wait();
+    
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Run pending lazy registrations on `threads` temporary threads
+ */
+inline void warm_up(unsigned threads) {
+    std::vector<std::jthread> pool;
+    pool.reserve(threads);
+    warm_up([&](std::function<void()> task) { pool.emplace_back(std::move(task)); }, threads);
+}
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_LAZY_REGISTRATION_HPP
@@ -0,0 +1,89 @@
+/**
+ * @file ModuleRegistration.hpp
+ * @brief Per-module registration scopes for plugins that load and unload
+ *
+ * RTTM_MODULE_REGISTRATION publishes all of a shared object's types as one
+ * batch when it is loaded and unregisters exactly those types when it is
+ * unloaded (its static destructors run on dlclose/FreeLibrary):
+ * @code
+ * // plugin.cpp
+ * RTTM_MODULE_REGISTRATION {
+ *     rttm::Registry<Enemy>()
+ *         .property("hp", &Enemy::hp);
+ * }
+ * @endcode
+ *
+ * Unloading advances TypeManager::epoch(), so cached lookups re-resolve
+ * and serializer plans are rebuilt, and frees the metadata only after
+ * every thread that was inside an EpochGuard has left it. Hold an
+ * EpochGuard around code that may use a plugin's metadata while another
+ * thread can unload it:
+ * @code
+ * {
+ *     rttm::EpochGuard guard;
+ *     if (auto type = rttm::RTypeHandle::get("Enemy")) { ... }
+ * }
+ * @endcode
+ *
+ * Host and plugins must share one RTTM library (RTTM_BUILD_SHARED) or
+ * export its symbols with default visibility, so that they see the same
+ * TypeManager.
+ */
+
+#ifndef RTTM_DETAIL_MODULE_REGISTRATION_HPP
+#define RTTM_DETAIL_MODULE_REGISTRATION_HPP
+
+#include "TypeManager.hpp"
+
+namespace rttm {
+
+/**
+ * @brief Owns the types of one module from construction to destruction
+ */
+class ModuleRegistration {
+public:
+    /**
+     * @brief Run register_fn and publish its types as one batch
+     */
+    explicit ModuleRegistration(detail::ModuleRegistrationFn register_fn)
+        : id_(detail::TypeManager::instance().load_module(register_fn)) {}
+
+    /**
+     * @brief Unregister the module's types (waits for pinned readers)
+     */
+    ~ModuleRegistration() {
+        detail::TypeManager::instance().unload_module(id_);
+    }
+
+    ModuleRegistration(const ModuleRegistration&) = delete;
+    ModuleRegistration& operator=(const ModuleRegistration&) = delete;
+
+    [[nodiscard]] detail::ModuleId id() const noexcept { return id_; }
+
+private:
+    detail::ModuleId id_;
+};
+
+/**
+ * @brief Keeps metadata reachable by this thread alive across unloads
+ *
+ * Pinning is a store and a re-check of the epoch; it never blocks and
+ * guards nest. Keep guarded sections short: unload_module() waits for them.
+ */
+class EpochGuard {
+public:
+    EpochGuard() {
+        detail::TypeManager::instance().pin_reader();
+    }
+
+    ~EpochGuard() {
+        detail::TypeManager::instance().unpin_reader();
+    }
+
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_MODULE_REGISTRATION_HPP
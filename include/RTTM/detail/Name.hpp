@@ -0,0 +1,86 @@
+/**
+ * @file Name.hpp
+ * @brief Pre-hashed names for property/method lookup
+ *
+ * This file defines:
+ * - fnv1a_hash: the single name hash used by every RTTM lookup table
+ * - Name: a string_view paired with its hash
+ * - operator""_rn: literal producing a Name hashed at compile time
+ *
+ * Usage:
+ * @code
+ * using namespace rttm::literals;
+ *
+ * bound.get<int>("health"_rn);         // no hashing at runtime
+ * instance.invoke("update"_rn, 0.016f);
+ * @endcode
+ */
+
+#ifndef RTTM_DETAIL_NAME_HPP
+#define RTTM_DETAIL_NAME_HPP
+
+#include <string_view>
+#include <cstddef>
+
+namespace rttm {
+
+namespace detail {
+
+// FNV-1a hash for string_view (compile-time capable)
+constexpr std::size_t fnv1a_hash(std::string_view str) noexcept {
+    std::size_t hash = 14695981039346656037ULL;
+    for (char c : str) {
+        hash ^= static_cast<std::size_t>(static_cast<unsigned char>(c));
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // namespace detail
+
+/**
+ * @brief Property/method name with its pre-computed hash
+ *
+ * All lookup APIs accepting std::string_view also accept a Name. Names
+ * built from the _rn literal are hashed at compile time, so the lookup
+ * skips hashing entirely. The referenced characters must outlive the Name.
+ */
+class Name {
+public:
+    /**
+     * @brief Construct from a string (hashes the string)
+     */
+    constexpr explicit Name(std::string_view str) noexcept
+        : str_(str), hash_(detail::fnv1a_hash(str)) {}
+
+    [[nodiscard]] constexpr std::string_view str() const noexcept { return str_; }
+    [[nodiscard]] constexpr std::size_t hash() const noexcept { return hash_; }
+
+    /**
+     * @brief Implicit conversion for error messages and string APIs
+     */
+    constexpr operator std::string_view() const noexcept { return str_; }
+
+    friend constexpr bool operator==(const Name& lhs, const Name& rhs) noexcept {
+        return lhs.hash_ == rhs.hash_ && lhs.str_ == rhs.str_;
+    }
+
+private:
+    std::string_view str_;
+    std::size_t hash_;
+};
+
+inline namespace literals {
+
+/**
+ * @brief Name literal, hashed at compile time
+ */
+consteval Name operator""_rn(const char* str, std::size_t len) noexcept {
+    return Name{std::string_view{str, len}};
+}
+
+} // namespace literals
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_NAME_HPP
@@ -0,0 +1,271 @@
+/**
+ * @file PerfectHashTable.hpp
+ * @brief Sealed minimal perfect hash table for member/method lookup
+ *
+ * This file implements the contiguous lookup table that TypeInfo compiles
+ * its members and methods into once registration is finished:
+ * - Hash-and-displace construction (one displacement per bucket)
+ * - One slot per key (minimal), so every probe hits exactly one entry
+ * - Names interned in a single string arena for locality
+ */
+
+#ifndef RTTM_DETAIL_PERFECT_HASH_TABLE_HPP
+#define RTTM_DETAIL_PERFECT_HASH_TABLE_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+#include <cstddef>
+
+namespace rttm::detail {
+
+/**
+ * @brief Kind of entry stored in a PerfectHashTable
+ *
+ * Members and methods share one table; the kind is mixed into the key so
+ * a member and a method with the same name occupy different slots.
+ */
+enum class LookupKind : std::uint8_t {
+    Member = 0,
+    Method = 1
+};
+
+/**
+ * @brief Immutable minimal perfect hash table keyed by name hash
+ *
+ * Built once from a list of (name, hash, kind, target) tuples. A lookup is
+ * one bucket read, one slot read, a 64-bit key compare and a name compare.
+ * Targets are opaque pointers owned by the caller (TypeInfo).
+ *
+ * Copying yields an empty table: targets point into the owner's storage,
+ * so a copied owner must re-seal against its own storage.
+ */
+class PerfectHashTable {
+public:
+    /**
+     * @brief Input record for build()
+     */
+    struct Key {
+        std::string_view name;
+        std::uint64_t hash;
+        LookupKind kind;
+        const void* target;
+    };
+
+    PerfectHashTable() = default;
+    PerfectHashTable(const PerfectHashTable&) noexcept {}
+    PerfectHashTable& operator=(const PerfectHashTable& other) noexcept {
+        if (this != &other) {
+            clear();
+        }
+        return *this;
+    }
+    PerfectHashTable(PerfectHashTable&&) noexcept = default;
+    PerfectHashTable& operator=(PerfectHashTable&&) noexcept = default;
+
+    /**
+     * @brief Build the table from the given keys
+     * @return false if the keys cannot be placed (duplicate keys or names
+     *         too long); the table is left empty and callers keep using
+     *         their fallback path
+     */
+    bool build(std::span<const Key> keys) {
+        clear();
+        if (keys.empty()) {
+            return true;
+        }
+
+        const std::size_t n = keys.size();
+        std::size_t arena_size = 0;
+        for (const auto& k : keys) {
+            if (k.name.size() > UINT16_MAX) return false;
+            arena_size += k.name.size();
+        }
+
+        // Identical salted keys can never be separated by a displacement
+        std::vector<std::uint64_t> sorted(n);
+        std::transform(keys.begin(), keys.end(), sorted.begin(), salted);
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) [[unlikely]] {
+            return false;
+        }
+
+        // Average bucket size ~2 keeps the placement search short
+        const std::size_t bucket_count = std::max<std::size_t>(1, (n + 1) / 2);
+        std::vector<std::vector<std::uint32_t>> buckets(bucket_count);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            buckets[bucket_of(salted(keys[i]), bucket_count)].push_back(i);
+        }
+
+        // Place the largest buckets first while the table is still empty
+        std::vector<std::uint32_t> order(bucket_count);
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        // A minimal table is almost always found quickly; grow by one slot
+        // if a bucket cannot be placed so build() always terminates
+        for (std::size_t slot_count = n; slot_count < n * 2 + 8; ++slot_count) {
+            if (try_place(keys, buckets, order, slot_count)) {
+                fill_slots(keys, arena_size);
+                return true;
+            }
+        }
+        clear();
+        return false;
+    }
+
+    /**
+     * @brief Find the target stored for a name
+     * @param hash fnv1a_hash of the name
+     */
+    [[nodiscard]] const void* find(std::uint64_t hash, LookupKind kind, std::string_view name) const noexcept {
+        const Entry* e = probe(hash, kind);
+        if (e && e->name_size == name.size() &&
+            std::string_view{arena_.data() + e->name_offset, e->name_size} == name) [[likely]] {
+            return e->target;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Find the target by hash only (name not verified)
+     */
+    [[nodiscard]] const void* find(std::uint64_t hash, LookupKind kind) const noexcept {
+        const Entry* e = probe(hash, kind);
+        return e ? e->target : nullptr;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return slots_.empty(); }
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+
+    void clear() noexcept {
+        displacements_.clear();
+        slots_.clear();
+        arena_.clear();
+        count_ = 0;
+    }
+
+private:
+    struct Entry {
+        std::uint64_t key = 0;
+        const void* target = nullptr;
+        std::uint32_t name_offset = 0;
+        std::uint16_t name_size = 0;
+        LookupKind kind = LookupKind::Member;
+        bool used = false;
+    };
+
+    static std::uint64_t salt(std::uint64_t hash, LookupKind kind) noexcept {
+        return hash ^ (static_cast<std::uint64_t>(kind) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    static std::uint64_t salted(const Key& k) noexcept {
+        return salt(k.hash, k.kind);
+    }
+
+    // 64-bit finalizer (murmur3 fmix64)
+    static std::uint64_t mix(std::uint64_t x) noexcept {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+
+    // Map a 32-bit value onto [0, range) without a division
+    static std::size_t reduce(std::uint32_t x, std::size_t range) noexcept {
+        return static_cast<std::size_t>((static_cast<std::uint64_t>(x) * range) >> 32);
+    }
+
+    static std::size_t bucket_of(std::uint64_t key, std::size_t bucket_count) noexcept {
+        return reduce(static_cast<std::uint32_t>(mix(key) >> 32), bucket_count);
+    }
+
+    static std::size_t slot_of(std::uint64_t key, std::uint32_t displacement, std::size_t slot_count) noexcept {
+        return reduce(static_cast<std::uint32_t>(mix(key + displacement * 0x9E3779B97F4A7C15ULL)), slot_count);
+    }
+
+    const Entry* probe(std::uint64_t hash, LookupKind kind) const noexcept {
+        if (slots_.empty()) [[unlikely]] return nullptr;
+        const std::uint64_t key = salt(hash, kind);
+        const std::uint32_t d = displacements_[bucket_of(key, displacements_.size())];
+        const Entry& e = slots_[slot_of(key, d, slots_.size())];
+        return (e.used && e.key == key && e.kind == kind) ? &e : nullptr;
+    }
+
+    bool try_place(std::span<const Key> keys,
+                   const std::vector<std::vector<std::uint32_t>>& buckets,
+                   const std::vector<std::uint32_t>& order,
+                   std::size_t slot_count) {
+        static constexpr std::uint32_t MAX_DISPLACEMENT = 1u << 16;
+
+        displacements_.assign(buckets.size(), 0);
+        placement_.assign(slot_count, UINT32_MAX);
+        std::vector<std::size_t> candidate;
+
+        for (std::uint32_t b : order) {
+            const auto& bucket = buckets[b];
+            if (bucket.empty()) break;
+
+            bool placed = false;
+            for (std::uint32_t d = 0; d < MAX_DISPLACEMENT && !placed; ++d) {
+                candidate.clear();
+                placed = true;
+                for (std::uint32_t idx : bucket) {
+                    const std::size_t s = slot_of(salted(keys[idx]), d, slot_count);
+                    if (placement_[s] != UINT32_MAX ||
+                        std::find(candidate.begin(), candidate.end(), s) != candidate.end()) {
+                        placed = false;
+                        break;
+                    }
+                    candidate.push_back(s);
+                }
+                if (placed) {
+                    displacements_[b] = d;
+                    for (std::size_t i = 0; i < bucket.size(); ++i) {
+                        placement_[candidate[i]] = bucket[i];
+                    }
+                }
+            }
+            if (!placed) return false;
+        }
+        return true;
+    }
+
+    void fill_slots(std::span<const Key> keys, std::size_t arena_size) {
+        arena_.reserve(arena_size);
+        slots_.assign(placement_.size(), Entry{});
+        for (std::size_t s = 0; s < placement_.size(); ++s) {
+            if (placement_[s] == UINT32_MAX) continue;
+            const Key& k = keys[placement_[s]];
+            Entry& e = slots_[s];
+            e.key = salted(k);
+            e.target = k.target;
+            e.name_offset = static_cast<std::uint32_t>(arena_.size());
+            e.name_size = static_cast<std::uint16_t>(k.name.size());
+            e.kind = k.kind;
+            e.used = true;
+            arena_.append(k.name);
+        }
+        count_ = keys.size();
+        placement_.clear();
+        placement_.shrink_to_fit();
+    }
+
+    std::vector<std::uint32_t> displacements_;      ///< Per-bucket displacement
+    std::vector<Entry> slots_;                      ///< One slot per key (minimal)
+    std::string arena_;                             ///< Interned names
+    std::size_t count_ = 0;
+    std::vector<std::uint32_t> placement_;          ///< Build scratch: slot -> key index
+};
+
+} // namespace rttm::detail
+
+#endif // RTTM_DETAIL_PERFECT_HASH_TABLE_HPP
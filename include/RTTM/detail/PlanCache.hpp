@@ -0,0 +1,160 @@
+/**
+ * @file PlanCache.hpp
+ * @brief Cache of per-type plans shared by the serializers
+ */
+
+#ifndef RTTM_DETAIL_PLAN_CACHE_HPP
+#define RTTM_DETAIL_PLAN_CACHE_HPP
+
+#include "TypeInfo.hpp"
+#include "TypeManager.hpp"
+#include "Exceptions.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace rttm::detail {
+
+/**
+ * @brief Owns every plan of one kind (binary, JSON, diff) by TypeInfo
+ *
+ * Plan has type, valid and error members. Builder fills a plan from its
+ * TypeInfo and throws SerializationError when it can't:
+ * @code
+ * struct Builder {
+ *     void build(Plan& plan);     // plan.type is set
+ * };
+ * @endcode
+ * A class plan is inserted before build() runs, so recursive types (a
+ * struct holding a vector of itself) resolve to the in-progress plan
+ * through class_plan_locked(). State the builder keeps (value plans by
+ * codec) lives exactly as long as the class plans.
+ *
+ * invalidate() retires all plans at once; later lookups rebuild them.
+ * Lookups invalidate by themselves when TypeManager::epoch() has moved:
+ * unload_module() frees TypeInfos (and the codecs plans point into) whose
+ * addresses the next module's types may reuse. Retired plans are kept
+ * rather than freed, since other threads may still be executing them.
+ */
+template<typename Plan, typename Builder>
+class PlanCache {
+public:
+    static PlanCache& instance() {
+        static PlanCache cache;
+        return cache;
+    }
+
+    /**
+     * @brief Plan of type, building it on first use
+     */
+    const Plan& get(const TypeInfo& type) {
+        sync_epoch();
+        return lookup(type);
+    }
+
+    /**
+     * @brief get() without the lock when a thread repeats the same type
+     * @throws SerializationError if the plan is not valid
+     */
+    const Plan& cached(const TypeInfo& type) {
+        sync_epoch();
+        thread_local const TypeInfo* last_type = nullptr;
+        thread_local const Plan* last_plan = nullptr;
+        thread_local std::uint64_t last_generation = 0;
+        const std::uint64_t generation = generation_.load(std::memory_order_acquire);
+        if (last_type != &type || last_generation != generation) [[unlikely]] {
+            last_plan = &lookup(type);
+            last_type = &type;
+            last_generation = generation;
+        }
+        if (!last_plan->valid) [[unlikely]] {
+            throw SerializationError(last_plan->error);
+        }
+        return *last_plan;
+    }
+
+    /**
+     * @brief Plan of type; the builder calls this for nested classes
+     * @pre The exclusive lock is held (get() or build())
+     */
+    const Plan& class_plan_locked(const TypeInfo& type) {
+        auto& plans = current_->plans;
+        auto it = plans.find(&type);
+        if (it != plans.end()) {
+            return *it->second;
+        }
+
+        Plan& plan = *plans.emplace(&type, std::make_unique<Plan>()).first->second;
+        plan.type = &type;
+        try {
+            current_->builder.build(plan);
+            plan.valid = true;
+        } catch (const SerializationError& e) {
+            plan = Plan{};
+            plan.type = &type;
+            plan.error = e.what();
+        }
+        return plan;
+    }
+
+    /**
+     * @brief Retire every plan; the next lookup of each type rebuilds it
+     */
+    void invalidate() {
+        std::unique_lock lock(mutex_);
+        retire_locked();
+    }
+
+private:
+    struct Generation {
+        std::unordered_map<const TypeInfo*, std::unique_ptr<Plan>> plans;
+        Builder builder;
+    };
+
+    PlanCache() = default;
+
+    const Plan& lookup(const TypeInfo& type) {
+        {
+            std::shared_lock lock(mutex_);
+            auto it = current_->plans.find(&type);
+            if (it != current_->plans.end()) [[likely]] {
+                return *it->second;
+            }
+        }
+        std::unique_lock lock(mutex_);
+        return class_plan_locked(type);
+    }
+
+    // Retire plans built before the last unload_module()
+    void sync_epoch() {
+        const std::uint64_t epoch = TypeManager::instance().epoch();
+        if (epoch_.load(std::memory_order_acquire) != epoch) [[unlikely]] {
+            std::unique_lock lock(mutex_);
+            if (epoch_.load(std::memory_order_relaxed) < epoch) {
+                retire_locked();
+                epoch_.store(epoch, std::memory_order_release);
+            }
+        }
+    }
+
+    void retire_locked() {
+        retired_.push_back(std::move(current_));
+        current_ = std::make_unique<Generation>();
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+
+    std::shared_mutex mutex_;
+    std::unique_ptr<Generation> current_ = std::make_unique<Generation>();
+    std::vector<std::unique_ptr<Generation>> retired_;
+    std::atomic<std::uint64_t> generation_{1};  // Bumped on retirement; keys the thread-local fast path
+    std::atomic<std::uint64_t> epoch_{1};       // TypeManager::epoch() the current plans were built in
+};
+
+} // namespace rttm::detail
+
+#endif // RTTM_DETAIL_PLAN_CACHE_HPP
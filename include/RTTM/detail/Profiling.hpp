@@ -0,0 +1,160 @@
+/**
+ * @file Profiling.hpp
+ * @brief Opt-in counters and timers for reflection slow paths
+ *
+ * Compiled in only when RTTM_ENABLE_PROFILING is defined (CMake option of
+ * the same name). Otherwise every RTTM_PROFILE_* macro expands to nothing,
+ * its arguments are not evaluated, and profile_snapshot() is empty.
+ *
+ * Each event is recorded per (event, type, member) with a count and the
+ * accumulated and maximum time spent in the slow path. Recording goes to
+ * a thread-local table, so threads never contend with each other; only
+ * profile_snapshot() visits every table.
+ *
+ * Usage:
+ * @code
+ * for (const rttm::ProfileRecord& r : rttm::profile_snapshot().records) {
+ *     metrics.add(rttm::to_string(r.event), r.type, r.member, r.count, r.total_ns);
+ * }
+ * @endcode
+ */
+
+#ifndef RTTM_DETAIL_PROFILING_HPP
+#define RTTM_DETAIL_PROFILING_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rttm {
+
+/**
+ * @brief Slow-path events counted by the profiling layer
+ */
+enum class ProfileEvent : std::uint8_t {
+    TypeCacheMiss,          ///< TypeManager name lookup missed the thread-local cache
+    MemberLookupFallback,   ///< TypeInfo::find_member() on an unsealed type (map lookup)
+    InlineCacheMiss,        ///< RType property/method inline cache miss
+    ArgConversion,          ///< Registry argument converted from a different std::any type
+    VariantHeapSpill,       ///< Variant value too large for the inline buffer
+    InvokerFallback,        ///< MethodInfo::call() through the type-erased invoker
+    Count
+};
+
+/**
+ * @brief Stable name of an event (for metric labels)
+ */
+[[nodiscard]] constexpr std::string_view to_string(ProfileEvent event) noexcept {
+    switch (event) {
+        case ProfileEvent::TypeCacheMiss:        return "type_cache_miss";
+        case ProfileEvent::MemberLookupFallback: return "member_lookup_fallback";
+        case ProfileEvent::InlineCacheMiss:      return "inline_cache_miss";
+        case ProfileEvent::ArgConversion:        return "arg_conversion";
+        case ProfileEvent::VariantHeapSpill:     return "variant_heap_spill";
+        case ProfileEvent::InvokerFallback:      return "invoker_fallback";
+        case ProfileEvent::Count:                break;
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Aggregated counters of one (event, type, member)
+ *
+ * type and member are empty where the event site does not know them
+ * (e.g. InvokerFallback has no owning type).
+ */
+struct ProfileRecord {
+    ProfileEvent event = ProfileEvent::Count;
+    std::string type;
+    std::string member;
+    std::uint64_t count = 0;
+    std::uint64_t total_ns = 0;
+    std::uint64_t max_ns = 0;
+};
+
+/**
+ * @brief Point-in-time copy of all counters, merged over threads
+ */
+struct ProfileSnapshot {
+    std::vector<ProfileRecord> records;     ///< Sorted by event, type, member
+    std::uint64_t totals[static_cast<std::size_t>(ProfileEvent::Count)] = {};   ///< Count per event
+
+    [[nodiscard]] std::uint64_t total(ProfileEvent event) const noexcept {
+        return totals[static_cast<std::size_t>(event)];
+    }
+};
+
+/**
+ * @brief Whether this build records profiling events
+ */
+#ifdef RTTM_ENABLE_PROFILING
+inline constexpr bool profiling_enabled = true;
+#else
+inline constexpr bool profiling_enabled = false;
+#endif
+
+/**
+ * @brief Collect the counters of every thread (including exited ones)
+ */
+[[nodiscard]] ProfileSnapshot profile_snapshot();
+
+/**
+ * @brief Zero all counters
+ */
+void reset_profile();
+
+namespace detail {
+
+/**
+ * @brief Add one event to the calling thread's table
+ */
+void profile_record(ProfileEvent event, std::string_view type, std::string_view member,
+                    std::uint64_t elapsed_ns) noexcept;
+
+/**
+ * @brief Times a scope and records it as one event on destruction
+ */
+class ProfileScope {
+public:
+    ProfileScope(ProfileEvent event, std::string_view type, std::string_view member) noexcept
+        : event_(event), type_(type), member_(member), start_(std::chrono::steady_clock::now()) {}
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    ~ProfileScope() {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        profile_record(event_, type_, member_, static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+private:
+    ProfileEvent event_;
+    std::string_view type_;
+    std::string_view member_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace detail
+
+} // namespace rttm
+
+#ifdef RTTM_ENABLE_PROFILING
+    /// Time the rest of the enclosing scope as one event
+    #define RTTM_PROFILE_SCOPE(event, type, member) \
+        ::rttm::detail::ProfileScope RTTM_DETAIL_PROFILE_CONCAT(rttm_profile_scope_, __LINE__){ \
+            ::rttm::ProfileEvent::event, (type), (member)}
+    /// Count one event without timing it
+    #define RTTM_PROFILE_EVENT(event, type, member) \
+        ::rttm::detail::profile_record(::rttm::ProfileEvent::event, (type), (member), 0)
+#else
+    #define RTTM_PROFILE_SCOPE(event, type, member) ((void)0)
+    #define RTTM_PROFILE_EVENT(event, type, member) ((void)0)
+#endif
+
+#define RTTM_DETAIL_PROFILE_CONCAT_IMPL(a, b) a##b
+#define RTTM_DETAIL_PROFILE_CONCAT(a, b) RTTM_DETAIL_PROFILE_CONCAT_IMPL(a, b)
+
+#endif // RTTM_DETAIL_PROFILING_HPP
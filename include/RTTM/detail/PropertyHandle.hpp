@@ -6,7 +6,8 @@
  * repeated property access with minimal overhead (just pointer arithmetic).
  * 
  * This is the fastest possible property access in RTTM - use it when
- * you access the same property many times in a hot loop.
+ * you access the same property many times in a hot loop. gather() and
+ * scatter() cover the batch case (one field over many objects).
  */
 
 #ifndef RTTM_DETAIL_PROPERTY_HANDLE_HPP
@@ -17,10 +18,40 @@
 
 #include <string_view>
 #include <typeindex>
+#include <span>
+#include <ranges>
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 
 namespace rttm {
 
+namespace detail {
+    /**
+     * @brief Copy one field out of count objects laid out stride bytes apart
+     * 
+     * field points at the field of the first object. Src is the stored
+     * field type, Dst the output type; when they differ each element is
+     * converted with static_cast.
+     */
+    template<typename Src, typename Dst>
+    inline void strided_gather(const char* field, std::size_t stride, std::size_t count, Dst* out) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<Dst>(*reinterpret_cast<const Src*>(field + i * stride));
+        }
+    }
+    
+    /**
+     * @brief Write one field into count objects laid out stride bytes apart
+     */
+    template<typename Dst, typename Src>
+    inline void strided_scatter(char* field, std::size_t stride, std::size_t count, const Src* in) {
+        for (std::size_t i = 0; i < count; ++i) {
+            *reinterpret_cast<Dst*>(field + i * stride) = static_cast<Dst>(in[i]);
+        }
+    }
+}
+
 /**
  * @brief Pre-cached property handle for fastest access
  * 
@@ -48,13 +79,15 @@ public:
      */
     explicit PropertyHandle(const detail::MemberInfo* member) noexcept
         : offset_(member ? member->offset : 0)
+        , dirty_word_(member ? member->dirty_word : detail::no_dirty_word)
+        , dirty_bit_(member ? static_cast<std::uint8_t>(member->ordinal % 64) : 0)
         , valid_(member != nullptr)
     {}
     
     /**
      * @brief Default constructor creates invalid handle
      */
-    constexpr PropertyHandle() noexcept : offset_(0), valid_(false) {}
+    constexpr PropertyHandle() noexcept : offset_(0), dirty_word_(detail::no_dirty_word), dirty_bit_(0), valid_(false) {}
     
     /**
      * @brief Check if handle is valid
@@ -99,6 +132,59 @@ public:
     template<typename U, typename V>
     void set(U& obj, V&& value) const noexcept {
         get(obj) = std::forward<V>(value);
+        mark_dirty(static_cast<void*>(&obj));
+    }
+    
+    /**
+     * @brief Read this property from every object of a contiguous range
+     * 
+     * A strided copy using the cached offset; no per-element lookup or
+     * type check.
+     * 
+     * @param objects Contiguous range of objects (vector, array, span)
+     * @param out Output values, one per object
+     * @return Number of values written (min of both sizes)
+     */
+    template<std::ranges::contiguous_range R>
+    std::size_t gather(const R& objects, std::span<T> out) const {
+        using U = std::ranges::range_value_t<R>;
+        const std::size_t count = std::min<std::size_t>(std::ranges::size(objects), out.size());
+        gather(std::ranges::data(objects), sizeof(U), count, out.data());
+        return count;
+    }
+    
+    /**
+     * @brief Write this property into every object of a contiguous range
+     * 
+     * @param objects Contiguous range of objects (vector, array, span)
+     * @param in Input values, one per object
+     * @return Number of objects written (min of both sizes)
+     */
+    template<std::ranges::contiguous_range R>
+    std::size_t scatter(R&& objects, std::span<const T> in) const {
+        using U = std::ranges::range_value_t<R>;
+        const std::size_t count = std::min<std::size_t>(std::ranges::size(objects), in.size());
+        scatter(static_cast<void*>(std::ranges::data(objects)), sizeof(U), count, in.data());
+        return count;
+    }
+    
+    /**
+     * @brief Read this property from count objects stride bytes apart
+     */
+    void gather(const void* first, std::size_t stride, std::size_t count, T* out) const {
+        detail::strided_gather<T>(static_cast<const char*>(first) + offset_, stride, count, out);
+    }
+    
+    /**
+     * @brief Write this property into count objects stride bytes apart
+     */
+    void scatter(void* first, std::size_t stride, std::size_t count, const T* in) const {
+        detail::strided_scatter<T>(static_cast<char*>(first) + offset_, stride, count, in);
+        if (dirty_word_ != detail::no_dirty_word) [[unlikely]] {
+            for (std::size_t i = 0; i < count; ++i) {
+                mark_dirty(static_cast<char*>(first) + i * stride);
+            }
+        }
     }
     
     /**
@@ -109,7 +195,15 @@ public:
     }
 
 private:
+    void mark_dirty(void* obj) const noexcept {
+        if (dirty_word_ != detail::no_dirty_word) [[unlikely]] {
+            *reinterpret_cast<std::uint64_t*>(static_cast<char*>(obj) + dirty_word_) |= std::uint64_t{1} << dirty_bit_;
+        }
+    }
+    
     std::size_t offset_;
+    std::uint32_t dirty_word_;      ///< no_dirty_word unless the owning type tracks changes
+    std::uint8_t dirty_bit_;
     bool valid_;
 };
 
@@ -151,6 +245,9 @@ public:
      */
     template<typename R>
     [[nodiscard]] R call(void* obj) const {
+        if (method_->matches_exactly<R>()) [[likely]] {
+            return method_->call_direct<R>(obj);
+        }
         std::span<std::any> empty_args;
         std::any result = method_->call(obj, empty_args);
         
@@ -169,6 +266,9 @@ public:
         if constexpr (sizeof...(Args) == 0) {
             return call<R>(obj);
         } else {
+            if (method_->matches_exactly<R, Args...>()) [[likely]] {
+                return method_->call_direct<R>(obj, std::forward<Args>(args)...);
+            }
             std::array<std::any, sizeof...(Args)> arg_array = {std::any{std::forward<Args>(args)}...};
             std::span<std::any> arg_span{arg_array};
             std::any result = method_->call(obj, arg_span);
@@ -17,12 +17,16 @@
 #include "TypeManager.hpp"
 #include "TypeTraits.hpp"
 #include "Exceptions.hpp"
+#include "Name.hpp"
+#include "InlineCache.hpp"
 
 #include <string>
 #include <string_view>
 #include <memory>
 #include <any>
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <unordered_map>
 #include <stdexcept>
@@ -33,56 +37,6 @@ namespace rttm {
 // Forward declaration
 class RType;
 
-namespace detail {
-    // Compile-time string hash for fast lookup (FNV-1a)
-    constexpr std::size_t hash_string(std::string_view str) noexcept {
-        std::size_t hash = 14695981039346656037ULL;
-        for (char c : str) {
-            hash ^= static_cast<std::size_t>(c);
-            hash *= 1099511628211ULL;
-        }
-        return hash;
-    }
-    
-    // Small inline cache for hot path optimization
-    template<typename Key, typename Value, std::size_t N = 4>
-    class InlineCache {
-    public:
-        struct Entry {
-            Key key{};
-            Value value{};
-            bool valid = false;
-        };
-        
-        Value* find(const Key& key) noexcept {
-            for (auto& entry : entries_) {
-                if (entry.valid && entry.key == key) {
-                    return &entry.value;
-                }
-            }
-            return nullptr;
-        }
-        
-        void insert(const Key& key, const Value& value) noexcept {
-            // Find empty slot or replace oldest
-            for (auto& entry : entries_) {
-                if (!entry.valid) {
-                    entry.key = key;
-                    entry.value = value;
-                    entry.valid = true;
-                    return;
-                }
-            }
-            // Replace first entry (simple eviction)
-            entries_[0].key = key;
-            entries_[0].value = value;
-        }
-        
-    private:
-        std::array<Entry, N> entries_{};
-    };
-}
-
 /**
  * @brief Runtime type handle for dynamic reflection operations
  * 
@@ -106,6 +60,13 @@ namespace detail {
  * // Invoke method
  * auto result = rtype->invoke<int>("getValue");
  * @endcode
+ * 
+ * Thread safety: once its object is created or attached, one RType may be
+ * shared by any number of threads calling property(), invoke(), as() and
+ * the const accessors; the inline caches they fill are lock-free. create(),
+ * attach() and attach_raw() must not run concurrently with anything else
+ * on the same RType, and the object itself is only as thread-safe as the
+ * members and methods being used.
  */
 class RType : public std::enable_shared_from_this<RType> {
 public:
@@ -139,15 +100,8 @@ public:
      */
     template<typename T>
     static std::shared_ptr<RType> get() {
-        // Static cache per type - initialized once, thread-safe
-        static const detail::TypeInfo* cached_info = []() {
-            auto& mgr = detail::TypeManager::instance();
-            const detail::TypeInfo* info = mgr.get_type_by_id(detail::type_id<T>);
-            if (!info) {
-                info = mgr.get_type(detail::type_name<T>());
-            }
-            return info;
-        }();
+        // Per-type cache, revalidated when a module is unloaded
+        const detail::TypeInfo* cached_info = detail::cached_type_info<T>();
         
         if (!cached_info) [[unlikely]] {
             throw TypeNotRegisteredError(detail::type_name<T>());
@@ -182,7 +136,7 @@ public:
             }
         }
         
-        // Fallback: use std::function factory
+        // Fallback: use the type-erased factory
         if (!default_factory_) {
             auto factory_it = info_->factories.find("default");
             if (factory_it == info_->factories.end()) {
@@ -294,19 +248,32 @@ public:
      */
     template<typename T>
     T& property(std::string_view name) {
+        return property<T>(Name{name});
+    }
+    
+    /**
+     * @brief Type-safe property access by pre-hashed name
+     * 
+     * Same as property<T>(std::string_view) without hashing the name;
+     * use with the _rn literal on hot paths.
+     */
+    template<typename T>
+    T& property(Name name) {
         if (!created_ || !instance_) [[unlikely]] {
             throw ObjectNotCreatedError(info_ ? info_->name : "unknown");
         }
         
-        // Fast path: check inline cache first (no hash computation for common cases)
-        const std::size_t name_hash = detail::hash_string(name);
+        // Fast path: check inline cache keyed by the name hash
+        const std::size_t name_hash = name.hash();
         
-        if (auto* cached = prop_cache_.find(name_hash)) [[likely]] {
-            void* ptr = static_cast<char*>(instance_.get()) + *cached;
+        std::size_t cached_offset;
+        if (prop_cache_.find(name_hash, cached_offset)) [[likely]] {
+            void* ptr = static_cast<char*>(instance_.get()) + cached_offset;
             return *static_cast<T*>(ptr);
         }
         
         // Cache miss - look up member info (no allocation with transparent hash)
+        RTTM_PROFILE_SCOPE(InlineCacheMiss, info_->name, name.str());
         const detail::MemberInfo* member = info_->find_member(name);
         if (!member) [[unlikely]] {
             throw PropertyNotFoundError(info_->name, name, info_->member_names());
@@ -335,6 +302,14 @@ public:
      */
     template<typename T>
     const T& property(std::string_view name) const {
+        return const_cast<RType*>(this)->property<T>(Name{name});
+    }
+    
+    /**
+     * @brief Const type-safe property access by pre-hashed name
+     */
+    template<typename T>
+    const T& property(Name name) const {
         return const_cast<RType*>(this)->property<T>(name);
     }
     
@@ -350,6 +325,13 @@ public:
      * @throws PropertyNotFoundError if property doesn't exist
      */
     std::shared_ptr<RType> property(std::string_view name) {
+        return property(Name{name});
+    }
+    
+    /**
+     * @brief Dynamic property access by pre-hashed name
+     */
+    std::shared_ptr<RType> property(Name name) {
         if (!created_ || !instance_) {
             throw ObjectNotCreatedError(info_ ? info_->name : "unknown");
         }
@@ -392,9 +374,9 @@ public:
      */
     [[nodiscard]] bool is_sequential_container(std::string_view name) const {
         if (!info_) return false;
-        auto member_it = info_->members.find(std::string{name});
-        if (member_it == info_->members.end()) return false;
-        return member_it->second.category == detail::MemberCategory::Sequential;
+        const auto* member = info_->find_member(name);
+        if (!member) return false;
+        return member->category == detail::MemberCategory::Sequential;
     }
     
     /**
@@ -404,9 +386,36 @@ public:
      */
     [[nodiscard]] bool is_associative_container(std::string_view name) const {
         if (!info_) return false;
-        auto member_it = info_->members.find(std::string{name});
-        if (member_it == info_->members.end()) return false;
-        return member_it->second.category == detail::MemberCategory::Associative;
+        const auto* member = info_->find_member(name);
+        if (!member) return false;
+        return member->category == detail::MemberCategory::Associative;
+    }
+    
+    /**
+     * @brief Allocation-free view of a container property
+     * 
+     * Elements are visited as ElementRefs; no RType is created per element.
+     * 
+     * @throws ObjectNotCreatedError if no instance is attached
+     * @throws PropertyNotFoundError if property doesn't exist
+     * @throws PropertyTypeMismatchError if the property is not a container
+     */
+    [[nodiscard]] ContainerView container(Name name) const {
+        if (!created_ || !instance_) [[unlikely]] {
+            throw ObjectNotCreatedError(info_ ? info_->name : "unknown");
+        }
+        const auto* member = info_->find_member(name);
+        if (!member) [[unlikely]] {
+            throw PropertyNotFoundError(info_->name, name, info_->member_names());
+        }
+        if (!member->container_ops) [[unlikely]] {
+            throw PropertyTypeMismatchError(name, "container", member->type_name);
+        }
+        return ContainerView{static_cast<char*>(instance_.get()) + member->offset, member->container_ops};
+    }
+    
+    [[nodiscard]] ContainerView container(std::string_view name) const {
+        return container(Name{name});
     }
 
 
@@ -424,23 +433,35 @@ public:
      */
     template<typename R, typename... Args>
     R invoke(std::string_view name, Args&&... args) {
+        return invoke<R>(Name{name}, std::forward<Args>(args)...);
+    }
+    
+    /**
+     * @brief Invoke a method by pre-hashed name
+     * 
+     * Same as invoke(std::string_view, ...) without hashing the name.
+     */
+    template<typename R, typename... Args>
+    R invoke(Name name, Args&&... args) {
         if (!created_ || !instance_) [[unlikely]] {
             throw ObjectNotCreatedError(info_ ? info_->name : "unknown");
         }
         
         const detail::MethodInfo* matched = nullptr;
         
-        // Fast path: check inline cache
-        const std::size_t name_hash = detail::hash_string(name);
+        // Fast path: check inline cache keyed by the name hash
+        const std::size_t name_hash = name.hash();
         
-        if (auto* cached = method_cache_.find(name_hash)) [[likely]] {
-            if ((*cached)->param_types.size() == sizeof...(Args)) {
-                matched = *cached;
+        const detail::MethodInfo* cached = nullptr;
+        if (method_cache_.find(name_hash, cached)) [[likely]] {
+            if (cached->param_types.size() == sizeof...(Args)) {
+                matched = cached;
             }
         }
         
         if (!matched) [[unlikely]] {
             // Cache miss - look up method (no allocation with transparent hash)
+            RTTM_PROFILE_SCOPE(InlineCacheMiss, info_->name, name.str());
             const auto* overloads = info_->find_methods(name);
             if (!overloads) [[unlikely]] {
                 throw MethodNotFoundError(info_->name, name, info_->method_names());
@@ -464,7 +485,12 @@ public:
             method_cache_.insert(name_hash, matched);
         }
         
-        // Build argument array
+        // Exact signature match: typed call, no std::any round-trip
+        if (matched->matches_exactly<R, Args...>()) [[likely]] {
+            return matched->call_direct<R>(instance_.get(), std::forward<Args>(args)...);
+        }
+        
+        // Build argument array (conversion path)
         if constexpr (sizeof...(Args) == 0) {
             std::span<std::any> empty_args;
             std::any result = matched->call(instance_.get(), empty_args);
@@ -498,6 +524,14 @@ public:
      */
     template<typename... Args>
     void invoke_void(std::string_view name, Args&&... args) {
+        invoke<void>(Name{name}, std::forward<Args>(args)...);
+    }
+    
+    /**
+     * @brief Invoke a void method by pre-hashed name
+     */
+    template<typename... Args>
+    void invoke_void(Name name, Args&&... args) {
         invoke<void>(name, std::forward<Args>(args)...);
     }
 
@@ -546,6 +580,13 @@ public:
         return info_ && info_->has_member(name);
     }
     
+    /**
+     * @brief Check if a property exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_property(Name name) const {
+        return info_ && info_->has_member(name);
+    }
+    
     /**
      * @brief Check if a method exists
      * @param name The method name
@@ -555,6 +596,13 @@ public:
         return info_ && info_->has_method(name);
     }
     
+    /**
+     * @brief Check if a method exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_method(Name name) const {
+        return info_ && info_->has_method(name);
+    }
+    
     // ==================== Enumeration Methods ====================
     
     /**
@@ -588,12 +636,12 @@ public:
             throw ReflectionError("No type info available");
         }
         
-        auto member_it = info_->members.find(std::string{name});
-        if (member_it == info_->members.end()) {
+        const auto* member = info_->find_member(name);
+        if (!member) {
             throw PropertyNotFoundError(info_->name, name, info_->member_names());
         }
         
-        return member_it->second.category;
+        return member->category;
     }
     
     /**
@@ -607,12 +655,12 @@ public:
             throw ReflectionError("No type info available");
         }
         
-        auto member_it = info_->members.find(std::string{name});
-        if (member_it == info_->members.end()) {
+        const auto* member = info_->find_member(name);
+        if (!member) {
             throw PropertyNotFoundError(info_->name, name, info_->member_names());
         }
         
-        return member_it->second.type_name;
+        return member->type_name;
     }
 
 
@@ -677,9 +725,7 @@ public:
      */
     [[nodiscard]] const detail::MemberInfo* get_member_info(std::string_view name) const {
         if (!info_) return nullptr;
-        auto it = info_->members.find(std::string{name});
-        if (it == info_->members.end()) return nullptr;
-        return &(it->second);
+        return info_->find_member(name);
     }
     
     /**
@@ -703,9 +749,9 @@ private:
     bool created_ = false;
     
     // Cached factory for fast object creation
-    mutable const std::function<std::shared_ptr<void>()>* default_factory_ = nullptr;
+    mutable const detail::FactoryFn* default_factory_ = nullptr;
     
-    // Inline caches for hot path optimization (stack allocated, no heap)
+    // Inline caches for hot path optimization (no heap, safe to fill concurrently)
     mutable detail::InlineCache<std::size_t, std::size_t, 8> prop_cache_;
     mutable detail::InlineCache<std::size_t, const detail::MethodInfo*, 4> method_cache_;
     
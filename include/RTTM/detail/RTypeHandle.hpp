@@ -57,23 +57,17 @@ public:
     /**
      * @brief Get type handle by template type (fastest path)
      * 
-     * Uses static initialization - effectively zero cost after first call.
+     * Served from a per-type cache (an epoch load and a seqlock read)
+     * after the first call.
      * 
      * @tparam T The type to get handle for
      * @return RTypeHandle (lightweight value)
+     * @note The first lookup may run T's lazy registration, which can throw
      */
     template<typename T>
-    [[nodiscard]] static RTypeHandle get() noexcept {
-        // Static cache per type - initialized once, thread-safe
-        static const detail::TypeInfo* cached_info = []() {
-            auto& mgr = detail::TypeManager::instance();
-            const detail::TypeInfo* info = mgr.get_type_by_id(detail::type_id<T>);
-            if (!info) {
-                info = mgr.get_type(detail::type_name<T>());
-            }
-            return info;
-        }();
-        return RTypeHandle{cached_info};
+    [[nodiscard]] static RTypeHandle get() {
+        // Per-type cache, revalidated when a module is unloaded
+        return RTypeHandle{detail::cached_type_info<T>()};
     }
     
     /**
@@ -81,8 +75,9 @@ public:
      * 
      * @param type_name The registered type name
      * @return RTypeHandle (may be invalid if type not found)
+     * @note A miss may run the type's lazy registration, which can throw
      */
-    [[nodiscard]] static RTypeHandle get(std::string_view type_name) noexcept {
+    [[nodiscard]] static RTypeHandle get(std::string_view type_name) {
         auto& mgr = detail::TypeManager::instance();
         return RTypeHandle{mgr.get_type(type_name)};
     }
@@ -164,6 +159,20 @@ public:
         return info_ && info_->has_method(name);
     }
     
+    /**
+     * @brief Check if property exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_property(Name name) const noexcept {
+        return info_ && info_->has_member(name);
+    }
+    
+    /**
+     * @brief Check if method exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_method(Name name) const noexcept {
+        return info_ && info_->has_method(name);
+    }
+    
     /**
      * @brief Get property names
      */
@@ -193,6 +202,18 @@ public:
     template<typename T>
     [[nodiscard]] inline BoundType bind(T& obj) const;
     
+    /**
+     * @brief Bind to an untyped object pointer
+     * 
+     * For dynamic callers that only have a void* (scripting bridges,
+     * containers). The caller guarantees obj points at an object of this
+     * handle's type.
+     * 
+     * @param obj Pointer to the object
+     * @return BoundType for property/method access
+     */
+    [[nodiscard]] inline BoundType bind_raw(void* obj) const noexcept;
+    
     /**
      * @brief Create a new instance
      * 
@@ -206,7 +227,7 @@ public:
             return info_->default_factory_raw();
         }
         
-        // Fallback: use std::function factory
+        // Fallback: use the type-erased factory
         auto it = info_->factories.find("default");
         if (it != info_->factories.end() && it->second) {
             return it->second();
@@ -235,10 +256,18 @@ public:
      */
     template<typename T>
     [[nodiscard]] PropertyHandle<T> get_property(std::string_view name) const noexcept {
+        return get_property<T>(Name{name});
+    }
+    
+    /**
+     * @brief Get a pre-cached property handle by pre-hashed name
+     */
+    template<typename T>
+    [[nodiscard]] PropertyHandle<T> get_property(Name name) const noexcept {
         if (!info_) return PropertyHandle<T>{};
-        auto it = info_->members.find(std::string{name});
-        if (it == info_->members.end()) return PropertyHandle<T>{};
-        return PropertyHandle<T>{&it->second};
+        const auto* member = info_->find_member(name);
+        if (!member) return PropertyHandle<T>{};
+        return PropertyHandle<T>{member};
     }
     
     /**
@@ -249,12 +278,19 @@ public:
      * @return MethodHandle (may be invalid if method not found)
      */
     [[nodiscard]] MethodHandle get_method(std::string_view name, std::size_t param_count = 0) const noexcept {
+        return get_method(Name{name}, param_count);
+    }
+    
+    /**
+     * @brief Get a pre-cached method handle by pre-hashed name
+     */
+    [[nodiscard]] MethodHandle get_method(Name name, std::size_t param_count = 0) const noexcept {
         if (!info_) return MethodHandle{};
-        auto it = info_->methods.find(std::string{name});
-        if (it == info_->methods.end()) return MethodHandle{};
+        const auto* overloads = info_->find_methods(name);
+        if (!overloads) return MethodHandle{};
         
         // Find overload with matching parameter count
-        for (const auto& method : it->second) {
+        for (const auto& method : *overloads) {
             if (method.param_types.size() == param_count) {
                 return MethodHandle{&method};
             }
@@ -262,6 +298,31 @@ public:
         return MethodHandle{};
     }
     
+    /**
+     * @brief Precomputed pointer adjustment to another reflected type (O(1))
+     * 
+     * Valid for the same type, an unambiguous base (upcast) and a type
+     * deriving from this one (downcast, unchecked like static_cast).
+     * 
+     * Usage:
+     * @code
+     * auto to_base = RTypeHandle::get<Derived>().cast_to(RTypeHandle::get<Base>());
+     * Base* base = static_cast<Base*>(to_base.apply(derived_ptr));
+     * @endcode
+     */
+    [[nodiscard]] detail::TypeCast cast_to(RTypeHandle other) const noexcept {
+        if (!info_ || !other.info_) return {};
+        return info_->cast_to(*other.info_);
+    }
+    
+    /**
+     * @brief Check whether this type is other or derives from it
+     */
+    [[nodiscard]] bool is_derived_from(RTypeHandle other) const noexcept {
+        if (!info_ || !other.info_) return false;
+        return info_ == other.info_ || info_->base_offsets.contains(other.info_->type_index);
+    }
+    
     // Comparison operators
     [[nodiscard]] constexpr bool operator==(const RTypeHandle& other) const noexcept {
         return info_ == other.info_;
@@ -294,6 +355,10 @@ BoundType RTypeHandle::bind(T& obj) const {
     return BoundType{info_, static_cast<void*>(&obj)};
 }
 
+inline BoundType RTypeHandle::bind_raw(void* obj) const noexcept {
+    return BoundType{info_, obj};
+}
+
 } // namespace rttm
 
 #endif // RTTM_DETAIL_RTYPE_HANDLE_HPP
@@ -0,0 +1,165 @@
+/**
+ * @file ReflectedArray.hpp
+ * @brief Contiguous, owning array of objects of a runtime-chosen type
+ *
+ * ReflectedArray stores N objects of one registered type back to back in
+ * a single allocation and builds, copies and tears them down in bulk
+ * through TypeInfo::construct_n / copy_n / destroy_n. For types whose
+ * value-initialization is all zero bytes, construction is one memset;
+ * trivially copyable types copy with one memcpy and trivially
+ * destructible types skip destruction entirely.
+ *
+ * @code
+ * auto particles = rttm::ReflectedArray::create("Particle", 10000);
+ * auto backup = particles;                    // bulk copy
+ * particles[0].set_property("mass", 2.0f);    // non-owning Instance view
+ * @endcode
+ */
+
+#ifndef RTTM_DETAIL_REFLECTED_ARRAY_HPP
+#define RTTM_DETAIL_REFLECTED_ARRAY_HPP
+
+#include "TypeInfo.hpp"
+#include "Instance.hpp"
+
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+#include <stdexcept>
+
+namespace rttm {
+
+/**
+ * @brief Owning contiguous array of reflected objects
+ *
+ * Unlike InstanceArray (arena-owned, move-only), a ReflectedArray is
+ * copyable and frees its storage back to its memory resource (the default
+ * resource unless given). Elements are accessed as non-owning Instances
+ * or raw pointers with stride type_info()->size.
+ */
+class ReflectedArray {
+public:
+    ReflectedArray() noexcept = default;
+
+    /**
+     * @brief Default-construct count objects of type_info
+     * @throws ReflectionError if the type is not default constructible
+     */
+    ReflectedArray(const detail::TypeInfo* type_info, std::size_t count,
+                   std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Copy-construct count objects of type_info from contiguous src
+     * @throws ReflectionError if the type is not copy constructible
+     */
+    ReflectedArray(const detail::TypeInfo* type_info, const void* src, std::size_t count,
+                   std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Default-construct count objects of a registered type
+     * @throws TypeNotRegisteredError if the type is not registered
+     */
+    [[nodiscard]] static ReflectedArray create(std::string_view type_name, std::size_t count,
+                                               std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    ReflectedArray(const ReflectedArray& other)
+        : ReflectedArray(other.type_info_, other.data_, other.count_, other.resource_) {}
+
+    ReflectedArray& operator=(const ReflectedArray& other) {
+        if (this != &other) {
+            *this = ReflectedArray(other);
+        }
+        return *this;
+    }
+
+    ReflectedArray(ReflectedArray&& other) noexcept
+        : resource_(other.resource_)
+        , type_info_(std::exchange(other.type_info_, nullptr))
+        , data_(std::exchange(other.data_, nullptr))
+        , count_(std::exchange(other.count_, 0)) {}
+
+    ReflectedArray& operator=(ReflectedArray&& other) noexcept {
+        if (this != &other) {
+            clear();
+            resource_ = other.resource_;
+            type_info_ = std::exchange(other.type_info_, nullptr);
+            data_ = std::exchange(other.data_, nullptr);
+            count_ = std::exchange(other.count_, 0);
+        }
+        return *this;
+    }
+
+    ~ReflectedArray() {
+        clear();
+    }
+
+    /**
+     * @brief Destroy all objects and release the storage
+     */
+    void clear() noexcept {
+        if (data_) {
+            type_info_->destroy_n(data_, count_);
+            resource_->deallocate(data_, count_ * type_info_->size, type_info_->alignment);
+        }
+        data_ = nullptr;
+        count_ = 0;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return count_; }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+    /**
+     * @brief Distance in bytes between consecutive elements
+     */
+    [[nodiscard]] std::size_t stride() const noexcept {
+        return type_info_ ? type_info_->size : 0;
+    }
+
+    [[nodiscard]] const detail::TypeInfo* type_info() const noexcept { return type_info_; }
+    [[nodiscard]] std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+    /**
+     * @brief Pointer to the first element (usable with PropertyHandle::gather)
+     */
+    [[nodiscard]] void* data() noexcept { return data_; }
+    [[nodiscard]] const void* data() const noexcept { return data_; }
+
+    /**
+     * @brief Raw pointer to element i (unchecked)
+     */
+    [[nodiscard]] void* get_raw(std::size_t i) noexcept {
+        return static_cast<char*>(data_) + i * type_info_->size;
+    }
+
+    [[nodiscard]] const void* get_raw(std::size_t i) const noexcept {
+        return static_cast<const char*>(data_) + i * type_info_->size;
+    }
+
+    /**
+     * @brief Non-owning Instance view of element i (unchecked)
+     */
+    [[nodiscard]] Instance operator[](std::size_t i) noexcept {
+        return Instance::from_ref(get_raw(i), type_info_);
+    }
+
+    /**
+     * @brief Non-owning Instance view of element i
+     * @throws std::out_of_range if i >= size()
+     */
+    [[nodiscard]] Instance at(std::size_t i) {
+        if (i >= count_) [[unlikely]] {
+            throw std::out_of_range("ReflectedArray index out of range");
+        }
+        return (*this)[i];
+    }
+
+private:
+    std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+    const detail::TypeInfo* type_info_ = nullptr;
+    void* data_ = nullptr;
+    std::size_t count_ = 0;
+};
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_REFLECTED_ARRAY_HPP
@@ -0,0 +1,305 @@
+/**
+ * @file ReflectedColumns.hpp
+ * @brief Column-store (SoA) container for objects of a runtime-chosen type
+ *
+ * ReflectedColumns keeps the reflected members of N objects of one
+ * registered type as separate contiguous columns, one per MemberInfo in
+ * ordinal order. Scanning one field over many rows touches only that
+ * field's column, and column<T>() hands out a plain std::span<T> that
+ * loops auto-vectorize over.
+ *
+ * Rows are addressed through Row views offering the Instance property
+ * API (get_property / set_property by name or ordinal), and convert to
+ * and from real objects with load(), store(), push_back() and
+ * to_instance(). Only reflected members are stored: members that were
+ * not registered are default-initialized when a row is materialized.
+ *
+ * @code
+ * auto particles = rttm::ReflectedColumns::create("Particle");
+ * for (const Particle& p : source) particles.push_back(&p);
+ *
+ * float total = 0.0f;
+ * for (float m : particles.column<float>("mass")) total += m;
+ *
+ * particles.row(3).set_property("mass", 2.0f);
+ * rttm::Instance copy = particles.row(3).to_instance();
+ * @endcode
+ */
+
+#ifndef RTTM_DETAIL_REFLECTED_COLUMNS_HPP
+#define RTTM_DETAIL_REFLECTED_COLUMNS_HPP
+
+#include "TypeInfo.hpp"
+#include "Instance.hpp"
+#include "Exceptions.hpp"
+#include "Name.hpp"
+
+#include <memory_resource>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace rttm {
+
+/**
+ * @brief Struct-of-arrays storage of the reflected members of a type
+ *
+ * Every member of the type needs copy construction, copy assignment and
+ * destruction (checked on construction). Growth relocates each column
+ * with memcpy for trivially copyable members, move construction when all
+ * members are nothrow movable, and copies otherwise.
+ */
+class ReflectedColumns {
+public:
+    class Row;
+
+    ReflectedColumns() noexcept = default;
+
+    /**
+     * @brief Empty column store for type_info
+     * @throws ReflectionError if a member cannot be stored in a column
+     */
+    explicit ReflectedColumns(const detail::TypeInfo* type_info,
+                              std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Empty column store for a registered type
+     * @throws TypeNotRegisteredError if the type is not registered
+     */
+    [[nodiscard]] static ReflectedColumns create(std::string_view type_name,
+                                                 std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    ReflectedColumns(const ReflectedColumns& other);
+
+    ReflectedColumns& operator=(const ReflectedColumns& other) {
+        if (this != &other) {
+            *this = ReflectedColumns(other);
+        }
+        return *this;
+    }
+
+    ReflectedColumns(ReflectedColumns&& other) noexcept
+        : resource_(other.resource_)
+        , type_info_(std::exchange(other.type_info_, nullptr))
+        , columns_(std::move(other.columns_))
+        , size_(std::exchange(other.size_, 0))
+        , capacity_(std::exchange(other.capacity_, 0)) {}
+
+    ReflectedColumns& operator=(ReflectedColumns&& other) noexcept {
+        if (this != &other) {
+            release();
+            resource_ = other.resource_;
+            type_info_ = std::exchange(other.type_info_, nullptr);
+            columns_ = std::move(other.columns_);
+            size_ = std::exchange(other.size_, 0);
+            capacity_ = std::exchange(other.capacity_, 0);
+        }
+        return *this;
+    }
+
+    ~ReflectedColumns() {
+        release();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Number of columns (the type's member count)
+     */
+    [[nodiscard]] std::size_t column_count() const noexcept { return columns_.size(); }
+
+    [[nodiscard]] const detail::TypeInfo* type_info() const noexcept { return type_info_; }
+
+    /**
+     * @brief Make room for capacity rows without further reallocation
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Grow with value-initialized rows or shrink from the back
+     * @throws ReflectionError if growing and a member is not default constructible
+     */
+    void resize(std::size_t count);
+
+    /**
+     * @brief Append a row copied from the reflected members of obj
+     */
+    void push_back(const void* obj);
+
+    /**
+     * @brief Destroy all rows (capacity is kept)
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Copy row i into the reflected members of obj (copy assignment)
+     */
+    void load(std::size_t i, void* obj) const;
+
+    /**
+     * @brief Overwrite row i with the reflected members of obj
+     */
+    void store(std::size_t i, const void* obj);
+
+    /**
+     * @brief Base address of the column for member ordinal (nullptr if out of range)
+     */
+    [[nodiscard]] void* column_data(std::size_t ordinal) noexcept {
+        return ordinal < columns_.size() ? columns_[ordinal].data : nullptr;
+    }
+
+    [[nodiscard]] const void* column_data(std::size_t ordinal) const noexcept {
+        return ordinal < columns_.size() ? columns_[ordinal].data : nullptr;
+    }
+
+    /**
+     * @brief Typed view of the column for member ordinal
+     * @throws PropertyNotFoundError / PropertyTypeMismatchError
+     */
+    template<typename T>
+    [[nodiscard]] std::span<T> column(std::size_t ordinal) {
+        return {static_cast<T*>(checked_column(ordinal, typeid(T), detail::type_name<T>()).data), size_};
+    }
+
+    template<typename T>
+    [[nodiscard]] std::span<const T> column(std::size_t ordinal) const {
+        return {static_cast<const T*>(checked_column(ordinal, typeid(T), detail::type_name<T>()).data), size_};
+    }
+
+    /**
+     * @brief Typed view of the column for a member name
+     * @throws PropertyNotFoundError / PropertyTypeMismatchError
+     */
+    template<typename T>
+    [[nodiscard]] std::span<T> column(Name member) {
+        return column<T>(ordinal_of(member));
+    }
+
+    template<typename T>
+    [[nodiscard]] std::span<const T> column(Name member) const {
+        return column<T>(ordinal_of(member));
+    }
+
+    template<typename T>
+    [[nodiscard]] std::span<T> column(std::string_view member) {
+        return column<T>(Name{member});
+    }
+
+    template<typename T>
+    [[nodiscard]] std::span<const T> column(std::string_view member) const {
+        return column<T>(Name{member});
+    }
+
+    /**
+     * @brief View of row i (unchecked)
+     */
+    [[nodiscard]] Row row(std::size_t i) noexcept;
+
+    /**
+     * @brief View of row i
+     * @throws std::out_of_range if i >= size()
+     */
+    [[nodiscard]] Row at(std::size_t i);
+
+private:
+    struct Column {
+        const detail::MemberInfo* member;
+        void* data;
+    };
+
+    [[nodiscard]] std::size_t ordinal_of(Name member) const;
+    [[nodiscard]] const Column& column_at(std::size_t ordinal) const;
+    [[nodiscard]] const Column& checked_column(std::size_t ordinal, const std::type_info& type,
+                                               std::string_view type_name) const;
+
+    [[nodiscard]] void* cell(std::size_t column, std::size_t i) const noexcept {
+        return static_cast<char*>(columns_[column].data) + i * columns_[column].member->value_ops->size;
+    }
+
+    void destroy_rows(std::size_t first, std::size_t last) noexcept;
+    void release() noexcept;
+
+    std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+    const detail::TypeInfo* type_info_ = nullptr;
+    std::vector<Column> columns_;       ///< Indexed by member ordinal
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+};
+
+/**
+ * @brief Non-owning view of one row of a ReflectedColumns
+ *
+ * Mirrors the Instance property API; the row's fields live in separate
+ * columns, so there is no object address (use to_instance() or
+ * ReflectedColumns::load() for APIs that need one). Invalidated when the
+ * columns reallocate.
+ */
+class ReflectedColumns::Row {
+public:
+    [[nodiscard]] std::size_t index() const noexcept { return index_; }
+
+    /**
+     * @brief Address of this row's field for member ordinal (unchecked)
+     */
+    [[nodiscard]] void* field(std::size_t ordinal) const noexcept {
+        return columns_->cell(ordinal, index_);
+    }
+
+    [[nodiscard]] Variant get_property(std::size_t ordinal) const;
+    [[nodiscard]] Variant get_property(Name name) const {
+        return get_property(columns_->ordinal_of(name));
+    }
+    [[nodiscard]] Variant get_property(std::string_view name) const {
+        return get_property(Name{name});
+    }
+
+    void set_property(std::size_t ordinal, const Variant& value) const;
+    void set_property(Name name, const Variant& value) const {
+        set_property(columns_->ordinal_of(name), value);
+    }
+    void set_property(std::string_view name, const Variant& value) const {
+        set_property(Name{name}, value);
+    }
+
+    /**
+     * @brief Set a property from any type (like Instance::set_property)
+     */
+    template<typename T>
+        requires (!std::is_same_v<std::decay_t<T>, Variant>)
+    void set_property(std::string_view name, T&& value) const {
+        set_property(Name{name}, Variant::create(std::forward<T>(value)));
+    }
+
+    /**
+     * @brief Typed reference to a field
+     * @throws PropertyNotFoundError / PropertyTypeMismatchError
+     */
+    template<typename T>
+    [[nodiscard]] T& get(std::string_view name) const {
+        return columns_->column<T>(Name{name})[index_];
+    }
+
+    /**
+     * @brief New owned object holding a copy of this row
+     */
+    [[nodiscard]] Instance to_instance() const;
+
+private:
+    friend class ReflectedColumns;
+
+    Row(ReflectedColumns* columns, std::size_t index) noexcept : columns_(columns), index_(index) {}
+
+    ReflectedColumns* columns_;
+    std::size_t index_;
+};
+
+inline ReflectedColumns::Row ReflectedColumns::row(std::size_t i) noexcept {
+    return Row(this, i);
+}
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_REFLECTED_COLUMNS_HPP
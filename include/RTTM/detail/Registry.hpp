@@ -8,6 +8,9 @@
  * - Methods (member functions)
  * - Constructors
  * - Base class relationships
+ *
+ * It also provides the describers behind StaticTypeRecord tables, so
+ * generated records produce exactly the TypeInfo a Registry chain would.
  */
 
 #ifndef RTTM_DETAIL_REGISTRY_HPP
@@ -17,6 +20,9 @@
 #include "TypeManager.hpp"
 #include "TypeTraits.hpp"
 #include "Variant.hpp"
+#include "StaticTypeRecord.hpp"
+#include "Async.hpp"
+#include "DirtyBits.hpp"
 
 #include <string_view>
 #include <type_traits>
@@ -72,9 +78,31 @@ public:
             return;
         }
         
-        // Create new TypeInfo
+        // Register the type with TypeId for fast lookup
+        mgr.register_type(type_name_, describe_type(), detail::type_id<T>);
+        info_ = mgr.get_type_mutable(type_name_);
+    }
+    
+    /**
+     * @brief Seal the type once the registration chain is complete
+     * 
+     * Compiles members and methods into the TypeInfo's perfect hash table.
+     */
+    ~Registry() {
+        if (info_) {
+            info_->seal();
+        }
+    }
+
+    /**
+     * @brief Build the TypeInfo Registry<T>() registers (no members or methods)
+     * 
+     * Shared with static type records, which materialize the same TypeInfo
+     * lazily instead of at static initialization.
+     */
+    static detail::TypeInfo describe_type() {
         detail::TypeInfo new_info{
-            type_name_,
+            std::string{detail::type_name<T>()},
             sizeof(T),
             std::type_index(typeid(T))
         };
@@ -83,12 +111,18 @@ public:
         new_info.destructor = [](void* ptr) {
             static_cast<T*>(ptr)->~T();
         };
+        new_info.destructor_raw = &destroy_impl;
+        new_info.alignment = alignof(T);
+        
+        new_info.trivially_destructible = std::is_trivially_destructible_v<T>;
         
         // Set up copier if copy constructible
         if constexpr (CopyConstructible<T>) {
             new_info.copier = [](void* dest, const void* src) {
                 new (dest) T(*static_cast<const T*>(src));
             };
+            new_info.copy_construct_raw = &copy_construct_impl;
+            new_info.trivially_copyable = std::is_trivially_copyable_v<T>;
         }
         
         // Auto-register default constructor if available
@@ -98,13 +132,16 @@ public:
             };
             // Set raw factory pointer for fast path
             new_info.default_factory_raw = &default_factory_impl;
+            new_info.default_construct_raw = &construct_impl;
+            // Only scalars whose null value is all zero bytes: a class may hold
+            // a data member pointer, whose null value is -1 on common ABIs
+            new_info.zero_constructible = std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                                          std::is_pointer_v<T> || std::is_null_pointer_v<T>;
         }
         
-        // Register the type with TypeId for fast lookup
-        mgr.register_type(type_name_, std::move(new_info), detail::type_id<T>);
-        info_ = mgr.get_type_mutable(type_name_);
+        return new_info;
     }
-
+    
     /**
      * @brief Register a property (member variable)
      * 
@@ -120,6 +157,39 @@ public:
     Registry& property(std::string_view name, U T::* member) {
         if (!info_) return *this;
         
+        info_->add_member(describe_member(name, member));
+        
+        return *this;
+    }
+    
+    /**
+     * @brief Record reflected writes to T's members in a DirtyBits member
+     * 
+     * Each member's bit is its ordinal (registration order). Members
+     * registered before or after this call are both tracked.
+     * 
+     * @param bits Pointer to the DirtyBits member of T
+     * @return Reference to this Registry for chaining
+     * @throws ReflectionError if T has more members than DirtyBits<N> holds
+     */
+    template<std::size_t N>
+    Registry& track_changes(DirtyBits<N> T::* bits) {
+        if (!info_) return *this;
+        
+        static_assert(std::is_standard_layout_v<DirtyBits<N>>, "DirtyBits words must start the member");
+        const std::size_t offset = reinterpret_cast<std::size_t>(
+            &(static_cast<T*>(nullptr)->*bits)
+        );
+        info_->enable_change_tracking(offset, N);
+        
+        return *this;
+    }
+    
+    /**
+     * @brief Build the MemberInfo property() registers
+     */
+    template<typename U>
+    static detail::MemberInfo describe_member(std::string_view name, U T::* member) {
         // Calculate offset using offsetof-like technique
         // We use a null pointer cast to calculate the offset
         std::size_t offset = reinterpret_cast<std::size_t>(
@@ -132,7 +202,7 @@ public:
         // Get type name
         std::string member_type_name{detail::type_name<U>()};
         
-        // Create and store member info
+        // Create member info
         detail::MemberInfo member_info{
             name,
             offset,
@@ -140,11 +210,19 @@ public:
             member_type_name,
             category
         };
+        member_info.type_id = detail::type_id<U>;
+        member_info.arithmetic_kind = detail::arithmetic_kind_v<U>;
+        member_info.container_ops = detail::container_ops_for<U>();
+        member_info.codec = detail::type_codec_for<U>();
+        member_info.value_ops = detail::value_ops_for<U>();
+        if constexpr (std::is_copy_constructible_v<U>) {
+            member_info.getter = &member_get_impl<U>;
+        }
+        if constexpr (std::is_copy_assignable_v<U>) {
+            member_info.setter = &member_set_impl<U>;
+        }
         
-        info_->members[std::string{name}] = std::move(member_info);
-        info_->invalidate_name_cache();  // Invalidate cached name list
-        
-        return *this;
+        return member_info;
     }
     
     /**
@@ -163,10 +241,25 @@ public:
     Registry& method(std::string_view name, R(T::*func)(Args...)) {
         if (!info_) return *this;
         
+        info_->add_method(describe_method(name, func));
+        
+        return *this;
+    }
+    
+    /**
+     * @brief Build the MethodInfo method() registers for a non-const method
+     */
+    template<typename R, typename... Args>
+    static detail::MethodInfo describe_method(std::string_view name, R(T::*func)(Args...)) {
         // Create type-erased invoker
         auto invoker = [func](void* obj, std::span<std::any> args) -> std::any {
-            return invoke_method<R, Args...>(static_cast<T*>(obj), func, args, 
-                                             std::index_sequence_for<Args...>{});
+            if constexpr (detail::SettledByWait<R>) {
+                return await_invoke_method<R, Args...>(static_cast<T*>(obj), func, args,
+                                                       std::index_sequence_for<Args...>{});
+            } else {
+                return invoke_method<R, Args...>(static_cast<T*>(obj), func, args, 
+                                                 std::index_sequence_for<Args...>{});
+            }
         };
         
         // Build parameter type list
@@ -186,18 +279,30 @@ public:
             false  // non-const
         };
         
-        // Set raw invoker for fast path - store method pointer in MethodInfo
-        method_info.raw_invoker = &raw_invoke_method<R, Args...>;
-        method_info.method_ptr = reinterpret_cast<void*&>(func);
+        // Store method pointer in MethodInfo for the raw invokers
+        store_method_ptr(method_info, func);
+        if constexpr (detail::SettledByWait<R>) {
+            // The awaitable cannot live in std::any/Variant: wait for its value
+            method_info.raw_invoker = &raw_await_method<R, R(T::*)(Args...), Args...>;
+            method_info.variant_invoker = &variant_await_method<R, R(T::*)(Args...), Args...>;
+        } else {
+            method_info.raw_invoker = &raw_invoke_method<R, Args...>;
+            
+            // Set variant invoker for pure dynamic path
+            method_info.variant_invoker = &variant_invoke_method<R, Args...>;
+        }
         
-        // Set variant invoker for pure dynamic path
-        method_info.variant_invoker = &variant_invoke_method<R, Args...>;
+        // Set direct invoker for exactly matching typed calls
+        method_info.direct_invoker = &direct_invoke_method<R, Args...>;
+        method_info.exact_invoker = &exact_invoke_method<R, R(T::*)(Args...), Args...>;
+        method_info.param_kinds = {detail::arithmetic_kind_v<std::decay_t<Args>>...};
         
-        // Add to methods map (supports overloading)
-        info_->methods[std::string{name}].push_back(std::move(method_info));
-        info_->invalidate_name_cache();  // Invalidate cached name list
+        // Set async invoker when the method returns an awaitable or future
+        if constexpr (detail::AsyncReturn<R>) {
+            method_info.async_invoker = &async_invoke_method<R(T::*)(Args...), Args...>;
+        }
         
-        return *this;
+        return method_info;
     }
     
     /**
@@ -213,10 +318,25 @@ public:
     Registry& method(std::string_view name, R(T::*func)(Args...) const) {
         if (!info_) return *this;
         
+        info_->add_method(describe_method(name, func));
+        
+        return *this;
+    }
+    
+    /**
+     * @brief Build the MethodInfo method() registers for a const method
+     */
+    template<typename R, typename... Args>
+    static detail::MethodInfo describe_method(std::string_view name, R(T::*func)(Args...) const) {
         // Create type-erased invoker for const method
         auto invoker = [func](void* obj, std::span<std::any> args) -> std::any {
-            return invoke_const_method<R, Args...>(static_cast<T*>(obj), func, args,
-                                                   std::index_sequence_for<Args...>{});
+            if constexpr (detail::SettledByWait<R>) {
+                return await_invoke_method<R, Args...>(static_cast<T*>(obj), func, args,
+                                                       std::index_sequence_for<Args...>{});
+            } else {
+                return invoke_const_method<R, Args...>(static_cast<T*>(obj), func, args,
+                                                       std::index_sequence_for<Args...>{});
+            }
         };
         
         // Build parameter type list
@@ -236,18 +356,30 @@ public:
             true  // const method
         };
         
-        // Set raw invoker for fast path - store method pointer in MethodInfo
-        method_info.raw_invoker = &raw_invoke_const_method<R, Args...>;
-        method_info.method_ptr = reinterpret_cast<void*&>(func);
+        // Store method pointer in MethodInfo for the raw invokers
+        store_method_ptr(method_info, func);
+        if constexpr (detail::SettledByWait<R>) {
+            // The awaitable cannot live in std::any/Variant: wait for its value
+            method_info.raw_invoker = &raw_await_method<R, R(T::*)(Args...) const, Args...>;
+            method_info.variant_invoker = &variant_await_method<R, R(T::*)(Args...) const, Args...>;
+        } else {
+            method_info.raw_invoker = &raw_invoke_const_method<R, Args...>;
+            
+            // Set variant invoker for pure dynamic path
+            method_info.variant_invoker = &variant_invoke_const_method<R, Args...>;
+        }
         
-        // Set variant invoker for pure dynamic path
-        method_info.variant_invoker = &variant_invoke_const_method<R, Args...>;
+        // Set direct invoker for exactly matching typed calls
+        method_info.direct_invoker = &direct_invoke_const_method<R, Args...>;
+        method_info.exact_invoker = &exact_invoke_method<R, R(T::*)(Args...) const, Args...>;
+        method_info.param_kinds = {detail::arithmetic_kind_v<std::decay_t<Args>>...};
         
-        // Add to methods map
-        info_->methods[std::string{name}].push_back(std::move(method_info));
-        info_->invalidate_name_cache();  // Invalidate cached name list
+        // Set async invoker when the method returns an awaitable or future
+        if constexpr (detail::AsyncReturn<R>) {
+            method_info.async_invoker = &async_invoke_method<R(T::*)(Args...) const, Args...>;
+        }
         
-        return *this;
+        return method_info;
     }
 
     /**
@@ -263,14 +395,24 @@ public:
     Registry& constructor() {
         if (!info_) return *this;
         
+        describe_constructor<Args...>(*info_);
+        
+        return *this;
+    }
+    
+    /**
+     * @brief Add the factory entry constructor<Args...>() registers
+     */
+    template<typename... Args>
+    static void describe_constructor(detail::TypeInfo& info) {
         // Generate a signature key for this constructor
         std::string signature = generate_constructor_signature<Args...>();
         
         // Create factory function
         if constexpr (sizeof...(Args) == 0) {
             // Default constructor - may already be registered
-            if (info_->factories.find("default") == info_->factories.end()) {
-                info_->factories["default"] = []() -> std::shared_ptr<void> {
+            if (info.factories.find("default") == info.factories.end()) {
+                info.factories["default"] = []() -> std::shared_ptr<void> {
                     return std::make_shared<T>();
                 };
             }
@@ -278,76 +420,98 @@ public:
             // Store factory with args - we need a way to pass args
             // For now, store a marker that this constructor exists
             // The actual construction will be handled by RType::create
-            info_->factories[signature] = []() -> std::shared_ptr<void> {
+            info.factories[signature] = []() -> std::shared_ptr<void> {
                 // This is a placeholder - actual construction with args
                 // is handled differently through RType
                 return nullptr;
             };
         }
-        
-        return *this;
     }
     
     /**
      * @brief Declare a base class relationship
      * 
-     * Merges base class properties and methods into this type's info.
-     * Supports multiple levels of inheritance.
+     * Flattens the base's members and methods (including everything the
+     * base inherited) into this type. The base subobject offset is added
+     * to member offsets and to the `this` adjustment of methods, so
+     * multiple inheritance works and derived lookups need no base walk.
+     * Also records Base and its own bases for RTypeHandle::cast_to().
+     * 
+     * Register Base before calling this, otherwise only the cast offset
+     * is recorded.
      * 
-     * @tparam Base The base class type
+     * @tparam Base A non-virtual, unambiguous base class of T
      * @return Reference to this Registry for chaining
      */
     template<typename Base>
     requires std::is_base_of_v<Base, T>
     Registry& base() {
+        static_assert(NonVirtualBaseOf<Base, T>,
+                      "Registry::base<Base>() requires an unambiguous non-virtual base: "
+                      "members of a virtual base have no fixed offset in the derived type");
         if (!info_) return *this;
         
+        const std::ptrdiff_t offset = detail::base_offset<T, Base>();
+        
         // Record base type
-        info_->base_types.push_back(std::type_index(typeid(Base)));
+        if (std::find(info_->base_types.begin(), info_->base_types.end(), std::type_index(typeid(Base)))
+            == info_->base_types.end()) {
+            info_->base_types.push_back(std::type_index(typeid(Base)));
+        }
+        info_->add_base(std::type_index(typeid(Base)), offset);
         
         // Get base type info
         auto& mgr = detail::TypeManager::instance();
-        std::string base_name{detail::type_name<Base>()};
-        const detail::TypeInfo* base_info = mgr.get_type(base_name);
+        const detail::TypeInfo* base_info = mgr.get_type_by_id(detail::type_id<Base>);
+        if (!base_info) {
+            base_info = mgr.get_type(detail::type_name<Base>());
+        }
         
         if (base_info) {
-            // Merge base class members (with offset adjustment)
-            for (const auto& [name, member] : base_info->members) {
-                if (info_->members.find(name) == info_->members.end()) {
-                    // Calculate adjusted offset for base member in derived class
-                    // The offset is relative to the base subobject
-                    detail::MemberInfo adjusted_member = member;
-                    // Base offset in derived is 0 for single inheritance
-                    // For multiple inheritance, we'd need to calculate the base offset
-                    info_->members[name] = std::move(adjusted_member);
+            // Base members are already flattened: rebase them onto T
+            for (const detail::MemberInfo* member : base_info->member_layout()) {
+                if (info_->members.find(member->name) == info_->members.end()) {
+                    detail::MemberInfo adjusted_member = *member;
+                    adjusted_member.offset += static_cast<std::size_t>(offset);
+                    info_->add_member(std::move(adjusted_member));
                 }
             }
             
             // Merge base class methods
             for (const auto& [name, method_list] : base_info->methods) {
-                auto& derived_methods = info_->methods[name];
+                const auto* derived_methods = info_->find_methods(name);
                 for (const auto& method : method_list) {
                     // Check if method is already overridden
                     bool overridden = false;
-                    for (const auto& existing : derived_methods) {
-                        if (existing.param_types == method.param_types) {
-                            overridden = true;
-                            break;
+                    if (derived_methods) {
+                        for (const auto& existing : *derived_methods) {
+                            if (existing.param_types == method.param_types) {
+                                overridden = true;
+                                break;
+                            }
                         }
                     }
                     if (!overridden) {
-                        derived_methods.push_back(method);
+                        detail::MethodInfo adjusted_method = method;
+                        adjusted_method.this_offset += static_cast<std::size_t>(offset);
+                        info_->add_method(std::move(adjusted_method));
+                        derived_methods = info_->find_methods(name);
                     }
                 }
             }
             
-            // Recursively merge base's base types
+            // Indirect bases: compose offsets through Base
             for (const auto& base_base : base_info->base_types) {
                 if (std::find(info_->base_types.begin(), info_->base_types.end(), base_base) 
                     == info_->base_types.end()) {
                     info_->base_types.push_back(base_base);
                 }
             }
+            for (const auto& [base_base, base_base_offset] : base_info->base_offsets) {
+                info_->add_base(base_base, base_base_offset == detail::ambiguous_base_offset
+                                               ? detail::ambiguous_base_offset
+                                               : offset + base_base_offset);
+            }
         }
         
         return *this;
@@ -404,6 +568,7 @@ private:
             if (arg.type() == typeid(Target)) {
                 return std::any_cast<Target>(arg);
             }
+            RTTM_PROFILE_SCOPE(ArgConversion, detail::type_name<T>(), detail::type_name<Target>());
             
             // Handle const char* to std::string conversion
             if constexpr (std::is_same_v<Target, std::string>) {
@@ -447,10 +612,10 @@ private:
                                   std::span<std::any> args,
                                   std::index_sequence<Is...>) {
         if constexpr (std::is_void_v<R>) {
-            (obj->*func)(convert_arg<Args>(args[Is])...);
+            (obj->*func)(convert_arg<std::decay_t<Args>>(args[Is])...);
             return std::any{};
         } else {
-            return std::any{(obj->*func)(convert_arg<Args>(args[Is])...)};
+            return std::any{(obj->*func)(convert_arg<std::decay_t<Args>>(args[Is])...)};
         }
     }
     
@@ -462,13 +627,28 @@ private:
                                         std::span<std::any> args,
                                         std::index_sequence<Is...>) {
         if constexpr (std::is_void_v<R>) {
-            (obj->*func)(convert_arg<Args>(args[Is])...);
+            (obj->*func)(convert_arg<std::decay_t<Args>>(args[Is])...);
             return std::any{};
         } else {
-            return std::any{(obj->*func)(convert_arg<Args>(args[Is])...)};
+            return std::any{(obj->*func)(convert_arg<std::decay_t<Args>>(args[Is])...)};
         }
     }
     
+    /**
+     * @brief Store a member function pointer in MethodInfo
+     * 
+     * Member function pointers are wider than void* on most ABIs (16 bytes
+     * on Itanium), so the pointer is kept in shared storage and method_ptr
+     * points at it. Copies of the MethodInfo (base merging, vector growth)
+     * keep pointing at the same storage.
+     */
+    template<typename F>
+    static void store_method_ptr(detail::MethodInfo& info, F func) {
+        auto storage = std::make_shared<F>(func);
+        info.method_ptr = storage.get();
+        info.method_storage = std::move(storage);
+    }
+    
     // Store method pointer for raw invoker (deprecated - now stored in MethodInfo)
     // Kept for backward compatibility
     template<typename R, typename... Args>
@@ -478,13 +658,13 @@ private:
     static inline R(T::*stored_const_method_)(Args...) const = nullptr;
     
     /**
-     * @brief Raw invoker for non-const method (avoids std::function overhead)
+     * @brief Raw invoker for non-const method (avoids type-erased invoker overhead)
      * 
      * method_ptr contains the actual member function pointer
      */
     template<typename R, typename... Args>
     static std::any raw_invoke_method(void* obj, std::span<std::any> args, void* method_ptr) {
-        auto func = reinterpret_cast<R(T::*&)(Args...)>(method_ptr);
+        auto func = *static_cast<R(T::**)(Args...)>(method_ptr);
         return invoke_method<R, Args...>(static_cast<T*>(obj), func, 
                                          args, std::index_sequence_for<Args...>{});
     }
@@ -494,7 +674,7 @@ private:
      */
     template<typename R, typename... Args>
     static std::any raw_invoke_const_method(void* obj, std::span<std::any> args, void* method_ptr) {
-        auto func = reinterpret_cast<R(T::*&)(Args...) const>(method_ptr);
+        auto func = *static_cast<R(T::**)(Args...) const>(method_ptr);
         return invoke_const_method<R, Args...>(static_cast<T*>(obj), func,
                                                args, std::index_sequence_for<Args...>{});
     }
@@ -509,7 +689,7 @@ private:
      */
     template<typename R, typename... Args>
     static void variant_invoke_method(void* obj, void* result, const void* const* args, std::size_t nargs, void* method_ptr) {
-        auto func = reinterpret_cast<R(T::*&)(Args...)>(method_ptr);
+        auto func = *static_cast<R(T::**)(Args...)>(method_ptr);
         if constexpr (sizeof...(Args) == 0) {
             if constexpr (std::is_void_v<R>) {
                 (static_cast<T*>(obj)->*func)();
@@ -526,7 +706,7 @@ private:
     
     template<typename R, typename... Args, std::size_t... Is>
     static void variant_invoke_method_impl(void* obj, void* result, const void* const* args, void* method_ptr, std::index_sequence<Is...>) {
-        auto func = reinterpret_cast<R(T::*&)(Args...)>(method_ptr);
+        auto func = *static_cast<R(T::**)(Args...)>(method_ptr);
         if constexpr (std::is_void_v<R>) {
             (static_cast<T*>(obj)->*func)(extract_variant_arg<Args>(args[Is])...);
         } else {
@@ -542,7 +722,7 @@ private:
      */
     template<typename R, typename... Args>
     static void variant_invoke_const_method(void* obj, void* result, const void* const* args, std::size_t nargs, void* method_ptr) {
-        auto func = reinterpret_cast<R(T::*&)(Args...) const>(method_ptr);
+        auto func = *static_cast<R(T::**)(Args...) const>(method_ptr);
         if constexpr (sizeof...(Args) == 0) {
             if constexpr (std::is_void_v<R>) {
                 (static_cast<T*>(obj)->*func)();
@@ -559,7 +739,7 @@ private:
     
     template<typename R, typename... Args, std::size_t... Is>
     static void variant_invoke_const_method_impl(void* obj, void* result, const void* const* args, void* method_ptr, std::index_sequence<Is...>) {
-        auto func = reinterpret_cast<R(T::*&)(Args...) const>(method_ptr);
+        auto func = *static_cast<R(T::**)(Args...) const>(method_ptr);
         if constexpr (std::is_void_v<R>) {
             (static_cast<T*>(obj)->*func)(extract_variant_arg<Args>(args[Is])...);
         } else {
@@ -570,6 +750,126 @@ private:
         }
     }
     
+    /**
+     * @brief Direct invoker for non-const method (typed, no conversion)
+     * 
+     * args[i] points at a std::decay_t<Args_i>; the decayed return value is
+     * constructed into result.
+     */
+    template<typename R, typename... Args>
+    static void direct_invoke_method(void* obj, void* result, const void* const* args, const void* method_ptr) {
+        auto func = *static_cast<R(T::* const*)(Args...)>(method_ptr);
+        direct_invoke_impl<R, Args...>(static_cast<T*>(obj), func, result, args, std::index_sequence_for<Args...>{});
+    }
+    
+    /**
+     * @brief Direct invoker for const method (typed, no conversion)
+     */
+    template<typename R, typename... Args>
+    static void direct_invoke_const_method(void* obj, void* result, const void* const* args, const void* method_ptr) {
+        auto func = *static_cast<R(T::* const*)(Args...) const>(method_ptr);
+        direct_invoke_impl<R, Args...>(static_cast<T*>(obj), func, result, args, std::index_sequence_for<Args...>{});
+    }
+    
+    template<typename R, typename... Args, typename F, std::size_t... Is>
+    static void direct_invoke_impl(T* obj, F func, void* result, const void* const* args, std::index_sequence<Is...>) {
+        if constexpr (std::is_void_v<R>) {
+            (obj->*func)(*static_cast<const std::decay_t<Args>*>(args[Is])...);
+        } else {
+            ::new (result) std::decay_t<R>((obj->*func)(*static_cast<const std::decay_t<Args>*>(args[Is])...));
+        }
+    }
+    
+    /**
+     * @brief Exact invoker: typed arguments by address, result into a Variant
+     */
+    template<typename R, typename F, typename... Args>
+    static void exact_invoke_method(void* obj, const void* const* args, void* result, const void* method_ptr) {
+        exact_invoke_impl<R, Args...>(static_cast<T*>(obj), *static_cast<const F*>(method_ptr),
+                                      result, args, std::index_sequence_for<Args...>{});
+    }
+    
+    template<typename R, typename... Args, typename F, std::size_t... Is>
+    static void exact_invoke_impl(T* obj, F func, void* result, const void* const* args, std::index_sequence<Is...>) {
+        auto call = [&]() -> R {
+            return (obj->*func)(*static_cast<const std::decay_t<Args>*>(args[Is])...);
+        };
+        if constexpr (std::is_void_v<detail::settled_t<R>>) {
+            detail::settled_invoke(call);
+        } else {
+            auto ret = detail::settled_invoke(call);
+            if (result) {
+                *static_cast<Variant*>(result) = Variant::create(std::move(ret));
+            }
+        }
+    }
+    
+    /**
+     * @brief std::any invoker for methods returning a non-copyable awaitable
+     * 
+     * Blocks until the awaitable completes and returns the awaited value.
+     */
+    template<typename R, typename... Args, typename F, std::size_t... Is>
+    static std::any await_invoke_method(T* obj, F func, std::span<std::any> args, std::index_sequence<Is...>) {
+        if constexpr (std::is_void_v<detail::await_value_t<R>>) {
+            detail::sync_await((obj->*func)(convert_arg<std::decay_t<Args>>(args[Is])...));
+            return std::any{};
+        } else {
+            return std::any{detail::sync_await((obj->*func)(convert_arg<std::decay_t<Args>>(args[Is])...))};
+        }
+    }
+    
+    /**
+     * @brief Raw invoker counterpart of await_invoke_method
+     */
+    template<typename R, typename F, typename... Args>
+    static std::any raw_await_method(void* obj, std::span<std::any> args, void* method_ptr) {
+        return await_invoke_method<R, Args...>(static_cast<T*>(obj), *static_cast<F*>(method_ptr),
+                                               args, std::index_sequence_for<Args...>{});
+    }
+    
+    /**
+     * @brief Variant invoker for methods returning a non-copyable awaitable (blocking)
+     */
+    template<typename R, typename F, typename... Args>
+    static void variant_await_method(void* obj, void* result, const void* const* args, std::size_t nargs, void* method_ptr) {
+        variant_await_method_impl<R, Args...>(static_cast<T*>(obj), *static_cast<F*>(method_ptr),
+                                              result, args, std::index_sequence_for<Args...>{});
+    }
+    
+    template<typename R, typename... Args, typename F, std::size_t... Is>
+    static void variant_await_method_impl(T* obj, F func, void* result, const void* const* args, std::index_sequence<Is...>) {
+        if constexpr (std::is_void_v<detail::await_value_t<R>>) {
+            detail::sync_await((obj->*func)(extract_variant_arg<Args>(args[Is])...));
+        } else {
+            auto ret = detail::sync_await((obj->*func)(extract_variant_arg<Args>(args[Is])...));
+            if (result) {
+                *static_cast<Variant*>(result) = Variant::create(std::move(ret));
+            }
+        }
+    }
+    
+    /**
+     * @brief Async invoker: start the method and complete state when its awaitable does
+     * 
+     * The converted arguments are moved into the driving coroutine, so
+     * methods taking them by reference see live objects until completion.
+     */
+    template<typename F, typename... Args>
+    static void async_invoke_method(void* obj, const void* state, const void* const* args, std::size_t nargs, void* method_ptr) {
+        async_invoke_impl<Args...>(static_cast<T*>(obj), *static_cast<F*>(method_ptr),
+                                   *static_cast<const std::shared_ptr<detail::AsyncState>*>(state),
+                                   args, std::index_sequence_for<Args...>{});
+    }
+    
+    template<typename... Args, typename F, std::size_t... Is>
+    static void async_invoke_impl(T* obj, F func, const std::shared_ptr<detail::AsyncState>& state,
+                                  const void* const* args, std::index_sequence<Is...>) {
+        detail::drive_async(state, [obj, func, ...converted = extract_variant_arg<Args>(args[Is])]() mutable -> decltype(auto) {
+            return (obj->*func)(std::forward<Args>(converted)...);
+        });
+    }
+    
     /**
      * @brief Extract argument from Variant pointer
      * 
@@ -591,14 +891,121 @@ private:
         return v->get<DecayArg>();
     }
     
+    /**
+     * @brief Dynamic getter thunk: copy the member into a Variant
+     */
+    template<typename U>
+    static void member_get_impl(const void* field, void* value) {
+        *static_cast<Variant*>(value) = Variant::create(*static_cast<const U*>(field));
+    }
+    
+    /**
+     * @brief Dynamic setter thunk: exact type, else arithmetic/enum conversion
+     */
+    template<typename U>
+    static bool member_set_impl(void* field, const void* value) {
+        const Variant& v = *static_cast<const Variant*>(value);
+        if (v.is_type<U>()) [[likely]] {
+            *static_cast<U*>(field) = v.get_unchecked<U>();
+            return true;
+        }
+        if constexpr (detail::arithmetic_kind_v<U> != detail::ArithmeticKind::None) {
+            if (v.can_convert<U>()) {
+                *static_cast<U*>(field) = v.convert<U>();
+                return true;
+            }
+        }
+        return false;
+    }
+    
     /**
      * @brief Static default factory implementation for raw function pointer
      */
     static std::shared_ptr<void> default_factory_impl() {
         return std::make_shared<T>();
     }
+    
+    /**
+     * @brief Placement default constructor for arena-backed creation
+     */
+    static void construct_impl(void* storage) {
+        ::new (storage) T();
+    }
+    
+    /**
+     * @brief Placement copy constructor for TypeInfo::copy_construct_raw
+     */
+    static void copy_construct_impl(void* storage, const void* src) {
+        ::new (storage) T(*static_cast<const T*>(src));
+    }
+    
+    /**
+     * @brief Raw destructor matching construct_impl
+     */
+    static void destroy_impl(void* ptr) noexcept {
+        static_cast<T*>(ptr)->~T();
+    }
 };
 
+namespace detail {
+
+template<typename M>
+struct member_pointer_class;
+
+template<typename U, typename C>
+struct member_pointer_class<U C::*> {
+    using type = C;
+};
+
+/**
+ * @brief Member describer for a StaticMemberRecord (same MemberInfo as property())
+ */
+template<auto Member>
+MemberInfo describe_static_member(std::string_view name) {
+    using Class = typename member_pointer_class<decltype(Member)>::type;
+    return Registry<Class>::describe_member(name, Member);
+}
+
+/**
+ * @brief Method describer for a StaticMethodRecord (same MethodInfo as method())
+ */
+template<auto Method>
+MethodInfo describe_static_method(std::string_view name) {
+    using Class = typename member_pointer_class<decltype(Method)>::type;
+    return Registry<Class>::describe_method(name, Method);
+}
+
+/**
+ * @brief Build the constant record of T from its member and method tables
+ */
+template<Reflectable T>
+constexpr StaticTypeRecord static_type_record(std::span<const StaticMemberRecord> members = {},
+                                              std::span<const StaticMethodRecord> methods = {},
+                                              std::span<const ConstructorDescriber> constructors = {}) noexcept {
+    return StaticTypeRecord{type_name<T>(), type_id<T>, &typeid(T), &Registry<T>::describe_type,
+                            members, methods, constructors};
+}
+
+} // namespace detail
+
 } // namespace rttm
 
+/**
+ * @brief StaticMemberRecord entry for a data member pointer
+ */
+#define RTTM_STATIC_MEMBER(name, ...) \
+    ::rttm::detail::StaticMemberRecord{name, &::rttm::detail::describe_static_member<__VA_ARGS__>}
+
+/**
+ * @brief StaticMethodRecord entry for a member function pointer (cast to pick an overload)
+ */
+#define RTTM_STATIC_METHOD(name, ...) \
+    ::rttm::detail::StaticMethodRecord{name, &::rttm::detail::describe_static_method<__VA_ARGS__>}
+
+/**
+ * @brief ConstructorDescriber entry for T's constructor taking the given argument types
+ */
+#define RTTM_STATIC_CONSTRUCTOR(T, ...) \
+    &::rttm::Registry<T>::template describe_constructor<__VA_ARGS__>
+
 #endif // RTTM_DETAIL_REGISTRY_HPP
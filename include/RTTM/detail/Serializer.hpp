@@ -0,0 +1,166 @@
+/**
+ * @file Serializer.hpp
+ * @brief Compact binary serializer driven by TypeInfo
+ *
+ * Each registered type is compiled once, on first use, into a
+ * SerializationPlan:
+ * - Members are visited in offset order
+ * - Runs of adjacent trivially copyable members merge into one memcpy
+ * - std::string, registered classes and containers become nested steps;
+ *   containers are walked through their ContainerOps (no per-element RType)
+ *
+ * Wire format (native endianness, not self-describing; both sides must
+ * register the same members):
+ * - trivially copyable value: its bytes
+ * - std::string: LEB128 length, then the characters
+ * - class: its members in offset order
+ * - container: LEB128 element count, then each element (maps: key, value);
+ *   contiguous containers of trivially copyable elements are one block
+ *
+ * Usage:
+ * @code
+ * std::array<std::byte, 256> buffer;
+ * std::size_t n = rttm::serialize(player, buffer);
+ *
+ * Player copy;
+ * rttm::deserialize(copy, std::span{buffer}.first(n));
+ * @endcode
+ *
+ * Register types completely before their first serialization; plans are
+ * not rebuilt afterwards.
+ */
+
+#ifndef RTTM_DETAIL_SERIALIZER_HPP
+#define RTTM_DETAIL_SERIALIZER_HPP
+
+#include "TypeInfo.hpp"
+#include "TypeManager.hpp"
+#include "TypeTraits.hpp"
+#include "ContainerView.hpp"
+#include "Exceptions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace rttm {
+
+namespace detail {
+
+struct SerializationPlan;
+
+/**
+ * @brief Encoding of one non-trivial value (string, class or container)
+ */
+struct ValuePlan {
+    const TypeCodec* codec = nullptr;
+    const SerializationPlan* class_plan = nullptr;  ///< Class values
+    const ValuePlan* key = nullptr;                 ///< Container keys (associative only)
+    const ValuePlan* value = nullptr;               ///< Container elements (mapped values for maps)
+    std::size_t min_size = 0;                       ///< Smallest possible encoding in bytes
+};
+
+/**
+ * @brief One step of a class plan
+ *
+ * value == nullptr means a raw copy of size bytes at offset (one or more
+ * merged trivially copyable members).
+ */
+struct PlanStep {
+    std::uint32_t offset = 0;
+    std::uint32_t size = 0;
+    const ValuePlan* value = nullptr;
+};
+
+/**
+ * @brief Compiled serialization plan of a registered type
+ */
+struct SerializationPlan {
+    const TypeInfo* type = nullptr;
+    std::vector<PlanStep> steps;
+    std::size_t min_size = 0;
+    bool valid = false;
+    std::string error;              ///< Why the type can't be serialized (if !valid)
+};
+
+/**
+ * @brief Get (building on first use) the plan for a registered type
+ * @throws SerializationError if a member has no binary encoding
+ */
+[[nodiscard]] const SerializationPlan& serialization_plan(const TypeInfo& type);
+
+/**
+ * @brief Append the encoding of a single non-trivial value
+ */
+void serialize_value(const void* obj, const ValuePlan& plan, std::vector<std::byte>& out);
+
+/**
+ * @brief Decode a single value written by serialize_value
+ * @return Number of bytes consumed
+ * @throws SerializationError on truncated or malformed input
+ */
+std::size_t deserialize_value(void* obj, const ValuePlan& plan, std::span<const std::byte> in);
+
+template<typename T>
+[[nodiscard]] const TypeInfo& require_type_info() {
+    const TypeInfo* info = TypeManager::instance().get_type_by_id(type_id<T>);
+    if (!info) [[unlikely]] {
+        throw TypeNotRegisteredError(type_name<T>());
+    }
+    return *info;
+}
+
+} // namespace detail
+
+/**
+ * @brief Serialize an object into a caller-provided buffer
+ * @return Number of bytes written
+ * @throws SerializationError if the buffer is too small
+ */
+std::size_t serialize(const void* obj, const detail::TypeInfo& type, std::span<std::byte> out);
+
+/**
+ * @brief Exact number of bytes serialize() will write
+ */
+[[nodiscard]] std::size_t serialized_size(const void* obj, const detail::TypeInfo& type);
+
+/**
+ * @brief Serialize an object, appending to a byte vector
+ */
+void serialize_append(const void* obj, const detail::TypeInfo& type, std::vector<std::byte>& out);
+
+/**
+ * @brief Deserialize into an existing object
+ *
+ * Containers are cleared and refilled; other members are overwritten.
+ *
+ * @return Number of bytes consumed
+ * @throws SerializationError on truncated or malformed input
+ */
+std::size_t deserialize(void* obj, const detail::TypeInfo& type, std::span<const std::byte> in);
+
+template<typename T>
+std::size_t serialize(const T& obj, std::span<std::byte> out) {
+    return serialize(static_cast<const void*>(&obj), detail::require_type_info<T>(), out);
+}
+
+template<typename T>
+void serialize_append(const T& obj, std::vector<std::byte>& out) {
+    serialize_append(static_cast<const void*>(&obj), detail::require_type_info<T>(), out);
+}
+
+template<typename T>
+[[nodiscard]] std::size_t serialized_size(const T& obj) {
+    return serialized_size(static_cast<const void*>(&obj), detail::require_type_info<T>());
+}
+
+template<typename T>
+std::size_t deserialize(T& obj, std::span<const std::byte> in) {
+    return deserialize(static_cast<void*>(&obj), detail::require_type_info<T>(), in);
+}
+
+} // namespace rttm
+
+#endif // RTTM_DETAIL_SERIALIZER_HPP
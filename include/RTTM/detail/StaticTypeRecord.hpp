@@ -0,0 +1,85 @@
+/**
+ * @file StaticTypeRecord.hpp
+ * @brief Constant-initialized type records for generated registration
+ *
+ * A StaticTypeRecord describes one type as read-only data: its name, its
+ * TypeId and flat tables of member and method entries, each entry being a
+ * name plus a describer function pointer. Tables are constexpr, so they
+ * cost nothing at static initialization.
+ *
+ * TypeManager::register_static() only remembers the table. The TypeInfo
+ * of each record is materialized the first time a lookup of its type
+ * misses, so a binary with thousands of generated types does no per-type
+ * work (and no name allocation) until reflection is actually used, and
+ * then only for the types it touches.
+ *
+ * Usage (normally emitted by generate_reflection.py --static-records):
+ * @code
+ * constexpr rttm::detail::StaticMemberRecord player_members[] = {
+ *     RTTM_STATIC_MEMBER("hp", &Player::hp),
+ *     RTTM_STATIC_MEMBER("name", &Player::name),
+ * };
+ * constexpr rttm::detail::StaticMethodRecord player_methods[] = {
+ *     RTTM_STATIC_METHOD("heal", &Player::heal),
+ * };
+ * constexpr rttm::detail::ConstructorDescriber player_constructors[] = {
+ *     RTTM_STATIC_CONSTRUCTOR(Player, int),
+ * };
+ * constexpr rttm::detail::StaticTypeRecord types[] = {
+ *     rttm::detail::static_type_record<Player>(player_members, player_methods, player_constructors),
+ * };
+ * RTTM_STATIC_REGISTRATION(types)
+ * @endcode
+ */
+
+#ifndef RTTM_DETAIL_STATIC_TYPE_RECORD_HPP
+#define RTTM_DETAIL_STATIC_TYPE_RECORD_HPP
+
+#include "TypeInfo.hpp"
+#include "TypeTraits.hpp"
+
+#include <span>
+#include <string_view>
+#include <typeinfo>
+
+namespace rttm::detail {
+
+using TypeDescriber = TypeInfo(*)();
+using MemberDescriber = MemberInfo(*)(std::string_view name);
+using MethodDescriber = MethodInfo(*)(std::string_view name);
+using ConstructorDescriber = void(*)(TypeInfo& info);
+
+/**
+ * @brief One member of a static type record
+ */
+struct StaticMemberRecord {
+    std::string_view name;
+    MemberDescriber describe;
+};
+
+/**
+ * @brief One method (or overload) of a static type record
+ */
+struct StaticMethodRecord {
+    std::string_view name;
+    MethodDescriber describe;
+};
+
+/**
+ * @brief Read-only description of one registered type
+ *
+ * Referenced tables must have static storage duration.
+ */
+struct StaticTypeRecord {
+    std::string_view name;                       ///< type_name<T>()
+    TypeId type_id;
+    const std::type_info* type;                  ///< &typeid(T)
+    TypeDescriber describe;                      ///< Builds the bare TypeInfo (factories, destructor, ...)
+    std::span<const StaticMemberRecord> members;
+    std::span<const StaticMethodRecord> methods;
+    std::span<const ConstructorDescriber> constructors;
+};
+
+} // namespace rttm::detail
+
+#endif // RTTM_DETAIL_STATIC_TYPE_RECORD_HPP
@@ -6,6 +6,13 @@
  * - MemberInfo: Information about class member variables
  * - MethodInfo: Information about class methods
  * - TypeInfo: Complete type metadata including members, methods, and factories
+ *
+ * Once registration of a type is finished, TypeInfo::seal() compiles its
+ * members and methods into a PerfectHashTable for single-probe lookup.
+ *
+ * Members and methods inherited through Registry<T>::base() are flattened
+ * into the derived type with the base subobject offset already applied, so
+ * lookups on a deep hierarchy never walk base types at runtime.
  */
 
 #ifndef RTTM_DETAIL_TYPE_INFO_HPP
@@ -21,30 +28,35 @@
 #include <memory>
 #include <any>
 #include <span>
+#include <new>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <limits>
 
-namespace rttm::detail {
+#include "Name.hpp"
+#include "PerfectHashTable.hpp"
+#include "InplaceFunction.hpp"
+#include "Conversion.hpp"
+#include "ContainerView.hpp"
+#include "Exceptions.hpp"
+#include "Profiling.hpp"
 
-// FNV-1a hash for string_view
-constexpr std::size_t type_info_hash(std::string_view str) noexcept {
-    std::size_t hash = 14695981039346656037ULL;
-    for (char c : str) {
-        hash ^= static_cast<std::size_t>(c);
-        hash *= 1099511628211ULL;
-    }
-    return hash;
-}
+namespace rttm::detail {
 
 // Transparent hash for string_view lookups
 struct TransparentStringHash {
     using is_transparent = void;
     std::size_t operator()(std::string_view sv) const noexcept {
-        return type_info_hash(sv);
+        return fnv1a_hash(sv);
     }
     std::size_t operator()(const std::string& s) const noexcept {
-        return type_info_hash(std::string_view{s});
+        return fnv1a_hash(std::string_view{s});
     }
     std::size_t operator()(const char* s) const noexcept {
-        return type_info_hash(std::string_view{s});
+        return fnv1a_hash(std::string_view{s});
     }
 };
 
@@ -75,6 +87,29 @@ enum class MemberCategory {
     Associative     ///< Associative containers (map, set, unordered_map, etc.)
 };
 
+/**
+ * @brief Per-member dynamic accessor thunks
+ * 
+ * field points at the member inside an object; value points at a Variant.
+ * The getter copy-constructs the member into *value. The setter assigns
+ * *value to the member (converting arithmetic/enum values) and returns
+ * false if the Variant's type cannot be assigned.
+ */
+using MemberGetter = void(*)(const void* field, void* value);
+using MemberSetter = bool(*)(void* field, const void* value);
+
+/**
+ * @brief MemberInfo::dirty_word of members whose type does not track changes
+ */
+inline constexpr std::uint32_t no_dirty_word = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * @brief Returned by TypeInfo::member_ordinal()/method_ordinal() for unknown names
+ */
+inline constexpr std::uint32_t no_ordinal = std::numeric_limits<std::uint32_t>::max();
+
+struct ValueOps;
+
 /**
  * @brief Information about a class member variable
  * 
@@ -86,6 +121,16 @@ struct MemberInfo {
     std::type_index type_index;         ///< Type information for the member
     std::string type_name;              ///< Human-readable type name
     MemberCategory category;            ///< Category of the member type
+    const void* type_id = nullptr;      ///< TypeId of the member type (fast TypeManager lookup)
+    MemberGetter getter = nullptr;      ///< Read member into a Variant (nullptr if not copyable)
+    MemberSetter setter = nullptr;      ///< Assign member from a Variant (nullptr if not assignable)
+    ArithmeticKind arithmetic_kind = ArithmeticKind::None;  ///< Conversion matrix row (arithmetic/enum members)
+    const ContainerOps* container_ops = nullptr;            ///< Traversal table (container members only)
+    const TypeCodec* codec = nullptr;                       ///< Binary encoding of the member type
+    const ValueOps* value_ops = nullptr;                    ///< Placement lifetime operations of the member type
+    std::uint32_t ordinal = 0;                              ///< Dense index in registration order
+    std::uint32_t dirty_word = no_dirty_word;               ///< Object offset of the dirty bitset word holding this member
+    std::uint64_t dirty_mask = 0;                           ///< This member's bit in that word
     
     /**
      * @brief Default constructor
@@ -111,6 +156,14 @@ struct MemberInfo {
     {}
 };
 
+/**
+ * @brief Record a reflected write to member of obj (no-op unless its type tracks changes)
+ */
+inline void mark_dirty(const MemberInfo& member, void* obj) noexcept {
+    if (member.dirty_word != no_dirty_word) [[unlikely]] {
+        *reinterpret_cast<std::uint64_t*>(static_cast<char*>(obj) + member.dirty_word) |= member.dirty_mask;
+    }
+}
 
 /**
  * @brief Raw invoker function pointer type for maximum performance
@@ -120,12 +173,49 @@ struct MemberInfo {
  */
 using RawInvoker = std::any(*)(void* obj, std::span<std::any> args, void* method_ptr);
 
+/**
+ * @brief Type-erased callables kept by MethodInfo and TypeInfo
+ *
+ * InplaceFunction stores the callable inline (never allocates) and calls
+ * it through a single function pointer.
+ */
+using InvokerFn = InplaceFunction<std::any(void*, std::span<std::any>)>;
+using FactoryFn = InplaceFunction<std::shared_ptr<void>()>;
+using DestructorFn = InplaceFunction<void(void*)>;
+using CopierFn = InplaceFunction<void(void*, const void*)>;
+
 /**
  * @brief Variant-based invoker for pure dynamic path
  * The method_ptr parameter is the stored method pointer from MethodInfo.
  */
 using VariantInvoker = void(*)(void* obj, void* result, const void* const* args, std::size_t nargs, void* method_ptr);
 
+/**
+ * @brief Typed invoker with no type erasure of values
+ * 
+ * args[i] points at an object of exactly param_types[i]. The return value
+ * (decayed) is constructed in place into result, which must be suitably
+ * sized and aligned uninitialized storage (nullptr for void methods).
+ */
+using DirectInvoker = void(*)(void* obj, void* result, const void* const* args, const void* method_ptr);
+
+/**
+ * @brief Invoker for precompiled call sites
+ * 
+ * args[i] points at an object of exactly param_types[i]; the (decayed)
+ * return value is stored into the Variant result points at (nullptr to
+ * discard it).
+ */
+using ExactInvoker = void(*)(void* obj, const void* const* args, void* result, const void* method_ptr);
+
+/**
+ * @brief Starts a method returning an awaitable or std::future
+ * 
+ * args are Variant pointers as for VariantInvoker. state points at the
+ * std::shared_ptr<AsyncState> that receives the awaited value.
+ */
+using AsyncInvoker = void(*)(void* obj, const void* state, const void* const* args, std::size_t nargs, void* method_ptr);
+
 /**
  * @brief Information about a class method
  * 
@@ -134,14 +224,35 @@ using VariantInvoker = void(*)(void* obj, void* result, const void* const* args,
  */
 struct MethodInfo {
     std::string name;                                               ///< Name of the method
-    std::function<std::any(void*, std::span<std::any>)> invoker;   ///< Type-erased method invoker (fallback)
+    InvokerFn invoker;                                              ///< Type-erased method invoker (fallback)
     RawInvoker raw_invoker = nullptr;                               ///< Raw function pointer invoker (fast path)
     VariantInvoker variant_invoker = nullptr;                       ///< Direct variant invoker (fastest dynamic path)
-    void* method_ptr = nullptr;                                     ///< Stored method pointer (type-erased)
+    DirectInvoker direct_invoker = nullptr;                         ///< Typed invoker for exactly matching arguments
+    ExactInvoker exact_invoker = nullptr;                           ///< Typed arguments, Variant result (CallSite)
+    AsyncInvoker async_invoker = nullptr;                           ///< Non-blocking invoker (awaitable return types only)
+    void* method_ptr = nullptr;                                     ///< Points at the stored method pointer (type-erased)
+    std::shared_ptr<void> method_storage;                           ///< Owns the storage method_ptr points at
     std::vector<std::type_index> param_types;                       ///< Parameter type information
+    std::vector<ArithmeticKind> param_kinds;                        ///< Arithmetic kind per parameter (None if not arithmetic)
     std::type_index return_type;                                    ///< Return type information
     std::string return_type_name;                                   ///< Human-readable return type name
     bool is_const;                                                  ///< Whether this is a const method
+    std::size_t this_offset = 0;                                    ///< Base subobject offset (inherited methods)
+    std::uint32_t ordinal = 0;                                      ///< Dense index of the name in registration order (shared by overloads)
+    
+    /**
+     * @brief Adjust a pointer to the registering type into the method's `this`
+     */
+    [[nodiscard]] void* adjust_this(void* obj) const noexcept {
+        return static_cast<char*>(obj) + this_offset;
+    }
+    
+    /**
+     * @brief Whether the method returns an awaitable (see invoke_async)
+     */
+    [[nodiscard]] bool is_async() const noexcept {
+        return async_invoker != nullptr;
+    }
     
     /**
      * @brief Default constructor
@@ -151,6 +262,7 @@ struct MethodInfo {
         , invoker{}
         , raw_invoker{nullptr}
         , variant_invoker{nullptr}
+        , direct_invoker{nullptr}
         , method_ptr{nullptr}
         , param_types{}
         , return_type{typeid(void)}
@@ -162,7 +274,7 @@ struct MethodInfo {
      * @brief Construct MethodInfo with all fields
      */
     MethodInfo(std::string_view n, 
-               std::function<std::any(void*, std::span<std::any>)> inv,
+               InvokerFn inv,
                std::vector<std::type_index> params,
                std::type_index ret_type,
                std::string_view ret_name,
@@ -181,9 +293,85 @@ struct MethodInfo {
      */
     [[nodiscard]] std::any call(void* obj, std::span<std::any> args) const {
         if (raw_invoker) [[likely]] {
-            return raw_invoker(obj, args, method_ptr);
+            return raw_invoker(adjust_this(obj), args, method_ptr);
+        }
+        RTTM_PROFILE_SCOPE(InvokerFallback, std::string_view{}, name);
+        return invoker(adjust_this(obj), args);
+    }
+    
+    /**
+     * @brief Check whether call_direct<R>(obj, args...) can be used
+     * 
+     * True when the argument types (after removing cv/ref) and the
+     * requested return type match the registered signature exactly, so no
+     * conversion is required.
+     */
+    template<typename R, typename... Args>
+    [[nodiscard]] bool matches_exactly() const noexcept {
+        if (!direct_invoker || param_types.size() != sizeof...(Args)) {
+            return false;
+        }
+        if constexpr (std::is_reference_v<R>) {
+            return false;
+        } else {
+            if (return_type != std::type_index(typeid(R))) {
+                return false;
+            }
+            [[maybe_unused]] std::size_t i = 0;
+            return ((param_types[i++] == std::type_index(typeid(std::remove_cvref_t<Args>))) && ...);
+        }
+    }
+    
+    /**
+     * @brief Invoke through the direct invoker (requires matches_exactly)
+     * 
+     * Arguments are passed by address and the result is constructed in a
+     * local buffer, so no std::any is created and nothing is allocated.
+     */
+    template<typename R, typename... Args>
+    R call_direct(void* obj, Args&&... args) const {
+        const void* argv[sizeof...(Args) > 0 ? sizeof...(Args) : 1] = {
+            static_cast<const void*>(std::addressof(args))...
+        };
+        if constexpr (std::is_void_v<R>) {
+            direct_invoker(adjust_this(obj), nullptr, argv, method_ptr);
+        } else {
+            alignas(R) unsigned char storage[sizeof(R)];
+            direct_invoker(adjust_this(obj), storage, argv, method_ptr);
+            R* ret = std::launder(reinterpret_cast<R*>(storage));
+            R out = std::move(*ret);
+            ret->~R();
+            return out;
         }
-        return invoker(obj, args);
+    }
+};
+
+/**
+ * @brief Marks a base reachable through more than one subobject
+ */
+inline constexpr std::ptrdiff_t ambiguous_base_offset = PTRDIFF_MIN;
+
+/**
+ * @brief Precomputed pointer adjustment between two related types
+ *
+ * Upcasts add the base subobject offset, downcasts subtract it. Like
+ * static_cast, a downcast does not check the dynamic type of the object.
+ */
+struct TypeCast {
+    std::ptrdiff_t offset = 0;
+    bool valid = false;
+    
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return valid; }
+    
+    /**
+     * @brief Apply to an object pointer (nullptr if the cast is invalid)
+     */
+    [[nodiscard]] void* apply(void* obj) const noexcept {
+        return valid && obj ? static_cast<char*>(obj) + offset : nullptr;
+    }
+    
+    [[nodiscard]] const void* apply(const void* obj) const noexcept {
+        return valid && obj ? static_cast<const char*>(obj) + offset : nullptr;
     }
 };
 
@@ -192,6 +380,115 @@ struct MethodInfo {
  */
 using RawFactory = std::shared_ptr<void>(*)();
 
+/**
+ * @brief Raw placement construct/destroy function pointer types
+ *
+ * Used for in-place creation into caller-provided storage (arenas,
+ * memory resources) without a shared_ptr control block.
+ */
+using RawConstruct = void(*)(void*);
+using RawDestroy = void(*)(void*) noexcept;
+using RawCopy = void(*)(void* dest, const void* src);
+
+/**
+ * @brief Placement lifetime operations of a member type (one constexpr table per type)
+ *
+ * Lets containers such as ReflectedColumns keep member values outside
+ * their object. An operation the type does not support is nullptr.
+ */
+struct ValueOps {
+    std::size_t size;                                   ///< sizeof(T)
+    std::size_t alignment;                              ///< alignof(T)
+    bool trivially_copyable;                            ///< All operations are memset/memcpy
+    bool nothrow_move;                                  ///< move_construct cannot throw
+    void (*construct)(void* storage);                   ///< Value-initialize
+    void (*copy_construct)(void* storage, const void* src);
+    void (*move_construct)(void* storage, void* src);
+    void (*assign)(void* dest, const void* src);        ///< Copy-assign
+    void (*destroy)(void* obj) noexcept;
+};
+
+template<typename T>
+struct ValueOpsImpl {
+    static constexpr bool trivial = std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>;
+    
+    static void construct(void* storage) {
+        if constexpr (trivial) {
+            std::memset(storage, 0, sizeof(T));
+        } else {
+            ::new (storage) T();
+        }
+    }
+    
+    static void copy_construct(void* storage, const void* src) {
+        if constexpr (trivial) {
+            std::memcpy(storage, src, sizeof(T));
+        } else {
+            ::new (storage) T(*static_cast<const T*>(src));
+        }
+    }
+    
+    static void move_construct(void* storage, void* src) {
+        if constexpr (trivial) {
+            std::memcpy(storage, src, sizeof(T));
+        } else {
+            ::new (storage) T(std::move(*static_cast<T*>(src)));
+        }
+    }
+    
+    static void assign(void* dest, const void* src) {
+        if constexpr (trivial) {
+            std::memcpy(dest, src, sizeof(T));
+        } else {
+            *static_cast<T*>(dest) = *static_cast<const T*>(src);
+        }
+    }
+    
+    static void destroy(void* obj) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy_at(static_cast<T*>(obj));
+        }
+    }
+    
+    // Only instantiate the operations T supports
+    static constexpr auto construct_fn() noexcept {
+        if constexpr (trivial || (!std::is_array_v<T> && std::is_default_constructible_v<T>)) return &construct;
+        else return static_cast<void(*)(void*)>(nullptr);
+    }
+    static constexpr auto copy_construct_fn() noexcept {
+        if constexpr (trivial || (!std::is_array_v<T> && std::is_copy_constructible_v<T>)) return &copy_construct;
+        else return static_cast<void(*)(void*, const void*)>(nullptr);
+    }
+    static constexpr auto move_construct_fn() noexcept {
+        if constexpr (trivial || (!std::is_array_v<T> && std::is_move_constructible_v<T>)) return &move_construct;
+        else return static_cast<void(*)(void*, void*)>(nullptr);
+    }
+    static constexpr auto assign_fn() noexcept {
+        if constexpr (trivial || std::is_copy_assignable_v<T>) return &assign;
+        else return static_cast<void(*)(void*, const void*)>(nullptr);
+    }
+    
+    static constexpr ValueOps ops = {
+        sizeof(T),
+        alignof(T),
+        trivial,
+        trivial || std::is_nothrow_move_constructible_v<T>,
+        construct_fn(),
+        copy_construct_fn(),
+        move_construct_fn(),
+        assign_fn(),
+        &destroy
+    };
+};
+
+/**
+ * @brief Lifetime operations table for T
+ */
+template<typename T>
+[[nodiscard]] constexpr const ValueOps* value_ops_for() noexcept {
+    return &ValueOpsImpl<std::remove_cv_t<T>>::ops;
+}
+
 // Transparent map types for string_view lookups without allocation
 template<typename V>
 using TransparentStringMap = std::unordered_map<std::string, V, TransparentStringHash, TransparentStringEqual>;
@@ -206,6 +503,11 @@ using TransparentStringMap = std::unordered_map<std::string, V, TransparentStrin
  * - Factory functions for object creation
  * - Destructor and copy functions
  * - Inheritance information
+ *
+ * Lookup structures are built eagerly by seal() and const member functions
+ * never modify the TypeInfo, so any number of threads may read a registered
+ * type concurrently. Registration (add_member/add_method/seal) must not
+ * overlap with readers of the same type.
  */
 struct TypeInfo {
     std::string name;                                                           ///< Type name
@@ -214,37 +516,31 @@ struct TypeInfo {
     
     TransparentStringMap<MemberInfo> members;                                   ///< Member variables by name
     TransparentStringMap<std::vector<MethodInfo>> methods;                      ///< Methods by name (vector for overloads)
-    TransparentStringMap<std::function<std::shared_ptr<void>()>> factories;     ///< Factory functions by signature
+    TransparentStringMap<FactoryFn> factories;                                  ///< Factory functions by signature
     
-    std::function<void(void*)> destructor;                                      ///< Type-erased destructor
-    std::function<void(void*, const void*)> copier;                             ///< Type-erased copy function
+    DestructorFn destructor;                                                    ///< Type-erased destructor
+    CopierFn copier;                                                            ///< Type-erased copy function
     
     std::vector<std::type_index> base_types;                                    ///< Base class type indices
+    std::unordered_map<std::type_index, std::ptrdiff_t> base_offsets;           ///< Direct and indirect bases -> subobject offset
     
     // Fast path: cached raw function pointer for default factory
     RawFactory default_factory_raw = nullptr;
     
-    // Cached name lists for fast enumeration
-    mutable std::vector<std::string_view> cached_member_names_;
-    mutable std::vector<std::string_view> cached_method_names_;
-    mutable bool member_names_cached_ = false;
-    mutable bool method_names_cached_ = false;
-    
-    // Hash-based member cache for O(1) lookup
-    // Using flat array for small member counts (common case)
-    static constexpr std::size_t INLINE_CACHE_SIZE = 16;
-    struct CacheEntry {
-        std::size_t hash = 0;
-        const MemberInfo* info = nullptr;
-    };
-    mutable std::array<CacheEntry, INLINE_CACHE_SIZE> member_inline_cache_{};
-    mutable std::array<CacheEntry, INLINE_CACHE_SIZE> method_inline_cache_{};
-    mutable std::unordered_map<std::size_t, const MemberInfo*> member_hash_cache_;
-    mutable std::unordered_map<std::size_t, const std::vector<MethodInfo>*> method_hash_cache_;
-    mutable bool member_cache_built_ = false;
-    mutable bool method_cache_built_ = false;
-    mutable bool use_inline_member_cache_ = false;
-    mutable bool use_inline_method_cache_ = false;
+    // In-place creation: placement default-construct and destroy
+    std::size_t alignment = alignof(std::max_align_t);                         ///< Alignment of the type
+    RawConstruct default_construct_raw = nullptr;                               ///< Placement default constructor
+    RawDestroy destructor_raw = nullptr;                                        ///< Raw destructor (no type erasure)
+    RawCopy copy_construct_raw = nullptr;                                       ///< Placement copy constructor
+    
+    // Bulk fast paths: construct_n/copy_n/destroy_n collapse to memset/memcpy/no-op
+    bool zero_constructible = false;                                            ///< Value-initialization is all zero bytes
+    bool trivially_copyable = false;                                            ///< Copies are memcpy
+    bool trivially_destructible = false;                                        ///< Destruction is a no-op
+    
+    // Change tracking: DirtyBits member set up by Registry<T>::track_changes
+    std::uint32_t dirty_offset = no_dirty_word;                                 ///< Offset of the DirtyBits words
+    std::size_t dirty_capacity = 0;                                             ///< Ordinals the DirtyBits can hold
     
     /**
      * @brief Default constructor
@@ -276,228 +572,445 @@ struct TypeInfo {
         , base_types{}
     {}
     
+    TypeInfo(TypeInfo&&) noexcept = default;
+    TypeInfo& operator=(TypeInfo&&) noexcept = default;
+    
+    // Name lists and the sealed table refer into members/methods nodes,
+    // which survive moves but not copies
+    TypeInfo(const TypeInfo&) = delete;
+    TypeInfo& operator=(const TypeInfo&) = delete;
+    
+    /**
+     * @brief Add or replace a member (unseals the type)
+     */
+    void add_member(MemberInfo member) {
+        unseal();
+        auto existing = members.find(member.name);
+        member.ordinal = existing != members.end() ? existing->second.ordinal
+                                                    : static_cast<std::uint32_t>(members.size());
+        assign_dirty_bit(member);
+        auto [it, inserted] = members.insert_or_assign(member.name, std::move(member));
+        if (inserted) {
+            member_names_.push_back(it->first);
+            member_layout_.push_back(&it->second);
+            member_ordinals_.push_back(&it->second);
+        }
+    }
+    
+    /**
+     * @brief Track reflected writes in the DirtyBits at offset (see DirtyBits.hpp)
+     *
+     * Applies to members registered before and after the call.
+     *
+     * @throws ReflectionError if the type has more members than capacity
+     */
+    void enable_change_tracking(std::size_t offset, std::size_t capacity) {
+        dirty_offset = static_cast<std::uint32_t>(offset);
+        dirty_capacity = capacity;
+        for (auto& [n, member] : members) {
+            assign_dirty_bit(member);
+        }
+    }
+    
+    /**
+     * @brief Whether reflected writes record dirty bits
+     */
+    [[nodiscard]] bool tracks_changes() const noexcept {
+        return dirty_offset != no_dirty_word;
+    }
+    
+    /**
+     * @brief Record a (direct or indirect) base subobject at the given offset
+     *
+     * A base reached again at a different offset (non-virtual diamond) is
+     * marked ambiguous and can no longer be cast to.
+     */
+    void add_base(std::type_index base, std::ptrdiff_t offset) {
+        auto [it, inserted] = base_offsets.try_emplace(base, offset);
+        if (!inserted && it->second != offset) {
+            it->second = ambiguous_base_offset;
+        }
+    }
+    
+    /**
+     * @brief Pointer adjustment from this type to target (O(1))
+     *
+     * Valid for the type itself, an unambiguous base (upcast) or a type
+     * deriving from this one (downcast).
+     */
+    [[nodiscard]] TypeCast cast_to(const TypeInfo& target) const noexcept {
+        if (&target == this || target.type_index == type_index) {
+            return {0, true};
+        }
+        if (auto it = base_offsets.find(target.type_index); it != base_offsets.end()) {
+            return {it->second, it->second != ambiguous_base_offset};
+        }
+        if (auto it = target.base_offsets.find(type_index); it != target.base_offsets.end()) {
+            return {-it->second, it->second != ambiguous_base_offset};
+        }
+        return {};
+    }
+    
+    /**
+     * @brief Add a method overload (unseals the type)
+     */
+    void add_method(MethodInfo method) {
+        unseal();
+        auto it = methods.find(method.name);
+        if (it == methods.end()) {
+            it = methods.emplace(method.name, std::vector<MethodInfo>{}).first;
+            method_names_.push_back(it->first);
+            method_ordinals_.push_back(&it->second);
+        }
+        method.ordinal = it->second.empty() ? static_cast<std::uint32_t>(method_names_.size() - 1)
+                                            : it->second.front().ordinal;
+        it->second.push_back(std::move(method));
+    }
+    
+    /**
+     * @brief Compile members and methods into the sealed lookup table
+     * 
+     * Called by Registry<T> once a registration chain is complete. After
+     * sealing, find_member()/find_methods() cost one hash and one compare.
+     * Adding members or methods afterwards unseals the type until the
+     * next seal().
+     */
+    void seal() {
+        std::vector<PerfectHashTable::Key> keys;
+        keys.reserve(members.size() + methods.size());
+        for (const auto& [n, info] : members) {
+            keys.push_back({n, fnv1a_hash(n), LookupKind::Member, &info});
+        }
+        for (const auto& [n, overloads] : methods) {
+            keys.push_back({n, fnv1a_hash(n), LookupKind::Method, &overloads});
+        }
+        sealed_ = lookup_table_.build(keys);
+        std::stable_sort(member_layout_.begin(), member_layout_.end(),
+                         [](const MemberInfo* a, const MemberInfo* b) { return a->offset < b->offset; });
+    }
+    
+    /**
+     * @brief Drop the sealed table; lookups fall back to the maps
+     */
+    void unseal() noexcept {
+        sealed_ = false;
+        lookup_table_.clear();
+    }
+    
+    /**
+     * @brief Check whether the sealed lookup table is active
+     */
+    [[nodiscard]] bool is_sealed() const noexcept {
+        return sealed_;
+    }
+    
+    /**
+     * @brief Default-construct an object in caller-provided storage
+     * 
+     * The storage must be at least size bytes aligned to alignment.
+     * 
+     * @return false if the type has no default constructor
+     */
+    bool construct_at(void* storage) const {
+        if (!default_construct_raw) [[unlikely]] return false;
+        default_construct_raw(storage);
+        return true;
+    }
+    
+    /**
+     * @brief Destroy an object created with construct_at (storage is not freed)
+     */
+    void destroy_at(void* obj) const noexcept {
+        if (destructor_raw) [[likely]] {
+            destructor_raw(obj);
+        } else if (destructor) {
+            destructor(obj);
+        }
+    }
+    
+    /**
+     * @brief Copy-construct an object from src into caller-provided storage
+     * 
+     * @return false if the type is not copy constructible
+     */
+    bool copy_construct_at(void* storage, const void* src) const {
+        if (copy_construct_raw) [[likely]] {
+            copy_construct_raw(storage, src);
+        } else if (copier) {
+            copier(storage, src);
+        } else {
+            return false;
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Default-construct count contiguous objects (stride size)
+     * 
+     * Objects already constructed are destroyed if a constructor throws.
+     * 
+     * @return false if the type has no default constructor
+     */
+    bool construct_n(void* storage, std::size_t count) const {
+        if (!default_construct_raw) [[unlikely]] return false;
+        if (zero_constructible) {
+            if (count) std::memset(storage, 0, count * size);
+            return true;
+        }
+        char* base = static_cast<char*>(storage);
+        std::size_t constructed = 0;
+        try {
+            for (; constructed < count; ++constructed) {
+                default_construct_raw(base + constructed * size);
+            }
+        } catch (...) {
+            destroy_n(storage, constructed);
+            throw;
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Copy-construct count contiguous objects from src (stride size)
+     * 
+     * The ranges must not overlap. Objects already constructed are
+     * destroyed if a copy constructor throws.
+     * 
+     * @return false if the type is not copy constructible
+     */
+    bool copy_n(void* dest, const void* src, std::size_t count) const {
+        if (!copy_construct_raw && !copier) [[unlikely]] return false;
+        if (trivially_copyable) {
+            if (count) std::memcpy(dest, src, count * size);
+            return true;
+        }
+        char* out = static_cast<char*>(dest);
+        const char* in = static_cast<const char*>(src);
+        std::size_t constructed = 0;
+        try {
+            for (; constructed < count; ++constructed) {
+                copy_construct_at(out + constructed * size, in + constructed * size);
+            }
+        } catch (...) {
+            destroy_n(dest, constructed);
+            throw;
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Destroy count contiguous objects in reverse order (storage is not freed)
+     */
+    void destroy_n(void* storage, std::size_t count) const noexcept {
+        if (trivially_destructible) return;
+        char* base = static_cast<char*>(storage);
+        for (std::size_t i = count; i > 0; --i) {
+            destroy_at(base + (i - 1) * size);
+        }
+    }
+    
     /**
      * @brief Check if a member exists (no allocation)
      */
     [[nodiscard]] bool has_member(std::string_view member_name) const {
-        return members.find(member_name) != members.end();
+        return find_member(member_name) != nullptr;
     }
     
     /**
      * @brief Check if a method exists (no allocation)
      */
     [[nodiscard]] bool has_method(std::string_view method_name) const {
-        return methods.find(method_name) != methods.end();
+        return find_methods(method_name) != nullptr;
+    }
+    
+    /**
+     * @brief Check if a member exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_member(Name member_name) const {
+        return find_member(member_name) != nullptr;
+    }
+    
+    /**
+     * @brief Check if a method exists (pre-hashed name)
+     */
+    [[nodiscard]] bool has_method(Name method_name) const {
+        return find_methods(method_name) != nullptr;
     }
     
     /**
-     * @brief Find member by name using hash cache (fastest)
+     * @brief Find member by name (sealed table, or map before sealing)
      */
     [[nodiscard]] const MemberInfo* find_member(std::string_view member_name) const {
-        // Build cache on first access
-        if (!member_cache_built_) [[unlikely]] {
-            build_member_cache();
-        }
-        
-        const std::size_t hash = type_info_hash(member_name);
-        
-        // Fast path: inline cache for small member counts
-        if (use_inline_member_cache_) [[likely]] {
-            const std::size_t idx = hash & (INLINE_CACHE_SIZE - 1);
-            if (member_inline_cache_[idx].hash == hash) [[likely]] {
-                return member_inline_cache_[idx].info;
-            }
-            // Linear probe
-            const std::size_t idx2 = (idx + 1) & (INLINE_CACHE_SIZE - 1);
-            if (member_inline_cache_[idx2].hash == hash) {
-                return member_inline_cache_[idx2].info;
-            }
-        } else {
-            auto it = member_hash_cache_.find(hash);
-            if (it != member_hash_cache_.end()) [[likely]] {
-                return it->second;
-            }
+        if (sealed_) [[likely]] {
+            return static_cast<const MemberInfo*>(
+                lookup_table_.find(fnv1a_hash(member_name), LookupKind::Member, member_name));
+        }
+        RTTM_PROFILE_SCOPE(MemberLookupFallback, name, member_name);
+        auto it = members.find(member_name);
+        return it != members.end() ? &it->second : nullptr;
+    }
+    
+    /**
+     * @brief Find member by pre-hashed name (no hashing when sealed)
+     */
+    [[nodiscard]] const MemberInfo* find_member(Name member_name) const {
+        if (sealed_) [[likely]] {
+            return static_cast<const MemberInfo*>(
+                lookup_table_.find(member_name.hash(), LookupKind::Member, member_name.str()));
         }
-        
-        // Fallback for hash collision (rare)
-        auto map_it = members.find(member_name);
-        return map_it != members.end() ? &map_it->second : nullptr;
+        RTTM_PROFILE_SCOPE(MemberLookupFallback, name, member_name.str());
+        auto it = members.find(member_name.str());
+        return it != members.end() ? &it->second : nullptr;
     }
     
     /**
-     * @brief Find member by pre-computed hash (fastest path)
+     * @brief Find member by pre-computed hash (name not verified)
      */
     [[nodiscard]] const MemberInfo* find_member_by_hash(std::size_t hash) const {
-        if (!member_cache_built_) [[unlikely]] {
-            build_member_cache();
+        if (sealed_) [[likely]] {
+            return static_cast<const MemberInfo*>(lookup_table_.find(hash, LookupKind::Member));
         }
-        auto it = member_hash_cache_.find(hash);
-        return it != member_hash_cache_.end() ? it->second : nullptr;
+        for (const auto& [n, info] : members) {
+            if (fnv1a_hash(n) == hash) return &info;
+        }
+        return nullptr;
     }
     
     /**
-     * @brief Find methods by name using hash cache (fastest)
+     * @brief Find methods by name (sealed table, or map before sealing)
      */
     [[nodiscard]] const std::vector<MethodInfo>* find_methods(std::string_view method_name) const {
-        // Build cache on first access
-        if (!method_cache_built_) [[unlikely]] {
-            build_method_cache();
-        }
-        
-        const std::size_t hash = type_info_hash(method_name);
-        
-        // Fast path: inline cache for small method counts
-        if (use_inline_method_cache_) [[likely]] {
-            const std::size_t idx = hash & (INLINE_CACHE_SIZE - 1);
-            if (method_inline_cache_[idx].hash == hash) [[likely]] {
-                return reinterpret_cast<const std::vector<MethodInfo>*>(method_inline_cache_[idx].info);
-            }
-            // Linear probe
-            const std::size_t idx2 = (idx + 1) & (INLINE_CACHE_SIZE - 1);
-            if (method_inline_cache_[idx2].hash == hash) {
-                return reinterpret_cast<const std::vector<MethodInfo>*>(method_inline_cache_[idx2].info);
-            }
-        } else {
-            auto it = method_hash_cache_.find(hash);
-            if (it != method_hash_cache_.end()) [[likely]] {
-                return it->second;
-            }
+        if (sealed_) [[likely]] {
+            return static_cast<const std::vector<MethodInfo>*>(
+                lookup_table_.find(fnv1a_hash(method_name), LookupKind::Method, method_name));
         }
-        
-        // Fallback for hash collision (rare)
-        auto map_it = methods.find(method_name);
-        return map_it != methods.end() ? &map_it->second : nullptr;
+        auto it = methods.find(method_name);
+        return it != methods.end() ? &it->second : nullptr;
     }
     
     /**
-     * @brief Find methods by pre-computed hash (fastest path)
+     * @brief Find methods by pre-hashed name (no hashing when sealed)
      */
-    [[nodiscard]] const std::vector<MethodInfo>* find_methods_by_hash(std::size_t hash) const {
-        if (!method_cache_built_) [[unlikely]] {
-            build_method_cache();
+    [[nodiscard]] const std::vector<MethodInfo>* find_methods(Name method_name) const {
+        if (sealed_) [[likely]] {
+            return static_cast<const std::vector<MethodInfo>*>(
+                lookup_table_.find(method_name.hash(), LookupKind::Method, method_name.str()));
         }
-        auto it = method_hash_cache_.find(hash);
-        return it != method_hash_cache_.end() ? it->second : nullptr;
+        auto it = methods.find(method_name.str());
+        return it != methods.end() ? &it->second : nullptr;
     }
     
     /**
-     * @brief Get all member names (cached)
+     * @brief Find methods by pre-computed hash (name not verified)
      */
-    [[nodiscard]] const std::vector<std::string_view>& member_names() const {
-        if (!member_names_cached_) [[unlikely]] {
-            cached_member_names_.clear();
-            cached_member_names_.reserve(members.size());
-            for (const auto& [n, _] : members) {
-                cached_member_names_.push_back(n);
-            }
-            member_names_cached_ = true;
+    [[nodiscard]] const std::vector<MethodInfo>* find_methods_by_hash(std::size_t hash) const {
+        if (sealed_) [[likely]] {
+            return static_cast<const std::vector<MethodInfo>*>(lookup_table_.find(hash, LookupKind::Method));
         }
-        return cached_member_names_;
+        for (const auto& [n, overloads] : methods) {
+            if (fnv1a_hash(n) == hash) return &overloads;
+        }
+        return nullptr;
     }
     
     /**
-     * @brief Get all method names (cached)
+     * @brief Get all member names in registration order
      */
-    [[nodiscard]] const std::vector<std::string_view>& method_names() const {
-        if (!method_names_cached_) [[unlikely]] {
-            cached_method_names_.clear();
-            cached_method_names_.reserve(methods.size());
-            for (const auto& [n, _] : methods) {
-                cached_method_names_.push_back(n);
-            }
-            method_names_cached_ = true;
-        }
-        return cached_method_names_;
+    [[nodiscard]] const std::vector<std::string_view>& member_names() const noexcept {
+        return member_names_;
     }
     
     /**
-     * @brief Invalidate cached name lists (call after adding members/methods)
+     * @brief All members (own and inherited) by ascending offset once sealed
+     *
+     * Registration order until the type is sealed.
      */
-    void invalidate_name_cache() {
-        member_names_cached_ = false;
-        method_names_cached_ = false;
+    [[nodiscard]] std::span<const MemberInfo* const> member_layout() const noexcept {
+        return member_layout_;
     }
     
     /**
-     * @brief Invalidate hash caches (call after adding members/methods)
+     * @brief Get all method names in registration order
      */
-    void invalidate_hash_cache() {
-        member_cache_built_ = false;
-        method_cache_built_ = false;
-        use_inline_member_cache_ = false;
-        use_inline_method_cache_ = false;
-        member_hash_cache_.clear();
-        method_hash_cache_.clear();
-        for (auto& entry : member_inline_cache_) entry = {};
-        for (auto& entry : method_inline_cache_) entry = {};
+    [[nodiscard]] const std::vector<std::string_view>& method_names() const noexcept {
+        return method_names_;
     }
-
-private:
+    
+    // ------------------------------------------------------------------------
+    // Ordinal access: members and method names are numbered densely in
+    // registration order (inherited ones first when base() comes first).
+    // An ordinal never changes once assigned, replacing a member keeps its
+    // ordinal, and ordinal i names member_names()[i] / method_names()[i].
+    // ------------------------------------------------------------------------
+    
+    [[nodiscard]] std::size_t member_count() const noexcept {
+        return member_ordinals_.size();
+    }
+    
+    [[nodiscard]] std::size_t method_count() const noexcept {
+        return method_ordinals_.size();
+    }
+    
     /**
-     * @brief Build member hash cache for O(1) lookup
+     * @brief Member by ordinal (one array index, nullptr if out of range)
      */
-    void build_member_cache() const {
-        // Use inline cache for small member counts
-        if (members.size() <= INLINE_CACHE_SIZE / 2) {
-            use_inline_member_cache_ = true;
-            for (auto& entry : member_inline_cache_) {
-                entry = {};
-            }
-            for (const auto& [name, info] : members) {
-                const std::size_t hash = type_info_hash(name);
-                const std::size_t idx = hash & (INLINE_CACHE_SIZE - 1);
-                if (member_inline_cache_[idx].info == nullptr) {
-                    member_inline_cache_[idx] = {hash, &info};
-                } else {
-                    // Linear probe
-                    const std::size_t idx2 = (idx + 1) & (INLINE_CACHE_SIZE - 1);
-                    member_inline_cache_[idx2] = {hash, &info};
-                }
-            }
-        } else {
-            use_inline_member_cache_ = false;
-            member_hash_cache_.clear();
-            member_hash_cache_.reserve(members.size());
-            for (const auto& [name, info] : members) {
-                const std::size_t hash = type_info_hash(name);
-                member_hash_cache_[hash] = &info;
-            }
-        }
-        member_cache_built_ = true;
+    [[nodiscard]] const MemberInfo* member_at(std::size_t ordinal) const noexcept {
+        return ordinal < member_ordinals_.size() ? member_ordinals_[ordinal] : nullptr;
     }
     
     /**
-     * @brief Build method hash cache for O(1) lookup
+     * @brief Overloads of a method by ordinal (nullptr if out of range)
      */
-    void build_method_cache() const {
-        // Use inline cache for small method counts
-        if (methods.size() <= INLINE_CACHE_SIZE / 2) {
-            use_inline_method_cache_ = true;
-            for (auto& entry : method_inline_cache_) {
-                entry = {};
-            }
-            for (const auto& [name, info_vec] : methods) {
-                const std::size_t hash = type_info_hash(name);
-                const std::size_t idx = hash & (INLINE_CACHE_SIZE - 1);
-                // Store pointer to vector in the info field (reinterpret)
-                if (method_inline_cache_[idx].info == nullptr) {
-                    method_inline_cache_[idx] = {hash, reinterpret_cast<const MemberInfo*>(&info_vec)};
-                } else {
-                    const std::size_t idx2 = (idx + 1) & (INLINE_CACHE_SIZE - 1);
-                    method_inline_cache_[idx2] = {hash, reinterpret_cast<const MemberInfo*>(&info_vec)};
-                }
-            }
-        } else {
-            use_inline_method_cache_ = false;
-            method_hash_cache_.clear();
-            method_hash_cache_.reserve(methods.size());
-            for (const auto& [name, info_vec] : methods) {
-                const std::size_t hash = type_info_hash(name);
-                method_hash_cache_[hash] = &info_vec;
-            }
+    [[nodiscard]] const std::vector<MethodInfo>* methods_at(std::size_t ordinal) const noexcept {
+        return ordinal < method_ordinals_.size() ? method_ordinals_[ordinal] : nullptr;
+    }
+    
+    /**
+     * @brief Ordinal of a member, or no_ordinal
+     */
+    [[nodiscard]] std::uint32_t member_ordinal(Name member_name) const {
+        const MemberInfo* member = find_member(member_name);
+        return member ? member->ordinal : no_ordinal;
+    }
+    
+    [[nodiscard]] std::uint32_t member_ordinal(std::string_view member_name) const {
+        return member_ordinal(Name{member_name});
+    }
+    
+    /**
+     * @brief Ordinal of a method name, or no_ordinal
+     */
+    [[nodiscard]] std::uint32_t method_ordinal(Name method_name) const {
+        const std::vector<MethodInfo>* overloads = find_methods(method_name);
+        return overloads ? overloads->front().ordinal : no_ordinal;
+    }
+    
+    [[nodiscard]] std::uint32_t method_ordinal(std::string_view method_name) const {
+        return method_ordinal(Name{method_name});
+    }
+
+private:
+    void assign_dirty_bit(MemberInfo& member) const {
+        if (!tracks_changes()) {
+            member.dirty_word = no_dirty_word;
+            member.dirty_mask = 0;
+            return;
+        }
+        if (member.ordinal >= dirty_capacity) [[unlikely]] {
+            throw ReflectionError("Type " + name + " has more members than its DirtyBits can track (" +
+                                  std::to_string(dirty_capacity) + ")");
         }
-        method_cache_built_ = true;
+        member.dirty_word = dirty_offset + static_cast<std::uint32_t>(member.ordinal / 64 * sizeof(std::uint64_t));
+        member.dirty_mask = std::uint64_t{1} << (member.ordinal % 64);
     }
+    
+    std::vector<std::string_view> member_names_;                                ///< Keys of members, registration order
+    std::vector<std::string_view> method_names_;                                ///< Keys of methods, registration order
+    std::vector<const MemberInfo*> member_layout_;                              ///< Members, offset order once sealed
+    std::vector<const MemberInfo*> member_ordinals_;                            ///< Members indexed by ordinal
+    std::vector<const std::vector<MethodInfo>*> method_ordinals_;               ///< Overload sets indexed by ordinal
+    PerfectHashTable lookup_table_;                                             ///< Sealed member/method table
+    bool sealed_ = false;
 };
 
 } // namespace rttm::detail
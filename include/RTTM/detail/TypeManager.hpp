@@ -7,6 +7,10 @@
  * - Type registration with duplicate detection
  * - Type lookup by name or type_index
  * - Hash-based fast lookup for string names
+ * - Lock-free lookup through an immutable snapshot once frozen
+ * - Per-type deferred materialization of constant StaticTypeRecord tables
+ * - Lazy per-type registration thunks run on first lookup
+ * - Per-module batch registration and epoch-based unregistration
  */
 
 #ifndef RTTM_DETAIL_TYPE_MANAGER_HPP
@@ -14,15 +18,50 @@
 
 #include "TypeInfo.hpp"
 #include "TypeTraits.hpp"
+#include "StaticTypeRecord.hpp"
+#include "InlineCache.hpp"
 
 #include <string>
 #include <string_view>
 #include <typeindex>
 #include <unordered_map>
 #include <shared_mutex>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <bit>
+#include <algorithm>
+#include <cstdint>
 #include <optional>
 #include <stdexcept>
 #include <array>
+#include <span>
+#include <deque>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#ifndef RTTM_API
+/**
+ * @brief Export attribute of out-of-line RTTM functions
+ * 
+ * Keeps TypeManager::instance() a single definition when RTTM is built as
+ * a shared library (RTTM_BUILD_SHARED), even if plugins compile with
+ * hidden visibility.
+ */
+#if defined(_WIN32) && defined(RTTM_SHARED)
+#ifdef RTTM_BUILDING
+#define RTTM_API __declspec(dllexport)
+#else
+#define RTTM_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__)
+#define RTTM_API __attribute__((visibility("default")))
+#else
+#define RTTM_API
+#endif
+#endif
 
 namespace rttm {
 // Forward declaration for exception
@@ -37,65 +76,268 @@ using TypeId = const void*;
 // Helper function to throw TypeNotRegisteredError (defined after exception class)
 [[noreturn]] inline void throw_type_not_registered(std::string_view type_name);
 
-// FNV-1a hash for string_view (compile-time capable)
-constexpr std::size_t fnv1a_hash(std::string_view str) noexcept {
-    std::size_t hash = 14695981039346656037ULL;
-    for (char c : str) {
-        hash ^= static_cast<std::size_t>(c);
-        hash *= 1099511628211ULL;
-    }
-    return hash;
-}
-
 // Use TransparentStringHash and TransparentStringEqual from TypeInfo.hpp
 
 /**
- * @brief Fast inline cache for hot path lookups
+ * @brief Deferred registration function of one type (runs Registry<T> chains)
+ */
+using LazyRegistrationFn = void(*)();
+
+/**
+ * @brief Registration function of one module (runs its Registry<T> chains)
+ */
+using ModuleRegistrationFn = void(*)();
+
+/**
+ * @brief Handle of a module published by TypeManager::load_module() (0 = none)
+ */
+using ModuleId = std::uint64_t;
+
+/**
+ * @brief Per-thread reader announcement used by TypeManager::unload_module()
+ */
+struct EpochReaderSlot {
+    std::atomic<std::uint64_t> pinned{0};   ///< Epoch pinned by the owner thread, 0 when not reading
+    std::atomic<bool> in_use{false};        ///< Owned by a live thread
+    std::uint32_t depth = 0;                ///< Guard nesting (owner thread only)
+    EpochReaderSlot* next = nullptr;        ///< Immutable once published
+};
+
+#ifndef RTTM_TYPE_CACHE_SETS
+/**
+ * @brief Number of sets of the per-thread type name cache (power of two)
+ * 
+ * Configure with the RTTM_TYPE_CACHE_SETS CMake option. Capacity is
+ * RTTM_TYPE_CACHE_SETS * RTTM_TYPE_CACHE_WAYS names per thread.
+ */
+#define RTTM_TYPE_CACHE_SETS 16
+#endif
+
+#ifndef RTTM_TYPE_CACHE_WAYS
+/**
+ * @brief Associativity of the per-thread type name cache
+ */
+#define RTTM_TYPE_CACHE_WAYS 4
+#endif
+
+/**
+ * @brief Hit/miss counters of the calling thread's type cache
+ */
+struct TypeCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;        ///< Valid entries replaced by an insert
+    std::uint64_t invalidations = 0;    ///< Flushes caused by a generation change
+};
+
+/**
+ * @brief Set-associative cache for hot path name lookups
+ * 
+ * The low hash bits select a set; the set's Ways entries are searched in
+ * order and kept in most-recently-inserted order, so the oldest entry is
+ * evicted. Entries are keyed by the 64-bit name hash and only inserted
+ * after the name was verified against the registered type.
  * 
- * Uses hash-based lookup with linear probing.
- * Much faster than unordered_map for small number of entries.
+ * Each cache remembers the TypeManager generation it was filled under and
+ * flushes itself when the generation moves on, which lets one thread
+ * invalidate the caches of every thread.
  */
-template<std::size_t N = 16>
-class FastTypeCache {
+template<std::size_t Sets = RTTM_TYPE_CACHE_SETS, std::size_t Ways = RTTM_TYPE_CACHE_WAYS>
+class TypeCache {
+    static_assert(Sets > 0 && (Sets & (Sets - 1)) == 0, "TypeCache set count must be a power of two");
+    static_assert(Ways > 0, "TypeCache needs at least one way");
+    
 public:
+    static constexpr std::size_t sets = Sets;
+    static constexpr std::size_t ways = Ways;
+    static constexpr std::size_t capacity = Sets * Ways;
+    
     struct Entry {
         std::size_t hash = 0;
         const TypeInfo* info = nullptr;
     };
     
-    const TypeInfo* find(std::size_t hash) const noexcept {
-        const std::size_t idx = hash & (N - 1);
-        // Check primary slot
-        if (entries_[idx].hash == hash) [[likely]] {
-            return entries_[idx].info;
-        }
-        // Linear probe (one step)
-        const std::size_t idx2 = (idx + 1) & (N - 1);
-        if (entries_[idx2].hash == hash) {
-            return entries_[idx2].info;
+    /**
+     * @brief Look up a name under the given generation
+     * @return Cached TypeInfo, nullptr on miss (counted)
+     */
+    const TypeInfo* find(std::size_t hash, std::uint64_t generation) noexcept {
+        if (generation != generation_) [[unlikely]] {
+            flush(generation);
+        } else {
+            const auto& set = sets_[hash & (Sets - 1)];
+            for (const Entry& entry : set) {
+                if (entry.hash == hash && entry.info) [[likely]] {
+                    ++stats_.hits;
+                    return entry.info;
+                }
+            }
         }
+        ++stats_.misses;
         return nullptr;
     }
     
-    void insert(std::size_t hash, const TypeInfo* info) noexcept {
-        const std::size_t idx = hash & (N - 1);
-        if (entries_[idx].info == nullptr || entries_[idx].hash == hash) {
-            entries_[idx] = {hash, info};
-            return;
+    /**
+     * @brief Insert an entry at the front of its set, evicting the oldest
+     */
+    void insert(std::size_t hash, const TypeInfo* info, std::uint64_t generation) noexcept {
+        if (generation != generation_) [[unlikely]] {
+            flush(generation);
+        }
+        auto& set = sets_[hash & (Sets - 1)];
+        if (set[Ways - 1].info) {
+            ++stats_.evictions;
         }
-        // Linear probe
-        const std::size_t idx2 = (idx + 1) & (N - 1);
-        entries_[idx2] = {hash, info};
+        for (std::size_t i = Ways - 1; i > 0; --i) {
+            set[i] = set[i - 1];
+        }
+        set[0] = {hash, info};
     }
     
     void clear() noexcept {
-        for (auto& e : entries_) {
-            e = {};
+        for (auto& set : sets_) {
+            set.fill(Entry{});
         }
     }
+    
+    [[nodiscard]] const TypeCacheStats& stats() const noexcept { return stats_; }
+    void reset_stats() noexcept { stats_ = {}; }
 
 private:
-    std::array<Entry, N> entries_{};
+    void flush(std::uint64_t generation) noexcept {
+        clear();
+        generation_ = generation;
+        ++stats_.invalidations;
+    }
+    
+    std::array<std::array<Entry, Ways>, Sets> sets_{};
+    std::uint64_t generation_ = 0;
+    TypeCacheStats stats_;
+};
+
+/**
+ * @brief Immutable flat index over all registered types
+ * 
+ * Built by TypeManager under its write lock and published through an
+ * atomic pointer. Readers pin their reader epoch and perform an acquire
+ * load of that pointer, so lookups involve no lock and no atomic
+ * read-modify-write. A superseded snapshot is freed once no reader that
+ * pinned before it was replaced is still inside a lookup.
+ * 
+ * Each index is an open-addressing table (power-of-two capacity, load
+ * factor <= 0.5, linear probing) storing a 64-bit key and the TypeInfo
+ * pointer. Name and type_index keys are verified against the TypeInfo
+ * itself, so hash collisions never return the wrong type.
+ */
+class TypeSnapshot {
+public:
+    struct Entry {
+        std::uint64_t key = 0;
+        const TypeInfo* info = nullptr;
+    };
+    
+    /**
+     * @brief Build a snapshot from the TypeManager maps
+     */
+    template<typename NameMap, typename IdMap>
+    TypeSnapshot(const NameMap& types_by_name, const IdMap& types_by_id) {
+        init_table(by_hash_, hash_bits_, types_by_name.size());
+        init_table(by_index_, index_bits_, types_by_name.size());
+        init_table(by_id_, id_bits_, types_by_id.size());
+        
+        names_.reserve(types_by_name.size());
+        for (const auto& [name, info] : types_by_name) {
+            insert(by_hash_, hash_bits_, fnv1a_hash(name), &info);
+            insert(by_index_, index_bits_, info.type_index.hash_code(), &info);
+            names_.push_back(name);
+        }
+        for (const auto& [id, info] : types_by_id) {
+            insert(by_id_, id_bits_, reinterpret_cast<std::uintptr_t>(id), info);
+        }
+    }
+    
+    /**
+     * @brief Find by pre-computed name hash (name verified on match)
+     */
+    [[nodiscard]] const TypeInfo* find_by_hash(std::size_t hash, std::string_view name) const noexcept {
+        const std::size_t mask = by_hash_.size() - 1;
+        for (std::size_t i = slot(hash, hash_bits_);; i = (i + 1) & mask) {
+            const Entry& e = by_hash_[i];
+            if (!e.info) return nullptr;
+            if (e.key == hash && e.info->name == name) [[likely]] return e.info;
+        }
+    }
+    
+    /**
+     * @brief Find by type_index
+     */
+    [[nodiscard]] const TypeInfo* find_by_index(std::type_index index) const noexcept {
+        const std::uint64_t key = index.hash_code();
+        const std::size_t mask = by_index_.size() - 1;
+        for (std::size_t i = slot(key, index_bits_);; i = (i + 1) & mask) {
+            const Entry& e = by_index_[i];
+            if (!e.info) return nullptr;
+            if (e.key == key && e.info->type_index == index) [[likely]] return e.info;
+        }
+    }
+    
+    /**
+     * @brief Find by compile-time TypeId
+     */
+    [[nodiscard]] const TypeInfo* find_by_id(TypeId id) const noexcept {
+        const std::uint64_t key = reinterpret_cast<std::uintptr_t>(id);
+        const std::size_t mask = by_id_.size() - 1;
+        for (std::size_t i = slot(key, id_bits_);; i = (i + 1) & mask) {
+            const Entry& e = by_id_[i];
+            if (!e.info) return nullptr;
+            if (e.key == key) [[likely]] return e.info;
+        }
+    }
+    
+    /**
+     * @brief Names of all types in this snapshot
+     */
+    [[nodiscard]] const std::vector<std::string_view>& names() const noexcept {
+        return names_;
+    }
+    
+    /**
+     * @brief Number of types in this snapshot
+     */
+    [[nodiscard]] std::size_t size() const noexcept {
+        return names_.size();
+    }
+
+private:
+    // Fibonacci hashing spreads pointer keys (aligned, low bits zero) as
+    // well as string hashes over the table
+    static std::size_t slot(std::uint64_t key, unsigned bits) noexcept {
+        return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+    }
+    
+    static void init_table(std::vector<Entry>& table, unsigned& bits, std::size_t count) {
+        const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(8, count * 2));
+        table.assign(capacity, Entry{});
+        bits = static_cast<unsigned>(std::countr_zero(capacity));
+    }
+    
+    static void insert(std::vector<Entry>& table, unsigned bits,
+                       std::uint64_t key, const TypeInfo* info) noexcept {
+        const std::size_t mask = table.size() - 1;
+        std::size_t i = slot(key, bits);
+        while (table[i].info) {
+            i = (i + 1) & mask;
+        }
+        table[i] = {key, info};
+    }
+    
+    std::vector<Entry> by_hash_;
+    std::vector<Entry> by_index_;
+    std::vector<Entry> by_id_;
+    unsigned hash_bits_ = 0;
+    unsigned index_bits_ = 0;
+    unsigned id_bits_ = 0;
+    std::vector<std::string_view> names_;
 };
 
 /**
@@ -109,6 +351,8 @@ private:
  * - Hash-based lookup using string_view (no allocation)
  * - Thread-local fast cache for repeated lookups
  * - Separate hash index for O(1) lookup by pre-computed hash
+ * - After freeze(), all lookups go through an immutable TypeSnapshot
+ *   without touching the shared mutex
  */
 class TypeManager {
 public:
@@ -116,10 +360,7 @@ public:
      * @brief Get the singleton instance
      * @return Reference to the global TypeManager instance
      */
-    static TypeManager& instance() {
-        static TypeManager mgr;
-        return mgr;
-    }
+    RTTM_API static TypeManager& instance();
     
     // Delete copy and move operations
     TypeManager(const TypeManager&) = delete;
@@ -139,32 +380,201 @@ public:
      * @return true if newly registered, false if already existed
      */
     bool register_type(std::string_view name, TypeInfo info, TypeId type_id = nullptr) {
+        // Inside load_module(): collect into the module's batch
+        if (ModuleStaging* staging = current_staging()) [[unlikely]] {
+            return staging->stage(name, std::move(info), type_id);
+        }
+        
         std::unique_lock lock(mutex_);
         
-        const std::size_t hash = fnv1a_hash(name);
+        // A pending static record of the same name describes the type first
+        const bool materialized = materialize_named_locked(name);
         
-        // Check if already registered
-        auto it = types_by_name_.find(name);
-        if (it != types_by_name_.end()) {
-            return false;
-        }
+        const bool success = insert_type_locked(name, std::move(info), type_id) != nullptr;
         
-        // Insert the type info
-        auto [inserted_it, success] = types_by_name_.emplace(std::string{name}, std::move(info));
-        if (success) {
-            // Index by hash for fast lookup
-            types_by_hash_[hash] = &inserted_it->second;
-            // Also index by type_index
-            types_by_index_[inserted_it->second.type_index] = &inserted_it->second;
-            // Index by TypeId for fastest lookup
-            if (type_id) {
-                types_by_id_[type_id] = &inserted_it->second;
-            }
+        // Late registration (e.g. plugins): publish a new snapshot
+        if ((success || materialized) && frozen_) {
+            publish_snapshot_locked();
         }
         
         return success;
     }
     
+    /**
+     * @brief Register a table of constant-initialized type records
+     * 
+     * O(1) per table: the span is only remembered, so static
+     * initialization does no per-type work. The first lookup miss indexes
+     * the pending records by name hash, TypeId and type_index (without
+     * building any TypeInfo); a record becomes a sealed TypeInfo when a
+     * lookup of its own type misses, when its name is registered, or when
+     * size() or the name list needs every type. Records whose name is
+     * already registered are skipped. The table must have static storage
+     * duration.
+     * 
+     * @return true (so the call can initialize a namespace-scope constant)
+     */
+    bool register_static(std::span<const StaticTypeRecord> records) {
+        std::unique_lock lock(mutex_);
+        pending_tables_.push_back(records);
+        has_pending_.store(true, std::memory_order_release);
+        return true;
+    }
+    
+    /**
+     * @brief Record a registration thunk to run on the type's first lookup
+     * 
+     * The thunk is keyed by name hash, TypeId and type_index, so the first
+     * get_type()/get_type_by_id() miss for that type runs exactly that
+     * thunk (outside the TypeManager lock). Concurrent first lookups wait
+     * for the running thunk; a lookup of the type from inside its own thunk
+     * (Registry<T>() does one) sees it as not registered yet.
+     * 
+     * Only the first thunk recorded for a type is kept.
+     * 
+     * @return true (so the call can initialize a namespace-scope constant)
+     */
+    bool register_lazy(std::string_view name, TypeId type_id, std::type_index index, LazyRegistrationFn fn) {
+        std::unique_lock lock(mutex_);
+        if (lazy_by_id_.find(type_id) != lazy_by_id_.end()) {
+            return true;
+        }
+        LazyEntry& entry = lazy_entries_.emplace_back(name, type_id, index, fn, lazy_entries_.size());
+        lazy_by_hash_.emplace(fnv1a_hash(name), &entry);
+        lazy_by_id_.emplace(type_id, &entry);
+        lazy_by_index_.emplace(index, &entry);
+        lazy_remaining_.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+    
+    /**
+     * @brief Run one lazy registration nobody has started yet
+     * 
+     * Thread-safe; warm_up() workers call this until it returns false.
+     * A registration that threw is pending again and is visited by the next
+     * call, so a later warm_up() retries it.
+     * 
+     * @return false once every lazy registration has been started
+     */
+    bool run_next_lazy() const {
+        while (lazy_remaining_.load(std::memory_order_acquire) != 0) {
+            LazyEntry* entry = nullptr;
+            {
+                std::shared_lock lock(mutex_);
+                const std::size_t i = lazy_cursor_.fetch_add(1, std::memory_order_relaxed);
+                if (i >= lazy_entries_.size()) {
+                    // Stay at the end so entries recorded later are visited
+                    lower_lazy_cursor(lazy_entries_.size());
+                    return false;
+                }
+                entry = const_cast<LazyEntry*>(&lazy_entries_[i]);
+            }
+            if (run_lazy(entry)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * @brief Number of lazy registrations that have not completed
+     */
+    [[nodiscard]] std::size_t pending_lazy_count() const noexcept {
+        return lazy_remaining_.load(std::memory_order_acquire);
+    }
+    
+    /**
+     * @brief Register the types of one module (e.g. a plugin) as a batch
+     * 
+     * Runs register_fn on the calling thread with register_type() redirected
+     * into a private staging area. Lookups from that thread (Registry<T>
+     * chains, base<B>()) also see the staged types; other threads see none
+     * of them until the whole batch is published under a single acquisition
+     * of the write lock, with one cache invalidation and one snapshot.
+     * Types whose name is already registered keep their existing owner and
+     * are not part of the module.
+     * 
+     * Only register_type() calls (Registry<T>()) are staged; static records
+     * and lazy registrations go to the global registry as usual.
+     * 
+     * @return Id for unload_module()
+     */
+    RTTM_API ModuleId load_module(ModuleRegistrationFn register_fn);
+    
+    /**
+     * @brief Unregister every type a load_module() call published
+     * 
+     * Removes the types from all indices and advances epoch(), which makes
+     * every thread's name cache and the RType::get<T>() / RTypeHandle::get<T>()
+     * caches re-resolve. Then waits until each thread that was inside an
+     * EpochGuard before the removal has left it, and only then destroys the
+     * metadata. Readers never block and never take a lock.
+     * 
+     * Must run while the module's code is still loaded (its static
+     * destructors are the natural place) and not from inside an EpochGuard
+     * of another thread's making; the calling thread's own guard is ignored.
+     * TypeInfo pointers obtained outside an EpochGuard (RType, Instance,
+     * handles) must not outlive the module.
+     */
+    RTTM_API void unload_module(ModuleId id);
+    
+    /**
+     * @brief Number of modules currently loaded
+     */
+    [[nodiscard]] std::size_t module_count() const {
+        std::shared_lock lock(mutex_);
+        return modules_.size();
+    }
+    
+    /**
+     * @brief Unregistration epoch (advances on every unload_module())
+     * 
+     * A single acquire load; caches keyed by it never return metadata of an
+     * unloaded module.
+     */
+    [[nodiscard]] std::uint64_t epoch() const noexcept {
+        return epoch_.load(std::memory_order_acquire);
+    }
+    
+    /**
+     * @brief Announce that the calling thread is reading metadata (nests)
+     * 
+     * Lock-free after the thread's first call. Used by EpochGuard and by
+     * every lookup that reads the frozen snapshot.
+     */
+    RTTM_API void pin_reader() const;
+    
+    /**
+     * @brief End the innermost pin_reader()
+     */
+    RTTM_API void unpin_reader() const noexcept;
+    
+    /**
+     * @brief Switch to read-optimized mode once registration is done
+     * 
+     * Builds an immutable snapshot of all lookup indices and publishes it.
+     * From then on get_type(), get_type_by_id(), is_registered(), size()
+     * and get_all_type_names() read the snapshot with a single acquire
+     * load instead of taking the shared lock.
+     * 
+     * Registration keeps working after freeze(): every newly registered
+     * type publishes a fresh snapshot. A superseded snapshot is freed by a
+     * later publish (or unload_module()) once every reader that could still
+     * be using it has unpinned.
+     */
+    void freeze() {
+        std::unique_lock lock(mutex_);
+        frozen_ = true;
+        publish_snapshot_locked();
+    }
+    
+    /**
+     * @brief Check whether freeze() has been called
+     */
+    [[nodiscard]] bool is_frozen() const noexcept {
+        return snapshot_.load(std::memory_order_acquire) != nullptr;
+    }
+    
     /**
      * @brief Get type information by compile-time TypeId (fastest)
      * 
@@ -172,9 +582,15 @@ public:
      * @return Pointer to TypeInfo if found, nullptr otherwise
      */
     const TypeInfo* get_type_by_id(TypeId id) const {
-        std::shared_lock lock(mutex_);
-        auto it = types_by_id_.find(id);
-        return it != types_by_id_.end() ? it->second : nullptr;
+        if (const TypeInfo* info = find_type_by_id(id)) [[likely]] {
+            return info;
+        }
+        if (resolve_pending(id)) {
+            if (const TypeInfo* info = find_type_by_id(id)) {
+                return info;
+            }
+        }
+        return find_staged(id);
     }
 
     /**
@@ -203,25 +619,65 @@ public:
     const TypeInfo* get_type_by_hash(std::size_t hash, std::string_view name) const {
         return get_type_by_hash_internal(hash, name);
     }
+    
+    /**
+     * @brief Get type information by pre-hashed name
+     * 
+     * @param name Name carrying its FNV-1a hash (e.g. "Player"_rn)
+     * @return Pointer to TypeInfo if found, nullptr otherwise
+     */
+    const TypeInfo* get_type(Name name) const {
+        return get_type_by_hash_internal(name.hash(), name.str());
+    }
 
 private:
     /**
      * @brief Internal hash-based lookup with TLS cache
      */
     const TypeInfo* get_type_by_hash_internal(std::size_t hash, std::string_view name) const {
+        if (const TypeInfo* info = find_type_by_hash(hash, name)) [[likely]] {
+            return info;
+        }
+        if (resolve_pending(hash, name)) {
+            if (const TypeInfo* info = find_type_by_hash(hash, name)) {
+                return info;
+            }
+        }
+        return find_staged(name);
+    }
+    
+    const TypeInfo* find_type_by_id(TypeId id) const {
+        if (is_frozen()) [[likely]] {
+            SnapshotPin pin(*this);
+            return pin->find_by_id(id);
+        }
+        std::shared_lock lock(mutex_);
+        auto it = types_by_id_.find(id);
+        return it != types_by_id_.end() ? it->second : nullptr;
+    }
+    
+    const TypeInfo* find_type_by_hash(std::size_t hash, std::string_view name) const {
+        // Frozen: the snapshot is authoritative (no lock, no cache)
+        if (is_frozen()) [[likely]] {
+            SnapshotPin pin(*this);
+            return pin->find_by_hash(hash, name);
+        }
+        
         // Fast path: check thread-local cache (no lock, no allocation)
         auto& cache = get_tls_cache();
-        if (auto* info = cache.find(hash)) [[likely]] {
+        const std::uint64_t generation = cache_generation_.load(std::memory_order_acquire);
+        if (auto* info = cache.find(hash, generation)) [[likely]] {
             return info;
         }
         
         // Cache miss - look up in hash index (need lock)
+        RTTM_PROFILE_SCOPE(TypeCacheMiss, name, std::string_view{});
         std::shared_lock lock(mutex_);
         auto it = types_by_hash_.find(hash);
         if (it != types_by_hash_.end()) [[likely]] {
             // Verify name matches (hash collision check)
             if (it->second->name == name) [[likely]] {
-                cache.insert(hash, it->second);
+                cache.insert(hash, it->second, generation);
                 return it->second;
             }
         }
@@ -229,7 +685,7 @@ private:
         // Fallback: full string lookup (rare, handles collisions)
         auto name_it = types_by_name_.find(name);
         if (name_it != types_by_name_.end()) {
-            cache.insert(hash, &name_it->second);
+            cache.insert(hash, &name_it->second, generation);
             return &name_it->second;
         }
         
@@ -262,14 +718,15 @@ public:
      * @return Pointer to TypeInfo if found, nullptr otherwise
      */
     const TypeInfo* get_type(std::type_index index) const {
-        std::shared_lock lock(mutex_);
-        
-        auto it = types_by_index_.find(index);
-        if (it != types_by_index_.end()) {
-            return it->second;
+        if (const TypeInfo* info = find_type_by_index(index)) [[likely]] {
+            return info;
         }
-        
-        return nullptr;
+        if (resolve_pending(index)) {
+            if (const TypeInfo* info = find_type_by_index(index)) {
+                return info;
+            }
+        }
+        return find_staged(index);
     }
     
     /**
@@ -298,14 +755,15 @@ public:
      * @return Pointer to TypeInfo if found, nullptr otherwise
      */
     TypeInfo* get_type_mutable(std::string_view name) {
-        std::shared_lock lock(mutex_);
-        
-        auto it = types_by_name_.find(name);
-        if (it != types_by_name_.end()) {
-            return &it->second;
+        if (TypeInfo* info = find_type_mutable(name)) [[likely]] {
+            return info;
         }
-        
-        return nullptr;
+        if (resolve_pending(fnv1a_hash(name), name)) {
+            if (TypeInfo* info = find_type_mutable(name)) {
+                return info;
+            }
+        }
+        return find_staged(name);
     }
     
     /**
@@ -315,8 +773,7 @@ public:
      * @return true if registered, false otherwise
      */
     bool is_registered(std::string_view name) const {
-        std::shared_lock lock(mutex_);
-        return types_by_name_.find(name) != types_by_name_.end();
+        return get_type(name) != nullptr;
     }
     
     /**
@@ -326,16 +783,44 @@ public:
      * @return true if registered, false otherwise
      */
     bool is_registered(std::type_index index) const {
+        return get_type(index) != nullptr;
+    }
+
+private:
+    TypeInfo* find_type_mutable(std::string_view name) {
         std::shared_lock lock(mutex_);
-        return types_by_index_.find(index) != types_by_index_.end();
+        auto it = types_by_name_.find(name);
+        return it != types_by_name_.end() ? &it->second : nullptr;
+    }
+    
+    const TypeInfo* find_type_by_index(std::type_index index) const {
+        if (is_frozen()) [[likely]] {
+            SnapshotPin pin(*this);
+            return pin->find_by_index(index);
+        }
+        std::shared_lock lock(mutex_);
+        
+        auto it = types_by_index_.find(index);
+        if (it != types_by_index_.end()) {
+            return it->second;
+        }
+        
+        return nullptr;
     }
     
+public:
+    
     /**
      * @brief Get all registered type names
      * 
      * @return Vector of all registered type names
      */
     std::vector<std::string_view> get_all_type_names() const {
+        resolve_all_pending();
+        if (is_frozen()) {
+            SnapshotPin pin(*this);
+            return pin->names();
+        }
         std::shared_lock lock(mutex_);
         
         std::vector<std::string_view> names;
@@ -349,12 +834,37 @@ public:
     }
     
     /**
-     * @brief Clear the thread-local cache
+     * @brief Invalidate the name cache of every thread
      * 
-     * Useful for testing or when type registrations change.
+     * Each thread flushes its cache on its next lookup. Registering a type
+     * does the same implicitly.
      */
     void clear_cache() const {
-        get_tls_cache().clear();
+        cache_generation_.fetch_add(1, std::memory_order_acq_rel);
+    }
+    
+    /**
+     * @brief Current cache generation (advances on every invalidation)
+     */
+    [[nodiscard]] std::uint64_t cache_generation() const noexcept {
+        return cache_generation_.load(std::memory_order_acquire);
+    }
+    
+    /**
+     * @brief Hit/miss counters of the calling thread's name cache
+     * 
+     * Only lookups before freeze() go through the cache; frozen lookups use
+     * the snapshot and are not counted.
+     */
+    [[nodiscard]] const TypeCacheStats& cache_stats() const noexcept {
+        return get_tls_cache().stats();
+    }
+    
+    /**
+     * @brief Reset the calling thread's cache counters
+     */
+    void reset_cache_stats() const noexcept {
+        get_tls_cache().reset_stats();
     }
     
     /**
@@ -363,29 +873,538 @@ public:
      * @return Number of registered types
      */
     std::size_t size() const {
+        resolve_all_pending();
+        if (is_frozen()) {
+            SnapshotPin pin(*this);
+            return pin->size();
+        }
         std::shared_lock lock(mutex_);
         return types_by_name_.size();
     }
 
 private:
+    using TypeMap = std::unordered_map<std::string, TypeInfo, TransparentStringHash, TransparentStringEqual>;
+    
     TypeManager() = default;
-    ~TypeManager() = default;
+    
+    ~TypeManager() {
+        for (EpochReaderSlot* slot = reader_slots_.load(std::memory_order_acquire); slot;) {
+            delete std::exchange(slot, slot->next);
+        }
+    }
+    
+    /**
+     * @brief Types registered by a load_module() call that is still running
+     */
+    struct ModuleStaging {
+        TypeMap types;
+        std::unordered_map<TypeId, TypeInfo*> by_id;
+        std::unordered_map<std::type_index, TypeInfo*> by_index;
+        std::vector<std::pair<std::string_view, TypeId>> order;    // Registration order
+        
+        bool stage(std::string_view name, TypeInfo info, TypeId type_id) {
+            if (types.find(name) != types.end()) {
+                return false;
+            }
+            auto [it, inserted] = types.emplace(std::string{name}, std::move(info));
+            TypeInfo* stored = &it->second;
+            by_index.emplace(stored->type_index, stored);
+            if (type_id) {
+                by_id.emplace(type_id, stored);
+            }
+            order.emplace_back(it->first, type_id);
+            return true;
+        }
+    };
+    
+    /**
+     * @brief A published module: its types and their TypeIds
+     */
+    struct LoadedModule {
+        std::vector<std::pair<const TypeInfo*, TypeId>> types;
+    };
+    
+    /**
+     * @brief Staging area of the load_module() running on this thread
+     * 
+     * Out of line so plugins and the library agree on one thread-local.
+     */
+    RTTM_API static ModuleStaging*& current_staging() noexcept;
+    
+    TypeInfo* find_staged(std::string_view name) const {
+        ModuleStaging* staging = current_staging();
+        if (!staging) [[likely]] {
+            return nullptr;
+        }
+        auto it = staging->types.find(name);
+        return it != staging->types.end() ? &it->second : nullptr;
+    }
+    
+    template<typename Key>
+        requires std::is_same_v<Key, TypeId> || std::is_same_v<Key, std::type_index>
+    const TypeInfo* find_staged(const Key& key) const {
+        ModuleStaging* staging = current_staging();
+        if (!staging) [[likely]] {
+            return nullptr;
+        }
+        const auto& map = [&]() -> const auto& {
+            if constexpr (std::is_same_v<Key, TypeId>) return staging->by_id;
+            else return staging->by_index;
+        }();
+        auto it = map.find(key);
+        return it != map.end() ? it->second : nullptr;
+    }
+    
+    /**
+     * @brief This thread's reader slot (nullptr if it never pinned)
+     */
+    RTTM_API EpochReaderSlot* reader_slot(bool create) const;
+    
+    /**
+     * @brief Wait until no other thread is pinned at a reader epoch before epoch
+     */
+    void wait_for_readers(std::uint64_t epoch) const;
+    
+    /**
+     * @brief The published snapshot, pinned for the scope of one lookup
+     */
+    class SnapshotPin {
+    public:
+        explicit SnapshotPin(const TypeManager& mgr) : mgr_(mgr) {
+            mgr_.pin_reader();
+            snapshot_ = mgr_.snapshot_.load(std::memory_order_acquire);
+        }
+        
+        ~SnapshotPin() {
+            mgr_.unpin_reader();
+        }
+        
+        SnapshotPin(const SnapshotPin&) = delete;
+        SnapshotPin& operator=(const SnapshotPin&) = delete;
+        
+        const TypeSnapshot* operator->() const noexcept { return snapshot_; }
+        
+    private:
+        const TypeManager& mgr_;
+        const TypeSnapshot* snapshot_;
+    };
+    
+    /**
+     * @brief Free retired snapshots no pinned reader can hold (caller holds unique lock)
+     * 
+     * Never waits: snapshots still reachable by a reader stay retired.
+     */
+    RTTM_API void reclaim_snapshots_locked();
     
     /**
      * @brief Get thread-local fast cache
      */
-    static FastTypeCache<16>& get_tls_cache() {
-        thread_local FastTypeCache<16> cache;
+    static TypeCache<>& get_tls_cache() {
+        thread_local TypeCache<> cache;
         return cache;
     }
     
+    /**
+     * @brief Insert a TypeInfo into all indices (caller holds unique lock)
+     * @return The stored TypeInfo, nullptr if the name was already registered
+     */
+    TypeInfo* insert_type_locked(std::string_view name, TypeInfo info, TypeId type_id) {
+        if (types_by_name_.find(name) != types_by_name_.end()) {
+            return nullptr;
+        }
+        
+        auto [it, success] = types_by_name_.emplace(std::string{name}, std::move(info));
+        TypeInfo* stored = &it->second;
+        index_type_locked(it->first, stored, type_id);
+        // The hash index may now point elsewhere: invalidate every thread's cache
+        cache_generation_.fetch_add(1, std::memory_order_release);
+        return stored;
+    }
+    
+    /**
+     * @brief Add a stored TypeInfo to the hash, type_index and TypeId indices
+     */
+    void index_type_locked(std::string_view name, TypeInfo* stored, TypeId type_id) {
+        // Index by hash for fast lookup
+        types_by_hash_[fnv1a_hash(name)] = stored;
+        // Also index by type_index
+        types_by_index_[stored->type_index] = stored;
+        // Index by TypeId for fastest lookup
+        if (type_id) {
+            types_by_id_[type_id] = stored;
+        }
+    }
+    
+    /**
+     * @brief Deferred registration state of one type
+     */
+    struct LazyEntry {
+        enum State : std::uint8_t { Pending, Running, Done };
+        
+        LazyEntry(std::string_view n, TypeId id, std::type_index index, LazyRegistrationFn f,
+                  std::size_t pos) noexcept
+            : name(n), type_id(id), type_index(index), fn(f), position(pos) {}
+        
+        std::string_view name;
+        TypeId type_id;
+        std::type_index type_index;
+        LazyRegistrationFn fn;
+        std::size_t position;                   // Index in lazy_entries_
+        std::atomic<std::uint8_t> state{Pending};
+    };
+    
+    /**
+     * @brief Move the run_next_lazy() cursor back to position (never forward)
+     */
+    void lower_lazy_cursor(std::size_t position) const noexcept {
+        std::size_t cursor = lazy_cursor_.load(std::memory_order_relaxed);
+        while (cursor > position &&
+               !lazy_cursor_.compare_exchange_weak(cursor, position, std::memory_order_relaxed)) {}
+    }
+    
+    /**
+     * @brief Thunks being run by the current thread (innermost last)
+     */
+    static std::vector<const LazyEntry*>& running_lazy() {
+        thread_local std::vector<const LazyEntry*> running;
+        return running;
+    }
+    
+    /**
+     * @brief Run (or wait for) a lazy registration
+     * @return true if the entry completed, i.e. a retried lookup may succeed
+     */
+    bool run_lazy(LazyEntry* entry) const {
+        if (!entry) {
+            return false;
+        }
+        std::uint8_t state = entry->state.load(std::memory_order_acquire);
+        if (state == LazyEntry::Done) {
+            return true;
+        }
+        auto& running = running_lazy();
+        if (std::find(running.begin(), running.end(), entry) != running.end()) {
+            return false;
+        }
+        
+        if (state == LazyEntry::Pending &&
+            entry->state.compare_exchange_strong(state, LazyEntry::Running, std::memory_order_acq_rel)) {
+            running.push_back(entry);
+            try {
+                entry->fn();
+            } catch (...) {
+                running.pop_back();
+                entry->state.store(LazyEntry::Pending, std::memory_order_release);
+                entry->state.notify_all();
+                // The cursor may have passed it: let run_next_lazy() retry
+                lower_lazy_cursor(entry->position);
+                throw;
+            }
+            running.pop_back();
+            entry->state.store(LazyEntry::Done, std::memory_order_release);
+            entry->state.notify_all();
+            lazy_remaining_.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+        
+        // Another thread is running it
+        while ((state = entry->state.load(std::memory_order_acquire)) == LazyEntry::Running) {
+            entry->state.wait(LazyEntry::Running, std::memory_order_acquire);
+        }
+        return state == LazyEntry::Done;
+    }
+    
+    template<typename Map, typename Key>
+    LazyEntry* find_lazy(const Map& map, const Key& key) const {
+        std::shared_lock lock(mutex_);
+        auto it = map.find(key);
+        return it != map.end() ? it->second : nullptr;
+    }
+    
+    /**
+     * @brief Resolve deferred registrations after a lookup miss
+     * @return true if the lookup should be retried
+     */
+    bool resolve_pending(TypeId id) const {
+        const bool materialized = materialize_pending(id);
+        if (lazy_remaining_.load(std::memory_order_acquire) == 0) [[likely]] {
+            return materialized;
+        }
+        return run_lazy(find_lazy(lazy_by_id_, id)) || materialized;
+    }
+    
+    bool resolve_pending(std::type_index index) const {
+        const bool materialized = materialize_pending(index);
+        if (lazy_remaining_.load(std::memory_order_acquire) == 0) [[likely]] {
+            return materialized;
+        }
+        return run_lazy(find_lazy(lazy_by_index_, index)) || materialized;
+    }
+    
+    bool resolve_pending(std::size_t hash, std::string_view name) const {
+        const bool materialized = materialize_pending(PendingName{hash, name});
+        if (lazy_remaining_.load(std::memory_order_acquire) == 0) [[likely]] {
+            return materialized;
+        }
+        LazyEntry* entry = nullptr;
+        {
+            std::shared_lock lock(mutex_);
+            auto [first, last] = lazy_by_hash_.equal_range(hash);
+            for (auto it = first; it != last; ++it) {
+                if (it->second->name == name) {
+                    entry = it->second;
+                    break;
+                }
+            }
+        }
+        return run_lazy(entry) || materialized;
+    }
+    
+    /**
+     * @brief Run every deferred registration on the calling thread
+     */
+    void resolve_all_pending() const {
+        materialize_all_pending();
+        if (lazy_remaining_.load(std::memory_order_acquire) == 0) [[likely]] {
+            return;
+        }
+        std::vector<LazyEntry*> entries;
+        {
+            std::shared_lock lock(mutex_);
+            for (const LazyEntry& entry : lazy_entries_) {
+                entries.push_back(const_cast<LazyEntry*>(&entry));
+            }
+        }
+        for (LazyEntry* entry : entries) {
+            run_lazy(entry);
+        }
+    }
+    
+    /**
+     * @brief Name key of a pending record lookup
+     */
+    struct PendingName {
+        std::size_t hash;
+        std::string_view name;
+    };
+    
+    /**
+     * @brief Materialize the pending static record of one type after a lookup miss
+     * 
+     * A single acquire load when nothing is pending; a shared lock when no
+     * record matches key.
+     * 
+     * @return true if a record was materialized (the caller should retry)
+     */
+    template<typename Key>
+    bool materialize_pending(const Key& key) const {
+        if (!has_pending_.load(std::memory_order_acquire)) [[likely]] {
+            return false;
+        }
+        auto* self = const_cast<TypeManager*>(this);
+        {
+            std::shared_lock lock(mutex_);
+            if (pending_tables_.empty() && !self->find_pending_locked(key)) {
+                return false;
+            }
+        }
+        std::unique_lock lock(mutex_);
+        self->index_pending_locked();
+        const StaticTypeRecord* record = self->find_pending_locked(key);
+        if (!record) {
+            return false;
+        }
+        if (self->materialize_record_locked(*record) && frozen_) {
+            self->publish_snapshot_locked();
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Materialize every pending static record (size(), name list)
+     */
+    void materialize_all_pending() const {
+        if (!has_pending_.load(std::memory_order_acquire)) [[likely]] {
+            return;
+        }
+        auto* self = const_cast<TypeManager*>(this);
+        std::unique_lock lock(mutex_);
+        self->index_pending_locked();
+        bool added = false;
+        while (!pending_by_id_.empty()) {
+            added |= self->materialize_record_locked(*pending_by_id_.begin()->second);
+        }
+        if (added && frozen_) {
+            self->publish_snapshot_locked();
+        }
+    }
+    
+    /**
+     * @brief Materialize the pending record named name, if any (caller holds unique lock)
+     * @return true if a type was added
+     */
+    bool materialize_named_locked(std::string_view name) {
+        if (!has_pending_.load(std::memory_order_relaxed)) [[likely]] {
+            return false;
+        }
+        index_pending_locked();
+        const StaticTypeRecord* record = find_pending_locked(PendingName{fnv1a_hash(name), name});
+        return record && materialize_record_locked(*record);
+    }
+    
+    /**
+     * @brief Index the records of newly registered tables (caller holds unique lock)
+     * 
+     * Only the first record of a type is kept.
+     */
+    void index_pending_locked() {
+        for (std::span<const StaticTypeRecord> records : pending_tables_) {
+            for (const StaticTypeRecord& record : records) {
+                if (!pending_by_id_.emplace(record.type_id, &record).second) {
+                    continue;
+                }
+                pending_by_hash_.emplace(fnv1a_hash(record.name), &record);
+                pending_by_index_.emplace(std::type_index(*record.type), &record);
+            }
+        }
+        pending_tables_.clear();
+    }
+    
+    const StaticTypeRecord* find_pending_locked(TypeId id) const {
+        auto it = pending_by_id_.find(id);
+        return it != pending_by_id_.end() ? it->second : nullptr;
+    }
+    
+    const StaticTypeRecord* find_pending_locked(std::type_index index) const {
+        auto it = pending_by_index_.find(index);
+        return it != pending_by_index_.end() ? it->second : nullptr;
+    }
+    
+    const StaticTypeRecord* find_pending_locked(const PendingName& key) const {
+        auto [first, last] = pending_by_hash_.equal_range(key.hash);
+        for (auto it = first; it != last; ++it) {
+            if (it->second->name == key.name) {
+                return it->second;
+            }
+        }
+        return nullptr;
+    }
+    
+    /**
+     * @brief Turn one indexed record into a sealed TypeInfo (caller holds unique lock)
+     * 
+     * The record leaves the pending indices either way; it is skipped if
+     * its name is already registered. The caller publishes a snapshot.
+     * 
+     * @return true if a type was added
+     */
+    bool materialize_record_locked(const StaticTypeRecord& record) {
+        pending_by_id_.erase(record.type_id);
+        auto index_it = pending_by_index_.find(std::type_index(*record.type));
+        if (index_it != pending_by_index_.end() && index_it->second == &record) {
+            pending_by_index_.erase(index_it);
+        }
+        auto [first, last] = pending_by_hash_.equal_range(fnv1a_hash(record.name));
+        for (auto it = first; it != last; ++it) {
+            if (it->second == &record) {
+                pending_by_hash_.erase(it);
+                break;
+            }
+        }
+        if (pending_tables_.empty() && pending_by_id_.empty()) {
+            has_pending_.store(false, std::memory_order_release);
+        }
+        
+        if (types_by_name_.find(record.name) != types_by_name_.end()) {
+            return false;
+        }
+        TypeInfo info = record.describe();
+        for (const StaticMemberRecord& member : record.members) {
+            info.add_member(member.describe(member.name));
+        }
+        for (const StaticMethodRecord& method : record.methods) {
+            info.add_method(method.describe(method.name));
+        }
+        for (ConstructorDescriber describe : record.constructors) {
+            describe(info);
+        }
+        TypeInfo* stored = insert_type_locked(record.name, std::move(info), record.type_id);
+        if (!stored) {
+            return false;
+        }
+        stored->seal();
+        return true;
+    }
+    
+    /**
+     * @brief Build and publish a new snapshot (caller holds unique lock)
+     */
+    void publish_snapshot_locked() {
+        auto snapshot = std::make_unique<TypeSnapshot>(types_by_name_, types_by_id_);
+        snapshot_.store(snapshot.get(), std::memory_order_release);
+        if (current_snapshot_) {
+            // Readers pinning at the new reader epoch only see the new snapshot
+            const std::uint64_t epoch = reader_epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+            retired_snapshots_.emplace_back(epoch, std::move(current_snapshot_));
+        }
+        current_snapshot_ = std::move(snapshot);
+        reclaim_snapshots_locked();
+    }
+    
     mutable std::shared_mutex mutex_;
-    std::unordered_map<std::string, TypeInfo, TransparentStringHash, TransparentStringEqual> types_by_name_;
+    bool frozen_ = false;                                              // Guarded by mutex_
+    std::atomic<const TypeSnapshot*> snapshot_{nullptr};               // Current published snapshot
+    std::unique_ptr<TypeSnapshot> current_snapshot_;                   // Owns snapshot_ (guarded by mutex_)
+    std::vector<std::pair<std::uint64_t, std::unique_ptr<TypeSnapshot>>> retired_snapshots_;  // Reader epoch that retired each
+    std::vector<std::span<const StaticTypeRecord>> pending_tables_;    // Not yet indexed (guarded by mutex_)
+    std::unordered_multimap<std::size_t, const StaticTypeRecord*> pending_by_hash_;    // Not yet materialized
+    std::unordered_map<TypeId, const StaticTypeRecord*> pending_by_id_;
+    std::unordered_map<std::type_index, const StaticTypeRecord*> pending_by_index_;
+    mutable std::atomic<bool> has_pending_{false};                     // Tables or indexed records remain
+    std::deque<LazyEntry> lazy_entries_;                               // Stable addresses (guarded by mutex_)
+    std::unordered_multimap<std::size_t, LazyEntry*> lazy_by_hash_;    // Name hash -> entry
+    std::unordered_map<TypeId, LazyEntry*> lazy_by_id_;
+    std::unordered_map<std::type_index, LazyEntry*> lazy_by_index_;
+    mutable std::atomic<std::size_t> lazy_remaining_{0};               // Entries not yet Done
+    mutable std::atomic<std::size_t> lazy_cursor_{0};                  // Next entry for run_next_lazy()
+    TypeMap types_by_name_;
     std::unordered_map<std::size_t, const TypeInfo*> types_by_hash_;  // Hash -> TypeInfo
     std::unordered_map<std::type_index, const TypeInfo*> types_by_index_;
     std::unordered_map<TypeId, const TypeInfo*> types_by_id_;
+    mutable std::atomic<std::uint64_t> cache_generation_{1};           // Bumped on registration / clear_cache()
+    std::unordered_map<ModuleId, LoadedModule> modules_;               // Guarded by mutex_
+    ModuleId next_module_id_ = 1;                                      // Guarded by mutex_
+    std::atomic<std::uint64_t> epoch_{1};                              // Bumped by unload_module()
+    std::atomic<std::uint64_t> reader_epoch_{1};                       // Pinned by readers; bumped when something they may hold is retired
+    mutable std::atomic<EpochReaderSlot*> reader_slots_{nullptr};      // Lock-free list, never shrinks
 };
 
+/**
+ * @brief TypeInfo of T, cached per type and revalidated against epoch()
+ * 
+ * Backs RType::get<T>() and RTypeHandle::get<T>(). A hit costs an acquire
+ * load of the epoch plus a seqlock read; unregistered types are not cached,
+ * so a later registration is picked up.
+ */
+template<typename T>
+const TypeInfo* cached_type_info() {
+    static InlineCache<std::uint64_t, const TypeInfo*, 1> cache;
+    static TypeManager& mgr = TypeManager::instance();
+    const std::uint64_t epoch = mgr.epoch();
+    const TypeInfo* info = nullptr;
+    if (cache.find(epoch, info)) [[likely]] {
+        return info;
+    }
+    info = mgr.get_type_by_id(type_id<T>);
+    if (!info) {
+        info = mgr.get_type(type_name<T>());
+    }
+    if (info && mgr.epoch() == epoch) {
+        cache.insert(epoch, info);
+    }
+    return info;
+}
+
 } // namespace rttm::detail
 
 // Include exceptions after TypeManager is defined
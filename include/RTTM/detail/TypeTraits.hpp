@@ -14,6 +14,7 @@
 #include <string>
 #include <string_view>
 #include <iterator>
+#include <cstddef>
 
 namespace rttm {
 
@@ -171,8 +172,33 @@ concept StringConvertible = std::convertible_to<T, std::string> ||
                             std::convertible_to<T, std::string_view> ||
                             std::convertible_to<T, const char*>;
 
+/**
+ * @brief Concept for an unambiguous, non-virtual base class
+ * 
+ * Such a base lives at the same offset in every Derived object, so its
+ * members can be flattened into Derived at registration time.
+ */
+template<typename Base, typename Derived>
+concept NonVirtualBaseOf = std::is_base_of_v<Base, Derived> &&
+                           !std::is_same_v<std::remove_cv_t<Base>, std::remove_cv_t<Derived>> &&
+                           requires(Base* base) { static_cast<Derived*>(base); };
+
 namespace detail {
 
+/**
+ * @brief Byte offset of the Base subobject inside Derived
+ * 
+ * Computed with pointer arithmetic on suitably aligned storage; no Derived
+ * object is constructed.
+ */
+template<typename Derived, typename Base>
+requires NonVirtualBaseOf<Base, Derived>
+[[nodiscard]] std::ptrdiff_t base_offset() noexcept {
+    alignas(Derived) static unsigned char storage[sizeof(Derived)];
+    auto* derived = reinterpret_cast<Derived*>(storage);
+    return reinterpret_cast<unsigned char*>(static_cast<Base*>(derived)) - storage;
+}
+
 /**
  * @brief Type trait to detect if a type is a sequential container
  */
@@ -279,7 +305,13 @@ consteval std::string_view type_name() {
 #endif
     
     constexpr auto start = name.find(prefix) + prefix.size();
+#if defined(__GNUC__) && !defined(__clang__)
+    // GCC appends "; std::string_view = ..." before the closing bracket
+    constexpr auto alias = name.find(';', start);
+    constexpr auto end = alias != std::string_view::npos ? alias : name.rfind(suffix);
+#else
     constexpr auto end = name.rfind(suffix);
+#endif
     return name.substr(start, end - start);
 }
 
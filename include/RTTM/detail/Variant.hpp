@@ -5,7 +5,7 @@
  * Variant provides RTTR-like dynamic value storage without needing
  * compile-time type knowledge. It supports:
  * - Any type storage with Small Buffer Optimization
- * - Type-safe conversions
+ * - Type-safe conversions (arithmetic and enum via a conversion matrix)
  * - DLL-compatible (no templates in virtual interface)
  */
 
@@ -15,6 +15,8 @@
 #include "TypeInfo.hpp"
 #include "TypeManager.hpp"
 #include "Exceptions.hpp"
+#include "Conversion.hpp"
+#include "Profiling.hpp"
 
 #include <memory>
 #include <typeindex>
@@ -24,16 +26,33 @@
 
 namespace rttm {
 
+#ifndef RTTM_VARIANT_SBO_SIZE
+/**
+ * @brief Default inline buffer size of Variant in bytes
+ * 
+ * Large enough for std::string and 4-float math types. Configure with the
+ * RTTM_VARIANT_SBO_SIZE CMake option; every translation unit linked together
+ * must agree on this value.
+ */
+#define RTTM_VARIANT_SBO_SIZE 32
+#endif
+
 /**
  * @brief Type-erased value container with Small Buffer Optimization
  * 
- * Variant can hold any value and provides type-safe access without
+ * BasicVariant can hold any value and provides type-safe access without
  * needing compile-time type knowledge. Uses SBO to avoid heap allocation
- * for small types (up to 16 bytes).
+ * for types up to SboSize bytes. Trivially copyable payloads are copied
+ * and moved with memcpy instead of an indirect call.
+ * 
+ * @tparam SboSize Inline buffer size in bytes
  */
-class Variant {
+template<std::size_t SboSize = RTTM_VARIANT_SBO_SIZE>
+class BasicVariant {
+    static_assert(SboSize >= sizeof(void*), "Variant buffer must hold at least a pointer");
+    
     // Small Buffer Optimization
-    static constexpr std::size_t SBO_SIZE = 16;
+    static constexpr std::size_t SBO_SIZE = SboSize;
     static constexpr std::size_t SBO_ALIGN = 8;
     
     // Type-erased operations
@@ -47,102 +66,78 @@ class Variant {
         CopyFn copy;
         MoveFn move;
         TypeFn type;
+        std::string_view name;          ///< Readable type name (profiling keys)
         std::size_t size;
         bool use_sbo;
+        bool trivial;   ///< Trivially copyable and destructible: memcpy, no destroy
+        detail::ArithmeticKind kind;    ///< Arithmetic representation (None if not arithmetic/enum)
     };
     
     template<typename T>
-    static const Ops* get_ops() {
-        static constexpr bool use_sbo = sizeof(T) <= SBO_SIZE && 
-                                        alignof(T) <= SBO_ALIGN &&
-                                        std::is_nothrow_move_constructible_v<T>;
-        static const Ops ops = {
-            [](void* ptr) noexcept { static_cast<T*>(ptr)->~T(); },
-            [](void* dst, const void* src) { new (dst) T(*static_cast<const T*>(src)); },
-            [](void* dst, void* src) noexcept { new (dst) T(std::move(*static_cast<T*>(src))); },
-            []() noexcept { return std::type_index(typeid(T)); },
-            sizeof(T),
-            use_sbo
-        };
-        return &ops;
-    }
+    static constexpr bool fits_sbo = sizeof(T) <= SBO_SIZE &&
+                                     alignof(T) <= SBO_ALIGN &&
+                                     std::is_nothrow_move_constructible_v<T>;
+    
+    template<typename T>
+    static constexpr Ops ops_for = {
+        [](void* ptr) noexcept { static_cast<T*>(ptr)->~T(); },
+        [](void* dst, const void* src) { new (dst) T(*static_cast<const T*>(src)); },
+        [](void* dst, void* src) noexcept { new (dst) T(std::move(*static_cast<T*>(src))); },
+        []() noexcept { return std::type_index(typeid(T)); },
+        detail::type_name<T>(),
+        sizeof(T),
+        fits_sbo<T>,
+        std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+        detail::arithmetic_kind_v<T>
+    };
 
 public:
-    Variant() noexcept : ops_(nullptr), heap_ptr_(nullptr) {}
+    /**
+     * @brief Check at compile time whether T is stored inline
+     */
+    template<typename T>
+    [[nodiscard]] static constexpr bool stores_inline() noexcept {
+        return fits_sbo<std::decay_t<T>>;
+    }
+    
+    BasicVariant() noexcept : ops_(nullptr) {}
     
-    template<typename T, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, Variant>>>
-    static Variant create(T&& value) {
+    template<typename T, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, BasicVariant>>>
+    static BasicVariant create(T&& value) {
         using DecayT = std::decay_t<T>;
-        Variant v;
-        v.ops_ = get_ops<DecayT>();
-        
-        if (v.ops_->use_sbo) {
+        BasicVariant v;
+        if constexpr (fits_sbo<DecayT>) {
             new (v.sbo_) DecayT(std::forward<T>(value));
         } else {
+            RTTM_PROFILE_SCOPE(VariantHeapSpill, ops_for<DecayT>.name, std::string_view{});
             v.heap_ptr_ = new DecayT(std::forward<T>(value));
         }
+        v.ops_ = &ops_for<DecayT>;
         return v;
     }
     
-    ~Variant() { clear(); }
+    ~BasicVariant() { clear(); }
     
-    Variant(const Variant& other) : ops_(nullptr), heap_ptr_(nullptr) {
-        if (other.ops_) {
-            ops_ = other.ops_;
-            if (ops_->use_sbo) {
-                ops_->copy(sbo_, other.sbo_);
-            } else {
-                // Allocate and copy
-                heap_ptr_ = ::operator new(ops_->size);
-                ops_->copy(heap_ptr_, other.heap_ptr_);
-            }
-        }
+    BasicVariant(const BasicVariant& other) : ops_(nullptr) {
+        copy_from(other);
     }
     
-    Variant& operator=(const Variant& other) {
+    BasicVariant& operator=(const BasicVariant& other) {
         if (this != &other) {
             clear();
-            if (other.ops_) {
-                ops_ = other.ops_;
-                if (ops_->use_sbo) {
-                    ops_->copy(sbo_, other.sbo_);
-                } else {
-                    heap_ptr_ = ::operator new(ops_->size);
-                    ops_->copy(heap_ptr_, other.heap_ptr_);
-                }
-            }
+            copy_from(other);
         }
         return *this;
     }
     
-    Variant(Variant&& other) noexcept : ops_(nullptr), heap_ptr_(nullptr) {
-        if (other.ops_) {
-            ops_ = other.ops_;
-            if (ops_->use_sbo) {
-                ops_->move(sbo_, other.sbo_);
-                other.ops_->destroy(other.sbo_);
-            } else {
-                heap_ptr_ = other.heap_ptr_;
-                other.heap_ptr_ = nullptr;
-            }
-            other.ops_ = nullptr;
-        }
+    BasicVariant(BasicVariant&& other) noexcept : ops_(nullptr) {
+        move_from(other);
     }
     
-    Variant& operator=(Variant&& other) noexcept {
+    BasicVariant& operator=(BasicVariant&& other) noexcept {
         if (this != &other) {
             clear();
-            if (other.ops_) {
-                ops_ = other.ops_;
-                if (ops_->use_sbo) {
-                    ops_->move(sbo_, other.sbo_);
-                    other.ops_->destroy(other.sbo_);
-                } else {
-                    heap_ptr_ = other.heap_ptr_;
-                    other.heap_ptr_ = nullptr;
-                }
-                other.ops_ = nullptr;
-            }
+            move_from(other);
         }
         return *this;
     }
@@ -152,21 +147,37 @@ public:
     
     template<typename T>
     [[nodiscard]] bool is_type() const noexcept {
-        return ops_ && ops_->type() == std::type_index(typeid(T));
+        // Pointer compare first; type_index fallback covers ops tables
+        // duplicated across shared library boundaries
+        return ops_ && (ops_ == &ops_for<T> || ops_->type() == std::type_index(typeid(T)));
     }
     
     [[nodiscard]] std::type_index type() const noexcept {
         return ops_ ? ops_->type() : std::type_index(typeid(void));
     }
     
+    /**
+     * @brief Arithmetic representation of the held value (None if not arithmetic/enum)
+     */
+    [[nodiscard]] detail::ArithmeticKind arithmetic_kind() const noexcept {
+        return ops_ ? ops_->kind : detail::ArithmeticKind::None;
+    }
+    
+    /**
+     * @brief Check whether the held value lives in the inline buffer
+     */
+    [[nodiscard]] bool is_inline() const noexcept {
+        return ops_ && ops_->use_sbo;
+    }
+    
     [[nodiscard]] void* get_raw() noexcept {
         if (!ops_) return nullptr;
-        return ops_->use_sbo ? sbo_ : heap_ptr_;
+        return ops_->use_sbo ? static_cast<void*>(sbo_) : heap_ptr_;
     }
     
     [[nodiscard]] const void* get_raw() const noexcept {
         if (!ops_) return nullptr;
-        return ops_->use_sbo ? sbo_ : heap_ptr_;
+        return ops_->use_sbo ? static_cast<const void*>(sbo_) : heap_ptr_;
     }
     
     template<typename T>
@@ -205,52 +216,95 @@ public:
     void clear() noexcept {
         if (ops_) {
             if (ops_->use_sbo) {
-                ops_->destroy(sbo_);
+                if (!ops_->trivial) {
+                    ops_->destroy(sbo_);
+                }
             } else if (heap_ptr_) {
                 ops_->destroy(heap_ptr_);
                 ::operator delete(heap_ptr_);
             }
             ops_ = nullptr;
-            heap_ptr_ = nullptr;
         }
     }
 
 private:
+    void copy_from(const BasicVariant& other) {
+        if (!other.ops_) return;
+        if (other.ops_->use_sbo) {
+            if (other.ops_->trivial) [[likely]] {
+                std::memcpy(sbo_, other.sbo_, SBO_SIZE);
+            } else {
+                other.ops_->copy(sbo_, other.sbo_);
+            }
+        } else {
+            RTTM_PROFILE_SCOPE(VariantHeapSpill, other.ops_->name, std::string_view{});
+            void* mem = ::operator new(other.ops_->size);
+            if (other.ops_->trivial) {
+                std::memcpy(mem, other.heap_ptr_, other.ops_->size);
+            } else {
+                try {
+                    other.ops_->copy(mem, other.heap_ptr_);
+                } catch (...) {
+                    ::operator delete(mem);
+                    throw;
+                }
+            }
+            heap_ptr_ = mem;
+        }
+        ops_ = other.ops_;
+    }
+    
+    void move_from(BasicVariant& other) noexcept {
+        if (!other.ops_) return;
+        ops_ = other.ops_;
+        if (ops_->use_sbo) {
+            if (ops_->trivial) [[likely]] {
+                std::memcpy(sbo_, other.sbo_, SBO_SIZE);
+            } else {
+                ops_->move(sbo_, other.sbo_);
+                ops_->destroy(other.sbo_);
+            }
+        } else {
+            heap_ptr_ = other.heap_ptr_;
+        }
+        other.ops_ = nullptr;
+    }
+    
     const Ops* ops_;
-    alignas(SBO_ALIGN) char sbo_[SBO_SIZE];
-    void* heap_ptr_;
+    union {
+        alignas(SBO_ALIGN) unsigned char sbo_[SBO_SIZE];
+        void* heap_ptr_;
+    };
 };
 
-// Type conversions
+/**
+ * @brief Variant with the configured default buffer size
+ */
+using Variant = BasicVariant<>;
+
+// Type conversions (arithmetic and enum values go through the conversion matrix)
+template<std::size_t SboSize>
 template<typename T>
-bool Variant::can_convert() const noexcept {
+bool BasicVariant<SboSize>::can_convert() const noexcept {
     if (!ops_) return false;
     if (is_type<T>()) return true;
     
-    if constexpr (std::is_arithmetic_v<T>) {
-        auto ti = type();
-        return ti == typeid(int) || ti == typeid(float) || ti == typeid(double) ||
-               ti == typeid(long) || ti == typeid(short) || ti == typeid(char) ||
-               ti == typeid(unsigned int) || ti == typeid(unsigned long) ||
-               ti == typeid(long long) || ti == typeid(unsigned long long);
+    if constexpr (detail::arithmetic_kind_v<T> != detail::ArithmeticKind::None) {
+        return ops_->kind != detail::ArithmeticKind::None;
     }
     return false;
 }
 
+template<std::size_t SboSize>
 template<typename T>
-T Variant::convert() const {
+T BasicVariant<SboSize>::convert() const {
     if (!ops_) throw ReflectionError("Cannot convert empty variant");
-    if (is_type<T>()) return get<T>();
+    if (is_type<T>()) return get_unchecked<T>();
     
-    if constexpr (std::is_arithmetic_v<T>) {
-        auto ti = type();
-        if (ti == typeid(int)) return static_cast<T>(get_unchecked<int>());
-        if (ti == typeid(float)) return static_cast<T>(get_unchecked<float>());
-        if (ti == typeid(double)) return static_cast<T>(get_unchecked<double>());
-        if (ti == typeid(long)) return static_cast<T>(get_unchecked<long>());
-        if (ti == typeid(long long)) return static_cast<T>(get_unchecked<long long>());
-        if (ti == typeid(short)) return static_cast<T>(get_unchecked<short>());
-        if (ti == typeid(unsigned int)) return static_cast<T>(get_unchecked<unsigned int>());
+    if constexpr (detail::arithmetic_kind_v<T> != detail::ArithmeticKind::None) {
+        if (ops_->kind != detail::ArithmeticKind::None) [[likely]] {
+            return detail::convert_arithmetic_to<T>(ops_->kind, get_raw());
+        }
     }
     throw ReflectionError("Cannot convert variant to requested type");
 }
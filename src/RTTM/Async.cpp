@@ -0,0 +1,117 @@
+/**
+ * @file Async.cpp
+ * @brief Shared poller resuming coroutines that await a std::future
+ */
+
+#include "RTTM/detail/Async.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rttm::detail {
+
+namespace {
+
+/**
+ * @brief One background thread polling every pending future
+ *
+ * Polls back off from 50us to 1ms while nothing completes and restart at
+ * the short interval when a future is added. Continuations run on the
+ * poller thread, outside the lock.
+ */
+class FuturePoller {
+public:
+    static FuturePoller& instance() {
+        static FuturePoller poller;
+        return poller;
+    }
+
+    void watch(std::function<bool()> ready, std::coroutine_handle<> continuation) {
+        {
+            std::lock_guard lock(mutex_);
+            if (!thread_.joinable()) {
+                thread_ = std::thread([this] { run(); });
+            }
+            pending_.push_back({std::move(ready), continuation});
+        }
+        wake_.notify_one();
+    }
+
+    ~FuturePoller() {
+        {
+            std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_one();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+private:
+    struct Entry {
+        std::function<bool()> ready;
+        std::coroutine_handle<> continuation;
+    };
+
+    static constexpr std::chrono::microseconds min_interval{50};
+    static constexpr std::chrono::microseconds max_interval{1000};
+
+    void run() {
+        std::vector<std::coroutine_handle<>> completed;
+        auto interval = min_interval;
+        std::unique_lock lock(mutex_);
+        while (!stop_) {
+            if (pending_.empty()) {
+                wake_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+                interval = min_interval;
+                continue;
+            }
+
+            for (std::size_t i = 0; i < pending_.size();) {
+                if (pending_[i].ready()) {
+                    completed.push_back(pending_[i].continuation);
+                    pending_[i] = std::move(pending_.back());
+                    pending_.pop_back();
+                } else {
+                    ++i;
+                }
+            }
+
+            if (!completed.empty()) {
+                lock.unlock();
+                for (std::coroutine_handle<> continuation : completed) {
+                    continuation.resume();
+                }
+                completed.clear();
+                lock.lock();
+                interval = min_interval;
+                continue;
+            }
+
+            const std::size_t watched = pending_.size();
+            const bool added = wake_.wait_for(lock, interval, [this, watched] {
+                return stop_ || pending_.size() != watched;
+            });
+            interval = added ? min_interval : std::min(interval * 2, max_interval);
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<Entry> pending_;
+    std::thread thread_;
+    bool stop_ = false;
+};
+
+} // namespace
+
+void watch_future(std::function<bool()> ready, std::coroutine_handle<> continuation) {
+    FuturePoller::instance().watch(std::move(ready), continuation);
+}
+
+} // namespace rttm::detail
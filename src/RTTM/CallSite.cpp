@@ -0,0 +1,186 @@
+/**
+ * @file CallSite.cpp
+ * @brief Overload resolution and per-arity entries of CallSite
+ */
+
+#include "RTTM/detail/CallSite.hpp"
+#include "RTTM/detail/Exceptions.hpp"
+
+#include <array>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace rttm {
+
+namespace {
+
+// Largest arity with an unrolled entry; longer argument lists use call_dynamic
+constexpr std::size_t max_unrolled_arity = 8;
+
+// Scratch slot large enough for any arithmetic kind
+struct alignas(long double) ConvertedArg {
+    unsigned char bytes[sizeof(long double)];
+};
+
+constexpr std::size_t no_match = std::numeric_limits<std::size_t>::max();
+
+// Conversions needed to pass arg_types to method, or no_match
+std::size_t conversion_cost(const detail::MethodInfo& method, std::span<const CallSite::ArgType> arg_types) {
+    if (!method.exact_invoker || method.param_types.size() != arg_types.size()) {
+        return no_match;
+    }
+    std::size_t cost = 0;
+    for (std::size_t i = 0; i < arg_types.size(); ++i) {
+        if (method.param_types[i] == arg_types[i].type) {
+            continue;
+        }
+        const detail::ArithmeticKind param_kind =
+            i < method.param_kinds.size() ? method.param_kinds[i] : detail::ArithmeticKind::None;
+        if (param_kind == detail::ArithmeticKind::None || arg_types[i].kind == detail::ArithmeticKind::None) {
+            return no_match;
+        }
+        ++cost;
+    }
+    return cost;
+}
+
+std::string describe_args(std::span<const CallSite::ArgType> arg_types) {
+    std::string out = "(";
+    for (std::size_t i = 0; i < arg_types.size(); ++i) {
+        if (i > 0) out += ", ";
+        out += arg_types[i].type.name();
+    }
+    return out + ")";
+}
+
+} // namespace
+
+template<std::size_t N>
+void CallSite::call_exact(const CallSite& site, void* obj, const Variant* args, Variant* ret) {
+    const void* argv[N > 0 ? N : 1] = {};
+    for (std::size_t i = 0; i < N; ++i) {
+        argv[i] = args[i].get_raw();
+    }
+    site.invoker_(static_cast<char*>(obj) + site.this_offset_, argv, ret, site.method_ptr_);
+}
+
+template<std::size_t N>
+void CallSite::call_converting(const CallSite& site, void* obj, const Variant* args, Variant* ret) {
+    const void* argv[N > 0 ? N : 1] = {};
+    ConvertedArg converted[N > 0 ? N : 1] = {};
+    for (std::size_t i = 0; i < N; ++i) {
+        if (const detail::ArithmeticConvertFn convert = site.converters_[i]) {
+            convert(args[i].get_raw(), converted[i].bytes);
+            argv[i] = converted[i].bytes;
+        } else {
+            argv[i] = args[i].get_raw();
+        }
+    }
+    site.invoker_(static_cast<char*>(obj) + site.this_offset_, argv, ret, site.method_ptr_);
+}
+
+void CallSite::call_dynamic(const CallSite& site, void* obj, const Variant* args, Variant* ret) {
+    const std::size_t n = site.arg_types_.size();
+    std::vector<const void*> argv(n);
+    std::vector<ConvertedArg> converted(site.conversions_ > 0 ? n : 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (const detail::ArithmeticConvertFn convert = site.converters_[i]) {
+            convert(args[i].get_raw(), converted[i].bytes);
+            argv[i] = converted[i].bytes;
+        } else {
+            argv[i] = args[i].get_raw();
+        }
+    }
+    site.invoker_(static_cast<char*>(obj) + site.this_offset_, argv.data(), ret, site.method_ptr_);
+}
+
+void CallSite::call_invalid(const CallSite&, void*, const Variant*, Variant*) {
+    throw ReflectionError("CallSite is not resolved");
+}
+
+CallSite CallSite::resolve(const detail::TypeInfo& type, Name method, std::span<const ArgType> arg_types) {
+    const auto* method_list = type.find_methods(method);
+    if (!method_list) [[unlikely]] {
+        throw MethodNotFoundError(type.name, method, type.method_names());
+    }
+
+    const detail::MethodInfo* best = nullptr;
+    std::size_t best_cost = no_match;
+    for (const auto& candidate : *method_list) {
+        const std::size_t cost = conversion_cost(candidate, arg_types);
+        if (cost < best_cost) {
+            best = &candidate;
+            best_cost = cost;
+            if (cost == 0) break;
+        }
+    }
+    if (!best) [[unlikely]] {
+        throw MethodSignatureMismatchError(method, "overload accepting " + describe_args(arg_types),
+                                           "no matching overload");
+    }
+
+    CallSite site;
+    site.method_ = best;
+    site.invoker_ = best->exact_invoker;
+    site.method_ptr_ = best->method_ptr;
+    site.this_offset_ = best->this_offset;
+    site.conversions_ = best_cost;
+    site.arg_types_.reserve(arg_types.size());
+    site.converters_.resize(arg_types.size(), nullptr);
+    for (std::size_t i = 0; i < arg_types.size(); ++i) {
+        site.arg_types_.push_back(arg_types[i].type);
+        if (best->param_types[i] != arg_types[i].type) {
+            site.converters_[i] = detail::conversion_matrix[static_cast<std::size_t>(arg_types[i].kind) - 1]
+                                                          [static_cast<std::size_t>(best->param_kinds[i]) - 1];
+        }
+    }
+
+    static constexpr auto exact_entries = []<std::size_t... N>(std::index_sequence<N...>) {
+        return std::array<Entry, sizeof...(N)>{&call_exact<N>...};
+    }(std::make_index_sequence<max_unrolled_arity + 1>{});
+    static constexpr auto converting_entries = []<std::size_t... N>(std::index_sequence<N...>) {
+        return std::array<Entry, sizeof...(N)>{&call_converting<N>...};
+    }(std::make_index_sequence<max_unrolled_arity + 1>{});
+
+    if (arg_types.size() > max_unrolled_arity) {
+        site.entry_ = &call_dynamic;
+    } else if (best_cost == 0) {
+        site.entry_ = exact_entries[arg_types.size()];
+    } else {
+        site.entry_ = converting_entries[arg_types.size()];
+    }
+    return site;
+}
+
+CallSite CallSite::resolve(const detail::TypeInfo& type, Name method, std::span<const std::type_index> arg_types) {
+    std::vector<ArgType> args;
+    args.reserve(arg_types.size());
+    for (const std::type_index& arg_type : arg_types) {
+        args.push_back(ArgType{arg_type, detail::arithmetic_kind_of(arg_type)});
+    }
+    return resolve(type, method, std::span<const ArgType>{args});
+}
+
+CallSite CallSite::resolve(const detail::TypeInfo& type, Name method, std::span<const Variant> sample_args) {
+    std::vector<ArgType> args;
+    args.reserve(sample_args.size());
+    for (const Variant& sample : sample_args) {
+        args.push_back(ArgType{sample.type(), sample.arithmetic_kind()});
+    }
+    return resolve(type, method, std::span<const ArgType>{args});
+}
+
+bool CallSite::accepts(std::span<const Variant> args) const noexcept {
+    if (!method_ || args.size() != arg_types_.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        if (args[i].type() != arg_types_[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace rttm
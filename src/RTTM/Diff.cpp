@@ -0,0 +1,572 @@
+/**
+ * @file Diff.cpp
+ * @brief Diff plan compilation, change detection and patch application
+ */
+
+#include "RTTM/detail/Diff.hpp"
+#include "RTTM/detail/PlanCache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <unordered_map>
+
+namespace rttm {
+
+// ============================================================================
+// Snapshot
+// ============================================================================
+
+void Snapshot::Deleter::operator()(void* obj) const noexcept {
+    type->destroy_at(obj);
+    ::operator delete(obj, std::align_val_t{type->alignment});
+}
+
+Snapshot::Snapshot(const void* obj, const detail::TypeInfo& type) : type_(&type) {
+    if (!type.copy_construct_raw && !type.copier) [[unlikely]] {
+        throw ObjectNotCreatedError(type.name);
+    }
+    void* storage = ::operator new(type.size, std::align_val_t{type.alignment});
+    try {
+        type.copy_construct_at(storage, obj);
+    } catch (...) {
+        ::operator delete(storage, std::align_val_t{type.alignment});
+        throw;
+    }
+    storage_ = std::unique_ptr<void, Deleter>(storage, Deleter{&type});
+}
+
+void Snapshot::update(const void* obj) {
+    if (!storage_) [[unlikely]] {
+        throw ReflectionError("Cannot update an empty snapshot");
+    }
+    *this = Snapshot(obj, *type_);
+}
+
+namespace detail {
+
+namespace {
+
+// ============================================================================
+// Plans
+// ============================================================================
+
+enum class DiffMode : std::uint8_t {
+    Raw,        ///< Trivially copyable: memcmp, bytes
+    Class,      ///< Registered class: nested patch
+    Ranges,     ///< Contiguous resizable sequence: dirty element ranges
+    Whole       ///< String or other container: whole value when unequal
+};
+
+struct DiffClassPlan;
+
+struct DiffField {
+    std::uint32_t offset = 0;
+    std::uint32_t size = 0;
+    DiffMode mode = DiffMode::Raw;
+    std::uint32_t run_fields = 1;               ///< Raw: adjacent raw fields from here on (self included)
+    std::uint32_t run_size = 0;                 ///< Raw: bytes covered by those fields
+    const ValuePlan* value = nullptr;           ///< Encoding of non-raw values
+    const DiffClassPlan* class_plan = nullptr;  ///< Class
+};
+
+struct DiffClassPlan {
+    const TypeInfo* type = nullptr;
+    std::vector<DiffField> fields;              ///< Offset order
+    std::size_t mask_bytes = 0;
+    bool valid = false;
+    std::string error;
+};
+
+class DiffPlanBuilder;
+using DiffPlanCache = PlanCache<DiffClassPlan, DiffPlanBuilder>;
+
+/**
+ * @brief Compiles diff plans on top of the binary plan of the same type
+ *
+ * Runs under the diff cache lock and takes the binary cache's lock inside
+ * it; the binary serializer never takes ours.
+ */
+class DiffPlanBuilder {
+public:
+    void build(DiffClassPlan& plan) {
+        const TypeInfo& type = *plan.type;
+        const SerializationPlan& encoding = serialization_plan(type);
+
+        std::vector<const MemberInfo*> members;
+        members.reserve(type.members.size());
+        for (const auto& [name, member] : type.members) {
+            members.push_back(&member);
+        }
+        std::sort(members.begin(), members.end(), [](const MemberInfo* a, const MemberInfo* b) {
+            return a->offset < b->offset;
+        });
+
+        plan.fields.reserve(members.size());
+        for (const MemberInfo* member : members) {
+            const TypeCodec* codec = member->codec;
+            DiffField field;
+            field.offset = static_cast<std::uint32_t>(member->offset);
+            field.size = codec->size;
+            if (codec->kind == CodecKind::Trivial) {
+                field.mode = DiffMode::Raw;
+            } else {
+                // Non-trivial members are never merged, so their step is found by offset
+                auto step = std::find_if(encoding.steps.begin(), encoding.steps.end(), [&](const PlanStep& s) {
+                    return s.value && s.offset == field.offset;
+                });
+                if (step == encoding.steps.end()) [[unlikely]] {
+                    throw SerializationError("Member '" + member->name + "' of " + type.name + " has no encoding step");
+                }
+                field.value = step->value;
+                field.mode = diff_mode(*codec);
+                if (field.mode == DiffMode::Class) {
+                    field.class_plan = &nested_class_locked(*codec);
+                }
+            }
+            plan.fields.push_back(field);
+        }
+
+        // Raw runs, back to front: a field extends the run of its successor when exactly adjacent
+        for (std::size_t i = plan.fields.size(); i-- > 0;) {
+            DiffField& field = plan.fields[i];
+            if (field.mode != DiffMode::Raw) {
+                continue;
+            }
+            field.run_fields = 1;
+            field.run_size = field.size;
+            if (i + 1 < plan.fields.size()) {
+                const DiffField& next = plan.fields[i + 1];
+                if (next.mode == DiffMode::Raw && field.offset + field.size == next.offset) {
+                    field.run_fields += next.run_fields;
+                    field.run_size += next.run_size;
+                }
+            }
+        }
+        plan.mask_bytes = (plan.fields.size() + 7) / 8;
+    }
+
+private:
+    static DiffMode diff_mode(const TypeCodec& codec) {
+        switch (codec.kind) {
+            case CodecKind::Class:
+                return DiffMode::Class;
+            case CodecKind::Container:
+                if (!codec.container->associative && codec.container->resize_data) {
+                    return DiffMode::Ranges;
+                }
+                return DiffMode::Whole;
+            default:
+                return DiffMode::Whole;
+        }
+    }
+
+    const DiffClassPlan& nested_class_locked(const TypeCodec& codec) {
+        const TypeInfo* info = TypeManager::instance().get_type_by_id(codec.type_id);
+        if (!info) {
+            throw SerializationError("Unregistered class type in a diff plan");
+        }
+        const DiffClassPlan& nested = DiffPlanCache::instance().class_plan_locked(*info);
+        if (!nested.valid && !nested.error.empty()) {
+            throw SerializationError(nested.error);
+        }
+        return nested;
+    }
+};
+
+const DiffClassPlan& cached_diff_plan(const TypeInfo& type) {
+    return DiffPlanCache::instance().cached(type);
+}
+
+// ============================================================================
+// Equality
+// ============================================================================
+
+bool equal_value(const void* a, const void* b, const ValuePlan& plan);
+
+bool equal_class(const void* a, const void* b, const SerializationPlan& plan) {
+    const auto* lhs = static_cast<const std::byte*>(a);
+    const auto* rhs = static_cast<const std::byte*>(b);
+    for (const PlanStep& step : plan.steps) {
+        if (!step.value) {
+            if (std::memcmp(lhs + step.offset, rhs + step.offset, step.size) != 0) {
+                return false;
+            }
+        } else if (!equal_value(lhs + step.offset, rhs + step.offset, *step.value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Iterator pair of a container, held in a ContainerOps cursor
+ */
+class Cursor {
+public:
+    Cursor(const ContainerOps& ops, const void* container) noexcept : ops_(ops) {
+        ops_.cursor_init(const_cast<void*>(container), state_);
+    }
+    ~Cursor() { ops_.cursor_destroy(state_); }
+
+    Cursor(const Cursor&) = delete;
+    Cursor& operator=(const Cursor&) = delete;
+
+    [[nodiscard]] bool valid() const noexcept { return ops_.cursor_valid(state_); }
+    void next() noexcept { ops_.cursor_next(state_); }
+    [[nodiscard]] void* key() const noexcept { return ops_.cursor_key(state_); }
+    [[nodiscard]] void* value() const noexcept { return ops_.cursor_value(state_); }
+
+private:
+    const ContainerOps& ops_;
+    alignas(std::max_align_t) unsigned char state_[CURSOR_STORAGE_SIZE];
+};
+
+bool equal_container(const void* a, const void* b, const ValuePlan& plan) {
+    const ContainerOps& ops = *plan.codec->container;
+    const std::size_t count = ops.size(a);
+    if (count != ops.size(b)) {
+        return false;
+    }
+    if (count == 0) {
+        return true;
+    }
+    if (ops.contiguous && plan.value && plan.value->codec->kind == CodecKind::Trivial) {
+        return std::memcmp(ops.data(const_cast<void*>(a)), ops.data(const_cast<void*>(b)),
+                           count * ops.value_size) == 0;
+    }
+    for (Cursor lhs(ops, a), rhs(ops, b); lhs.valid(); lhs.next(), rhs.next()) {
+        if (plan.key && !equal_value(lhs.key(), rhs.key(), *plan.key)) {
+            return false;
+        }
+        if (plan.value && !equal_value(lhs.value(), rhs.value(), *plan.value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool equal_value(const void* a, const void* b, const ValuePlan& plan) {
+    switch (plan.codec->kind) {
+        case CodecKind::Trivial:
+            return std::memcmp(a, b, plan.codec->size) == 0;
+        case CodecKind::String:
+            return *static_cast<const std::string*>(a) == *static_cast<const std::string*>(b);
+        case CodecKind::Class:
+            return equal_class(a, b, *plan.class_plan);
+        case CodecKind::Container:
+            return equal_container(a, b, plan);
+        case CodecKind::Unsupported:
+            break;
+    }
+    return true;
+}
+
+// ============================================================================
+// Diff
+// ============================================================================
+
+void write_bytes(std::vector<std::byte>& out, const void* src, std::size_t n) {
+    const std::size_t old_size = out.size();
+    out.resize(old_size + n);
+    std::memcpy(out.data() + old_size, src, n);
+}
+
+void write_varint(std::vector<std::byte>& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::byte>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::byte>(value));
+}
+
+// Bytes per memcmp while skipping clean stretches of a sequence
+constexpr std::size_t scan_chunk = 256;
+
+/**
+ * @brief Byte offset of the first 8-byte word where a and b differ (n if equal)
+ *
+ * Clean chunks go through memcmp (vectorized by the C library); only the
+ * chunk holding the difference is walked word by word. The result may be
+ * up to 7 bytes before the first differing byte.
+ */
+std::size_t first_difference(const std::byte* a, const std::byte* b, std::size_t n) noexcept {
+    std::size_t i = 0;
+    while (i + scan_chunk <= n && std::memcmp(a + i, b + i, scan_chunk) == 0) {
+        i += scan_chunk;
+    }
+    for (; i + 8 <= n; i += 8) {
+        std::uint64_t x, y;
+        std::memcpy(&x, a + i, sizeof(x));
+        std::memcpy(&y, b + i, sizeof(y));
+        if (x != y) {
+            return i;
+        }
+    }
+    return std::memcmp(a + i, b + i, n - i) == 0 ? n : i;
+}
+
+/**
+ * @brief Write the dirty ranges turning old_obj's sequence into new_obj's
+ * @return false (nothing written) if the sequences are equal
+ */
+bool diff_ranges(std::vector<std::byte>& out, const void* old_obj, const void* new_obj, const ValuePlan& plan) {
+    const ContainerOps& ops = *plan.codec->container;
+    const std::size_t old_count = ops.size(old_obj);
+    const std::size_t new_count = ops.size(new_obj);
+    const std::size_t stride = ops.value_size;
+    const ValuePlan& element = *plan.value;
+    const bool trivial = element.codec->kind == CodecKind::Trivial;
+    const auto* lhs = static_cast<const std::byte*>(ops.data(const_cast<void*>(old_obj)));
+    const auto* rhs = static_cast<const std::byte*>(ops.data(const_cast<void*>(new_obj)));
+
+    const auto element_equal = [&](std::size_t i) {
+        return trivial ? std::memcmp(lhs + i * stride, rhs + i * stride, stride) == 0
+                       : equal_value(lhs + i * stride, rhs + i * stride, element);
+    };
+
+    const std::size_t start = out.size();
+    bool changed = old_count != new_count;
+    write_varint(out, new_count);
+
+    std::size_t emitted = 0;    // End of the last range written
+    const auto emit = [&](std::size_t first, std::size_t last) {
+        write_varint(out, first - emitted);
+        write_varint(out, last - first);
+        if (trivial) {
+            write_bytes(out, rhs + first * stride, (last - first) * stride);
+        } else {
+            for (std::size_t i = first; i < last; ++i) {
+                serialize_value(rhs + i * stride, element, out);
+            }
+        }
+        emitted = last;
+        changed = true;
+    };
+
+    const std::size_t common = std::min(old_count, new_count);
+    std::size_t i = 0;
+    while (i < common) {
+        if (trivial) {
+            // Skip the clean stretch word by word, then land on its first dirty element
+            const std::size_t offset = first_difference(lhs + i * stride, rhs + i * stride, (common - i) * stride);
+            i += offset / stride;
+            if (i >= common) {
+                break;
+            }
+        }
+        if (element_equal(i)) {
+            ++i;
+            continue;
+        }
+        const std::size_t first = i;
+        while (i < common && !element_equal(i)) {
+            ++i;
+        }
+        // Merge into a tail that is resent anyway
+        if (i == common && common < new_count) {
+            i = new_count;
+        }
+        emit(first, i);
+    }
+    if (emitted < new_count && common < new_count) {
+        emit(std::max(common, emitted), new_count);
+    }
+
+    if (!changed) {
+        out.resize(start);
+        return false;
+    }
+    write_varint(out, 0);
+    write_varint(out, 0);
+    return true;
+}
+
+/**
+ * @brief Write obj's class patch at the end of out
+ * @return false (nothing written) if the objects are equal
+ */
+bool diff_class(std::vector<std::byte>& out, const void* old_obj, const void* new_obj, const DiffClassPlan& plan) {
+    if (!plan.valid) [[unlikely]] {
+        throw SerializationError(plan.error);
+    }
+    const auto* lhs = static_cast<const std::byte*>(old_obj);
+    const auto* rhs = static_cast<const std::byte*>(new_obj);
+
+    const std::size_t start = out.size();
+    out.resize(start + plan.mask_bytes, std::byte{0});
+    bool changed = false;
+    const auto mark = [&](std::size_t i) {
+        out[start + i / 8] |= static_cast<std::byte>(1u << (i % 8));
+        changed = true;
+    };
+
+    const std::size_t n = plan.fields.size();
+    for (std::size_t i = 0; i < n;) {
+        const DiffField& field = plan.fields[i];
+        switch (field.mode) {
+            case DiffMode::Raw: {
+                const std::size_t run_end = i + field.run_fields;
+                if (std::memcmp(lhs + field.offset, rhs + field.offset, field.run_size) != 0) {
+                    for (std::size_t j = i; j < run_end; ++j) {
+                        const DiffField& member = plan.fields[j];
+                        if (std::memcmp(lhs + member.offset, rhs + member.offset, member.size) != 0) {
+                            mark(j);
+                            write_bytes(out, rhs + member.offset, member.size);
+                        }
+                    }
+                }
+                i = run_end;
+                continue;
+            }
+            case DiffMode::Class:
+                if (diff_class(out, lhs + field.offset, rhs + field.offset, *field.class_plan)) {
+                    mark(i);
+                }
+                break;
+            case DiffMode::Ranges:
+                if (diff_ranges(out, lhs + field.offset, rhs + field.offset, *field.value)) {
+                    mark(i);
+                }
+                break;
+            case DiffMode::Whole:
+                if (!equal_value(lhs + field.offset, rhs + field.offset, *field.value)) {
+                    mark(i);
+                    serialize_value(rhs + field.offset, *field.value, out);
+                }
+                break;
+        }
+        ++i;
+    }
+
+    if (!changed) {
+        out.resize(start);
+    }
+    return changed;
+}
+
+// ============================================================================
+// Patch
+// ============================================================================
+
+class PatchReader {
+public:
+    explicit PatchReader(std::span<const std::byte> in) noexcept
+        : begin_(in.data()), cur_(in.data()), end_(in.data() + in.size()) {}
+
+    const std::byte* take(std::size_t n) {
+        if (n > static_cast<std::size_t>(end_ - cur_)) [[unlikely]] {
+            throw SerializationError("Patch is truncated");
+        }
+        const std::byte* src = cur_;
+        cur_ += n;
+        return src;
+    }
+
+    std::uint64_t varint() {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const auto byte = static_cast<std::uint8_t>(*take(1));
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        throw SerializationError("Malformed length prefix in patch");
+    }
+
+    void value(void* obj, const ValuePlan& plan) {
+        cur_ += deserialize_value(obj, plan, {cur_, end_});
+    }
+
+    [[nodiscard]] std::size_t consumed() const noexcept { return static_cast<std::size_t>(cur_ - begin_); }
+
+private:
+    const std::byte* begin_;
+    const std::byte* cur_;
+    const std::byte* end_;
+};
+
+void apply_ranges(PatchReader& r, void* obj, const ValuePlan& plan) {
+    const ContainerOps& ops = *plan.codec->container;
+    const ValuePlan& element = *plan.value;
+    const std::size_t stride = ops.value_size;
+    const std::uint64_t count = r.varint();
+    auto* data = static_cast<std::byte*>(ops.resize_data(obj, static_cast<std::size_t>(count)));
+
+    std::uint64_t pos = 0;
+    while (true) {
+        const std::uint64_t skip = r.varint();
+        const std::uint64_t n = r.varint();
+        if (n == 0) {
+            break;
+        }
+        if (skip > count - pos || n > count - pos - skip) [[unlikely]] {
+            throw SerializationError("Patch range exceeds the container size");
+        }
+        pos += skip;
+        if (element.codec->kind == CodecKind::Trivial) {
+            std::memcpy(data + pos * stride, r.take(n * stride), n * stride);
+        } else {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                r.value(data + (pos + i) * stride, element);
+            }
+        }
+        pos += n;
+    }
+}
+
+void apply_class(PatchReader& r, void* obj, const DiffClassPlan& plan) {
+    if (!plan.valid) [[unlikely]] {
+        throw SerializationError(plan.error);
+    }
+    auto* base = static_cast<std::byte*>(obj);
+    const std::byte* mask = r.take(plan.mask_bytes);
+    for (std::size_t i = 0; i < plan.fields.size(); ++i) {
+        if (!(static_cast<std::uint8_t>(mask[i / 8]) & (1u << (i % 8)))) {
+            continue;
+        }
+        const DiffField& field = plan.fields[i];
+        switch (field.mode) {
+            case DiffMode::Raw:
+                std::memcpy(base + field.offset, r.take(field.size), field.size);
+                break;
+            case DiffMode::Class:
+                apply_class(r, base + field.offset, *field.class_plan);
+                break;
+            case DiffMode::Ranges:
+                apply_ranges(r, base + field.offset, *field.value);
+                break;
+            case DiffMode::Whole:
+                r.value(base + field.offset, *field.value);
+                break;
+        }
+    }
+}
+
+} // namespace
+
+} // namespace detail
+
+bool diff(const void* old_obj, const void* new_obj, const detail::TypeInfo& type, std::vector<std::byte>& out) {
+    const auto& plan = detail::cached_diff_plan(type);
+    const std::size_t old_size = out.size();
+    try {
+        return detail::diff_class(out, old_obj, new_obj, plan);
+    } catch (...) {
+        out.resize(old_size);
+        throw;
+    }
+}
+
+std::size_t apply_patch(void* obj, const detail::TypeInfo& type, std::span<const std::byte> patch) {
+    if (patch.empty()) {
+        return 0;
+    }
+    const auto& plan = detail::cached_diff_plan(type);
+    detail::PatchReader reader(patch);
+    detail::apply_class(reader, obj, plan);
+    return reader.consumed();
+}
+
+} // namespace rttm
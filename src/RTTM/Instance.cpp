@@ -8,81 +8,68 @@
 
 namespace rttm {
 
+namespace {
+
+// Single indirect call through the member's registered getter thunk
+Variant read_member(const detail::MemberInfo& member, const void* obj) {
+    if (!member.getter) [[unlikely]] {
+        throw ReflectionError("Property is not copyable: " + member.name + " (" + member.type_name + ")");
+    }
+    Variant out;
+    member.getter(static_cast<const char*>(obj) + member.offset, &out);
+    return out;
+}
+
+// Single indirect call through the member's registered setter thunk
+void write_member(const detail::MemberInfo& member, void* obj, const Variant& value) {
+    if (!member.setter) [[unlikely]] {
+        throw ReflectionError("Property is not assignable: " + member.name + " (" + member.type_name + ")");
+    }
+    if (!member.setter(static_cast<char*>(obj) + member.offset, &value)) [[unlikely]] {
+        throw ReflectionError("Cannot assign value to property '" + member.name + "' of type " + member.type_name);
+    }
+    detail::mark_dirty(member, obj);
+}
+
+// Start an awaitable-returning method; failures of the call go into the result
+AsyncResult start_async(const detail::MethodInfo& method, void* obj, std::span<const Variant> args) {
+    auto state = std::make_shared<detail::AsyncState>();
+    try {
+        void* self = method.adjust_this(obj);
+        if (args.size() <= 8) {
+            std::array<const void*, 8> arg_ptrs;
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                arg_ptrs[i] = &args[i];
+            }
+            method.async_invoker(self, &state, arg_ptrs.data(), args.size(), method.method_ptr);
+        } else {
+            std::vector<const void*> arg_ptrs;
+            arg_ptrs.reserve(args.size());
+            for (const auto& v : args) {
+                arg_ptrs.push_back(&v);
+            }
+            method.async_invoker(self, &state, arg_ptrs.data(), args.size(), method.method_ptr);
+        }
+    } catch (...) {
+        return AsyncResult::failed(std::current_exception());
+    }
+    return AsyncResult{std::move(state)};
+}
+
+} // namespace
+
 // ============================================================================
 // DynamicProperty implementation
 // ============================================================================
 
 Variant DynamicProperty::get_value(void* obj) const {
     if (!member_) [[unlikely]] return Variant{};
-    
-    void* prop_ptr = static_cast<char*>(obj) + member_->offset;
-    
-    // Fast path for common types
-    if (member_->type_index == typeid(int)) {
-        return Variant::create(*static_cast<int*>(prop_ptr));
-    }
-    if (member_->type_index == typeid(float)) {
-        return Variant::create(*static_cast<float*>(prop_ptr));
-    }
-    if (member_->type_index == typeid(double)) {
-        return Variant::create(*static_cast<double*>(prop_ptr));
-    }
-    if (member_->type_index == typeid(bool)) {
-        return Variant::create(*static_cast<bool*>(prop_ptr));
-    }
-    if (member_->type_index == typeid(long)) {
-        return Variant::create(*static_cast<long*>(prop_ptr));
-    }
-    if (member_->type_index == typeid(std::string)) {
-        return Variant::create(*static_cast<std::string*>(prop_ptr));
-    }
-    
-    throw ReflectionError("Unsupported property type: " + member_->type_name);
+    return read_member(*member_, obj);
 }
 
 void DynamicProperty::set_value(void* obj, const Variant& value) const {
     if (!member_) [[unlikely]] return;
-    
-    void* prop_ptr = static_cast<char*>(obj) + member_->offset;
-    auto ti = member_->type_index;
-    
-    // Fast path for common types
-    if (ti == typeid(int)) {
-        if (value.is_type<int>()) {
-            *static_cast<int*>(prop_ptr) = value.get_unchecked<int>();
-        } else if (value.can_convert<int>()) {
-            *static_cast<int*>(prop_ptr) = value.convert<int>();
-        }
-        return;
-    }
-    if (ti == typeid(float)) {
-        if (value.is_type<float>()) {
-            *static_cast<float*>(prop_ptr) = value.get_unchecked<float>();
-        } else if (value.can_convert<float>()) {
-            *static_cast<float*>(prop_ptr) = value.convert<float>();
-        }
-        return;
-    }
-    if (ti == typeid(double)) {
-        if (value.is_type<double>()) {
-            *static_cast<double*>(prop_ptr) = value.get_unchecked<double>();
-        } else if (value.can_convert<double>()) {
-            *static_cast<double*>(prop_ptr) = value.convert<double>();
-        }
-        return;
-    }
-    if (ti == typeid(bool)) {
-        if (value.is_type<bool>()) {
-            *static_cast<bool*>(prop_ptr) = value.get_unchecked<bool>();
-        }
-        return;
-    }
-    if (ti == typeid(std::string)) {
-        *static_cast<std::string*>(prop_ptr) = value.get<std::string>();
-        return;
-    }
-    
-    throw ReflectionError("Unsupported property type: " + member_->type_name);
+    write_member(*member_, obj, value);
 }
 
 // ============================================================================
@@ -95,22 +82,23 @@ Variant DynamicMethod::invoke(void* obj, std::span<const Variant> args) const {
     // Fast path: use variant_invoker if available
     if (method_->variant_invoker) {
         Variant result;
+        void* self = method_->adjust_this(obj);
         
         if (args.empty()) {
-            method_->variant_invoker(obj, &result, nullptr, 0, method_->method_ptr);
+            method_->variant_invoker(self, &result, nullptr, 0, method_->method_ptr);
         } else if (args.size() <= 8) {
             std::array<const void*, 8> arg_ptrs;
             for (std::size_t i = 0; i < args.size(); ++i) {
                 arg_ptrs[i] = &args[i];
             }
-            method_->variant_invoker(obj, &result, arg_ptrs.data(), args.size(), method_->method_ptr);
+            method_->variant_invoker(self, &result, arg_ptrs.data(), args.size(), method_->method_ptr);
         } else {
             std::vector<const void*> arg_ptrs;
             arg_ptrs.reserve(args.size());
             for (const auto& v : args) {
                 arg_ptrs.push_back(&v);
             }
-            method_->variant_invoker(obj, &result, arg_ptrs.data(), args.size(), method_->method_ptr);
+            method_->variant_invoker(self, &result, arg_ptrs.data(), args.size(), method_->method_ptr);
         }
         
         return result;
@@ -144,6 +132,21 @@ Variant DynamicMethod::invoke(void* obj, std::span<const Variant> args) const {
     return Instance::convert_result(result, method_->return_type);
 }
 
+AsyncResult DynamicMethod::invoke_async(void* obj, std::span<const Variant> args) const {
+    if (!method_) [[unlikely]] return AsyncResult::ready(Variant{});
+    
+    if (method_->async_invoker) {
+        return start_async(*method_, obj, args);
+    }
+    
+    // Synchronous method: run inline, deliver the outcome through the result
+    try {
+        return AsyncResult::ready(invoke(obj, args));
+    } catch (...) {
+        return AsyncResult::failed(std::current_exception());
+    }
+}
+
 Instance Instance::create(std::string_view type_name) {
     auto& mgr = detail::TypeManager::instance();
     const detail::TypeInfo* info = mgr.get_type(type_name);
@@ -170,6 +173,62 @@ Instance Instance::create(std::string_view type_name) {
     return Instance(std::move(obj), nullptr, info);
 }
 
+Instance Instance::create_in(std::string_view type_name, std::pmr::memory_resource& arena) {
+    const detail::TypeInfo* info = detail::TypeManager::instance().get_type(type_name);
+    if (!info) [[unlikely]] {
+        throw TypeNotRegisteredError(type_name);
+    }
+    return create_in(info, arena);
+}
+
+Instance Instance::create_in(const detail::TypeInfo* type_info, std::pmr::memory_resource& arena) {
+    if (!type_info || !type_info->default_construct_raw) [[unlikely]] {
+        throw ReflectionError("Type is not default constructible in place: " +
+                              (type_info ? type_info->name : std::string("unknown")));
+    }
+    
+    void* storage = arena.allocate(type_info->size, type_info->alignment);
+    try {
+        type_info->default_construct_raw(storage);
+    } catch (...) {
+        arena.deallocate(storage, type_info->size, type_info->alignment);
+        throw;
+    }
+    
+    Instance inst(nullptr, storage, type_info);
+    inst.arena_ = &arena;
+    return inst;
+}
+
+InstanceArray Instance::create_n(std::string_view type_name, std::pmr::memory_resource& arena, std::size_t count) {
+    const detail::TypeInfo* info = detail::TypeManager::instance().get_type(type_name);
+    if (!info) [[unlikely]] {
+        throw TypeNotRegisteredError(type_name);
+    }
+    return create_n(info, arena, count);
+}
+
+InstanceArray Instance::create_n(const detail::TypeInfo* type_info, std::pmr::memory_resource& arena, std::size_t count) {
+    if (!type_info || !type_info->default_construct_raw) [[unlikely]] {
+        throw ReflectionError("Type is not default constructible in place: " +
+                              (type_info ? type_info->name : std::string("unknown")));
+    }
+    if (count == 0) {
+        return InstanceArray{};
+    }
+    
+    const std::size_t bytes = type_info->size * count;
+    void* storage = arena.allocate(bytes, type_info->alignment);
+    try {
+        type_info->construct_n(storage, count);
+    } catch (...) {
+        arena.deallocate(storage, bytes, type_info->alignment);
+        throw;
+    }
+    
+    return InstanceArray(&arena, type_info, storage, count);
+}
+
 Instance Instance::from_owned(std::shared_ptr<void> obj, const detail::TypeInfo* type_info) {
     return Instance(std::move(obj), nullptr, type_info);
 }
@@ -178,7 +237,7 @@ Instance Instance::from_ref(void* obj, const detail::TypeInfo* type_info) {
     return Instance(nullptr, obj, type_info);
 }
 
-Variant Instance::get_property(std::string_view name) const {
+Variant Instance::get_property(Name name) const {
     if (!is_valid()) [[unlikely]] {
         throw ObjectNotCreatedError(type_name().empty() ? "unknown" : std::string(type_name()));
     }
@@ -188,23 +247,10 @@ Variant Instance::get_property(std::string_view name) const {
         throw PropertyNotFoundError(std::string(type_name()), name, type_info_->member_names());
     }
     
-    void* obj_ptr = const_cast<void*>(get_raw());
-    void* prop_ptr = static_cast<char*>(obj_ptr) + member->offset;
-    auto ti = member->type_index;
-    
-    // Direct type checks (faster than map lookup)
-    if (ti == typeid(int)) return Variant::create(*static_cast<int*>(prop_ptr));
-    if (ti == typeid(float)) return Variant::create(*static_cast<float*>(prop_ptr));
-    if (ti == typeid(double)) return Variant::create(*static_cast<double*>(prop_ptr));
-    if (ti == typeid(bool)) return Variant::create(*static_cast<bool*>(prop_ptr));
-    if (ti == typeid(long)) return Variant::create(*static_cast<long*>(prop_ptr));
-    if (ti == typeid(long long)) return Variant::create(*static_cast<long long*>(prop_ptr));
-    if (ti == typeid(std::string)) return Variant::create(*static_cast<std::string*>(prop_ptr));
-    
-    throw ReflectionError("Unsupported property type: " + member->type_name);
+    return read_member(*member, get_raw());
 }
 
-void Instance::set_property(std::string_view name, const Variant& value) {
+void Instance::set_property(Name name, const Variant& value) {
     if (!is_valid()) [[unlikely]] {
         throw ObjectNotCreatedError(type_name().empty() ? "unknown" : std::string(type_name()));
     }
@@ -214,57 +260,31 @@ void Instance::set_property(std::string_view name, const Variant& value) {
         throw PropertyNotFoundError(std::string(type_name()), name, type_info_->member_names());
     }
     
-    void* obj_ptr = const_cast<void*>(get_raw());
-    void* prop_ptr = static_cast<char*>(obj_ptr) + member->offset;
-    auto ti = member->type_index;
-    
-    // Direct type checks (faster than map lookup)
-    if (ti == typeid(int)) {
-        if (value.is_type<int>()) [[likely]] {
-            *static_cast<int*>(prop_ptr) = value.get_unchecked<int>();
-        } else {
-            *static_cast<int*>(prop_ptr) = value.convert<int>();
-        }
-        return;
-    }
-    if (ti == typeid(float)) {
-        if (value.is_type<float>()) [[likely]] {
-            *static_cast<float*>(prop_ptr) = value.get_unchecked<float>();
-        } else {
-            *static_cast<float*>(prop_ptr) = value.convert<float>();
-        }
-        return;
-    }
-    if (ti == typeid(double)) {
-        if (value.is_type<double>()) [[likely]] {
-            *static_cast<double*>(prop_ptr) = value.get_unchecked<double>();
-        } else {
-            *static_cast<double*>(prop_ptr) = value.convert<double>();
-        }
-        return;
-    }
-    if (ti == typeid(bool)) {
-        *static_cast<bool*>(prop_ptr) = value.is_type<bool>() ? value.get_unchecked<bool>() : value.convert<bool>();
-        return;
-    }
-    if (ti == typeid(long)) {
-        *static_cast<long*>(prop_ptr) = value.is_type<long>() ? value.get_unchecked<long>() : value.convert<long>();
-        return;
-    }
-    if (ti == typeid(long long)) {
-        *static_cast<long long*>(prop_ptr) = value.is_type<long long>() ? value.get_unchecked<long long>() : value.convert<long long>();
-        return;
-    }
-    if (ti == typeid(std::string)) {
-        *static_cast<std::string*>(prop_ptr) = value.get<std::string>();
-        return;
+    write_member(*member, get_raw(), value);
+}
+
+const detail::MemberInfo& Instance::resolve_member(std::size_t ordinal) const {
+    if (!is_valid()) [[unlikely]] {
+        throw ObjectNotCreatedError(type_name().empty() ? "unknown" : std::string(type_name()));
     }
     
-    throw ReflectionError("Unsupported property type: " + member->type_name);
+    const detail::MemberInfo* member = type_info_->member_at(ordinal);
+    if (!member) [[unlikely]] {
+        throw PropertyNotFoundError(std::string(type_name()), "#" + std::to_string(ordinal),
+                                    type_info_->member_names());
+    }
+    return *member;
 }
 
-// Optimized invoke: use variant_invoker when available
-Variant Instance::invoke(std::string_view name, std::span<const Variant> args) const {
+Variant Instance::get_property(std::size_t ordinal) const {
+    return read_member(resolve_member(ordinal), get_raw());
+}
+
+void Instance::set_property(std::size_t ordinal, const Variant& value) {
+    write_member(resolve_member(ordinal), get_raw(), value);
+}
+
+const detail::MethodInfo& Instance::resolve_method(Name name, std::size_t nargs) const {
     if (!is_valid()) [[unlikely]] {
         throw ObjectNotCreatedError(type_name().empty() ? "unknown" : std::string(type_name()));
     }
@@ -275,34 +295,65 @@ Variant Instance::invoke(std::string_view name, std::span<const Variant> args) c
     }
     
     // Find overload with matching parameter count
-    const detail::MethodInfo* matched = nullptr;
     for (const auto& method : *method_list) {
-        if (method.param_types.size() == args.size()) {
-            matched = &method;
-            break;
+        if (method.param_types.size() == nargs) {
+            return method;
         }
     }
     
-    if (!matched) [[unlikely]] {
-        throw MethodSignatureMismatchError(name, "expected " + std::to_string(args.size()) + " args", 
-                                           "no matching overload");
+    throw MethodSignatureMismatchError(name, "expected " + std::to_string(nargs) + " args", 
+                                       "no matching overload");
+}
+
+const detail::MethodInfo& Instance::resolve_method(std::size_t ordinal, std::size_t nargs) const {
+    if (!is_valid()) [[unlikely]] {
+        throw ObjectNotCreatedError(type_name().empty() ? "unknown" : std::string(type_name()));
+    }
+    
+    const auto* method_list = type_info_->methods_at(ordinal);
+    if (!method_list) [[unlikely]] {
+        throw MethodNotFoundError(std::string(type_name()), "#" + std::to_string(ordinal),
+                                  type_info_->method_names());
     }
     
+    for (const auto& method : *method_list) {
+        if (method.param_types.size() == nargs) {
+            return method;
+        }
+    }
+    
+    throw MethodSignatureMismatchError(method_list->front().name, "expected " + std::to_string(nargs) + " args",
+                                       "no matching overload");
+}
+
+Variant Instance::invoke(Name name, std::span<const Variant> args) const {
+    return call_method(resolve_method(name, args.size()), args);
+}
+
+Variant Instance::invoke(std::size_t ordinal, std::span<const Variant> args) const {
+    return call_method(resolve_method(ordinal, args.size()), args);
+}
+
+// Optimized invoke: use variant_invoker when available
+Variant Instance::call_method(const detail::MethodInfo& method, std::span<const Variant> args) const {
+    const detail::MethodInfo* matched = &method;
+    
     void* obj_ptr = const_cast<void*>(get_raw());
     
     // Fast path: use variant_invoker if available (avoids std::any conversion)
     if (matched->variant_invoker) [[likely]] {
         Variant result;
+        void* self = matched->adjust_this(obj_ptr);
         
         if (args.empty()) {
-            matched->variant_invoker(obj_ptr, &result, nullptr, 0, matched->method_ptr);
+            matched->variant_invoker(self, &result, nullptr, 0, matched->method_ptr);
         } else if (args.size() <= 8) {
             // Use stack array for small arg counts
             std::array<const void*, 8> arg_ptrs;
             for (std::size_t i = 0; i < args.size(); ++i) {
                 arg_ptrs[i] = &args[i];
             }
-            matched->variant_invoker(obj_ptr, &result, arg_ptrs.data(), args.size(), matched->method_ptr);
+            matched->variant_invoker(self, &result, arg_ptrs.data(), args.size(), matched->method_ptr);
         } else {
             // Fallback for many args
             std::vector<const void*> arg_ptrs;
@@ -310,7 +361,7 @@ Variant Instance::invoke(std::string_view name, std::span<const Variant> args) c
             for (const auto& v : args) {
                 arg_ptrs.push_back(&v);
             }
-            matched->variant_invoker(obj_ptr, &result, arg_ptrs.data(), args.size(), matched->method_ptr);
+            matched->variant_invoker(self, &result, arg_ptrs.data(), args.size(), matched->method_ptr);
         }
         
         return result;
@@ -414,4 +465,9 @@ Instance Instance::from_owned(std::shared_ptr<T> obj) {
     return Instance(std::static_pointer_cast<void>(obj), nullptr, info);
 }
 
+AsyncResult Instance::invoke_async(Name name, std::span<const Variant> args) const {
+    const detail::MethodInfo& method = resolve_method(name, args.size());
+    return DynamicMethod{&method, type_info_}.invoke_async(const_cast<void*>(get_raw()), args);
+}
+
 } // namespace rttm
@@ -0,0 +1,996 @@
+/**
+ * @file JsonSerializer.cpp
+ * @brief Plan compilation, streaming writer and one-pass reader for JSON
+ */
+
+#include "RTTM/detail/JsonSerializer.hpp"
+#include "RTTM/detail/PlanCache.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+
+namespace rttm {
+
+namespace detail {
+
+namespace {
+
+// ============================================================================
+// Plans
+// ============================================================================
+
+enum class JsonKind : std::uint8_t {
+    Bool,
+    Number,
+    String,
+    Object,     ///< Registered class
+    Array,      ///< Sequential container or set
+    Map         ///< Key-value container
+};
+
+struct JsonClassPlan;
+
+/**
+ * @brief JSON mapping of one value type
+ */
+struct JsonValuePlan {
+    JsonKind kind = JsonKind::Number;
+    ArithmeticKind arithmetic = ArithmeticKind::None;
+    const TypeCodec* codec = nullptr;
+    const JsonClassPlan* class_plan = nullptr;  ///< Object
+    const JsonValuePlan* key = nullptr;         ///< Map keys (Bool, Number or String)
+    const JsonValuePlan* value = nullptr;       ///< Array elements, map values
+};
+
+/**
+ * @brief One member with its key pre-escaped as ,"name":
+ */
+struct JsonField {
+    std::string name;
+    std::string key;                ///< The first member is written from key.data() + 1
+    std::size_t hash = 0;
+    std::uint32_t offset = 0;
+    const JsonValuePlan* value = nullptr;
+};
+
+struct JsonClassPlan {
+    const TypeInfo* type = nullptr;
+    std::vector<JsonField> fields;                              ///< Offset order
+    std::unordered_map<std::size_t, std::uint32_t> by_hash;     ///< Out-of-order keys
+    bool valid = false;
+    std::string error;
+};
+
+void append_escaped(std::string& out, std::string_view text);
+
+class JsonPlanBuilder;
+using JsonPlanCache = PlanCache<JsonClassPlan, JsonPlanBuilder>;
+
+/**
+ * @brief Compiles JSON plans; value plans are shared by codec
+ */
+class JsonPlanBuilder {
+public:
+    void build(JsonClassPlan& plan) {
+        const TypeInfo& type = *plan.type;
+
+        std::vector<const MemberInfo*> members;
+        members.reserve(type.members.size());
+        for (const auto& [name, member] : type.members) {
+            members.push_back(&member);
+        }
+        std::sort(members.begin(), members.end(), [](const MemberInfo* a, const MemberInfo* b) {
+            return a->offset < b->offset;
+        });
+
+        plan.fields.reserve(members.size());
+        for (const MemberInfo* member : members) {
+            if (!member->codec) {
+                throw SerializationError("Member '" + member->name + "' of " + type.name +
+                                         " has no JSON mapping (" + member->type_name + ")");
+            }
+            JsonField field;
+            field.name = member->name;
+            field.key = ",";
+            append_escaped(field.key, member->name);
+            field.key += ':';
+            field.hash = fnv1a_hash(member->name);
+            field.offset = static_cast<std::uint32_t>(member->offset);
+            field.value = value_plan_locked(member->codec, type.name + "::" + member->name);
+            plan.by_hash.emplace(field.hash, static_cast<std::uint32_t>(plan.fields.size()));
+            plan.fields.push_back(std::move(field));
+        }
+    }
+
+private:
+    const JsonValuePlan* value_plan_locked(const TypeCodec* codec, const std::string& where) {
+        auto it = values_.find(codec);
+        if (it != values_.end()) {
+            return it->second.get();
+        }
+
+        auto plan = std::make_unique<JsonValuePlan>();
+        plan->codec = codec;
+        plan->arithmetic = codec->arithmetic;
+        switch (codec->kind) {
+            case CodecKind::Trivial:
+                if (codec->arithmetic == ArithmeticKind::Bool) {
+                    plan->kind = JsonKind::Bool;
+                } else if (codec->arithmetic != ArithmeticKind::None) {
+                    plan->kind = JsonKind::Number;
+                } else {
+                    // Trivially copyable structs are objects when registered
+                    plan->kind = JsonKind::Object;
+                    plan->class_plan = &nested_class_locked(codec, where);
+                }
+                break;
+            case CodecKind::String:
+                plan->kind = JsonKind::String;
+                break;
+            case CodecKind::Class:
+                plan->kind = JsonKind::Object;
+                plan->class_plan = &nested_class_locked(codec, where);
+                break;
+            case CodecKind::Container: {
+                const ContainerOps& ops = *codec->container;
+                if (!ops.append_element) {
+                    throw SerializationError("Container elements are not default constructible in " + where);
+                }
+                if (ops.mapped) {
+                    plan->kind = JsonKind::Map;
+                    plan->key = value_plan_locked(ops.key_codec, where);
+                    if (plan->key->kind != JsonKind::String && plan->key->kind != JsonKind::Number &&
+                        plan->key->kind != JsonKind::Bool) {
+                        throw SerializationError("Map keys must be strings or arithmetic in " + where);
+                    }
+                    plan->value = value_plan_locked(ops.value_codec, where);
+                } else {
+                    plan->kind = JsonKind::Array;
+                    plan->value = value_plan_locked(ops.associative ? ops.key_codec : ops.value_codec, where);
+                }
+                break;
+            }
+            case CodecKind::Unsupported:
+                throw SerializationError("Type has no JSON mapping in " + where);
+        }
+        return values_.emplace(codec, std::move(plan)).first->second.get();
+    }
+
+    const JsonClassPlan& nested_class_locked(const TypeCodec* codec, const std::string& where) {
+        const TypeInfo* info = TypeManager::instance().get_type_by_id(codec->type_id);
+        if (!info) {
+            throw SerializationError("Unregistered class type in " + where);
+        }
+        const JsonClassPlan& nested = JsonPlanCache::instance().class_plan_locked(*info);
+        if (!nested.valid && !nested.error.empty()) {
+            throw SerializationError(nested.error);
+        }
+        return nested;
+    }
+
+    std::unordered_map<const TypeCodec*, std::unique_ptr<JsonValuePlan>> values_;
+};
+
+const JsonClassPlan& cached_json_plan(const TypeInfo& type) {
+    return JsonPlanCache::instance().cached(type);
+}
+
+// ============================================================================
+// Character scanning
+// ============================================================================
+
+[[nodiscard]] constexpr bool is_special(char c) noexcept {
+    return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+}
+
+/**
+ * @brief First '"', '\\' or control character in [p, end)
+ *
+ * Tests eight bytes per step with SWAR bit tricks on little-endian
+ * targets: a byte flags when it equals '"' or '\\', or is below 0x20.
+ * Borrows can only produce false positives above a real match, so the
+ * lowest flagged byte is always exact.
+ */
+[[nodiscard]] const char* find_special(const char* p, const char* end) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        constexpr std::uint64_t ones = 0x0101010101010101ull;
+        constexpr std::uint64_t highs = 0x8080808080808080ull;
+        while (end - p >= 8) {
+            std::uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            const std::uint64_t quote = word ^ (ones * '"');
+            const std::uint64_t slash = word ^ (ones * '\\');
+            const std::uint64_t mask = (((quote - ones) & ~quote) |
+                                        ((slash - ones) & ~slash) |
+                                        ((word - ones * 0x20) & ~word)) & highs;
+            if (mask) {
+                return p + (std::countr_zero(mask) >> 3);
+            }
+            p += 8;
+        }
+    }
+    while (p < end && !is_special(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+void escape_char(std::string& out, char c) {
+    switch (c) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\b': out += "\\b"; break;
+        case '\f': out += "\\f"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default: {
+            static constexpr char hex[] = "0123456789abcdef";
+            const auto byte = static_cast<unsigned char>(c);
+            const char escaped[6] = {'\\', 'u', '0', '0', hex[byte >> 4], hex[byte & 0xF]};
+            out.append(escaped, sizeof(escaped));
+            break;
+        }
+    }
+}
+
+void append_escaped(std::string& out, std::string_view text) {
+    out += '"';
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p < end) {
+        const char* special = find_special(p, end);
+        out.append(p, special);
+        if (special == end) break;
+        escape_char(out, *special);
+        p = special + 1;
+    }
+    out += '"';
+}
+
+/**
+ * @brief Call f with *static_cast<const T*>(src) for the T of kind
+ */
+template<typename F>
+decltype(auto) visit_arithmetic(ArithmeticKind kind, const void* src, F&& f) {
+    switch (kind) {
+        case ArithmeticKind::Bool:             return f(*static_cast<const bool*>(src));
+        case ArithmeticKind::Char:             return f(*static_cast<const char*>(src));
+        case ArithmeticKind::SignedChar:       return f(*static_cast<const signed char*>(src));
+        case ArithmeticKind::UnsignedChar:     return f(*static_cast<const unsigned char*>(src));
+        case ArithmeticKind::Short:            return f(*static_cast<const short*>(src));
+        case ArithmeticKind::UnsignedShort:    return f(*static_cast<const unsigned short*>(src));
+        case ArithmeticKind::Int:              return f(*static_cast<const int*>(src));
+        case ArithmeticKind::UnsignedInt:      return f(*static_cast<const unsigned int*>(src));
+        case ArithmeticKind::Long:             return f(*static_cast<const long*>(src));
+        case ArithmeticKind::UnsignedLong:     return f(*static_cast<const unsigned long*>(src));
+        case ArithmeticKind::LongLong:         return f(*static_cast<const long long*>(src));
+        case ArithmeticKind::UnsignedLongLong: return f(*static_cast<const unsigned long long*>(src));
+        case ArithmeticKind::Float:            return f(*static_cast<const float*>(src));
+        case ArithmeticKind::Double:           return f(*static_cast<const double*>(src));
+        case ArithmeticKind::LongDouble:       return f(*static_cast<const long double*>(src));
+        case ArithmeticKind::None:             break;
+    }
+    return f(0);
+}
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+/**
+ * @brief Appends into a std::string grown geometrically; size fixed up by finish()
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& out) noexcept : out_(out), len_(out.size()) {}
+
+    char* reserve(std::size_t n) {
+        if (out_.size() - len_ < n) [[unlikely]] {
+            out_.resize(std::max({out_.capacity(), out_.size() * 2, len_ + n + 256}));
+        }
+        return out_.data() + len_;
+    }
+
+    void commit(std::size_t n) noexcept { len_ += n; }
+
+    void put(char c) {
+        *reserve(1) = c;
+        ++len_;
+    }
+
+    void write(const char* s, std::size_t n) {
+        std::memcpy(reserve(n), s, n);
+        len_ += n;
+    }
+
+    void write(std::string_view s) { write(s.data(), s.size()); }
+
+    void finish() { out_.resize(len_); }
+
+private:
+    std::string& out_;
+    std::size_t len_;
+};
+
+// Longest to_chars output of any arithmetic kind, with room to spare
+constexpr std::size_t max_number_chars = 64;
+
+template<typename T>
+void write_number(JsonWriter& w, T value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        w.write(value ? std::string_view{"true"} : std::string_view{"false"});
+    } else if constexpr (std::is_floating_point_v<T>) {
+        if (!std::isfinite(value)) [[unlikely]] {
+            w.write("null", 4);
+            return;
+        }
+        char* p = w.reserve(max_number_chars);
+        w.commit(static_cast<std::size_t>(std::to_chars(p, p + max_number_chars, value).ptr - p));
+    } else if constexpr (sizeof(T) == 1) {
+        // char types are numbers, not one-character strings
+        write_number(w, static_cast<int>(value));
+    } else {
+        char* p = w.reserve(max_number_chars);
+        w.commit(static_cast<std::size_t>(std::to_chars(p, p + max_number_chars, value).ptr - p));
+    }
+}
+
+void write_string(JsonWriter& w, std::string_view text) {
+    w.put('"');
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p < end) {
+        const char* special = find_special(p, end);
+        w.write(p, static_cast<std::size_t>(special - p));
+        if (special == end) break;
+        std::string escaped;
+        escape_char(escaped, *special);
+        w.write(escaped);
+        p = special + 1;
+    }
+    w.put('"');
+}
+
+void write_class(JsonWriter& w, const void* obj, const JsonClassPlan& plan);
+void write_value(JsonWriter& w, const void* obj, const JsonValuePlan& plan);
+
+void write_key(JsonWriter& w, const void* key, const JsonValuePlan& plan) {
+    if (plan.kind == JsonKind::String) {
+        write_string(w, *static_cast<const std::string*>(key));
+    } else {
+        w.put('"');
+        write_value(w, key, plan);
+        w.put('"');
+    }
+}
+
+struct WriteContext {
+    JsonWriter* writer;
+    const JsonValuePlan* plan;
+    bool first;
+};
+
+bool write_element(void* ctx, void* key, void* value) {
+    auto& c = *static_cast<WriteContext*>(ctx);
+    if (!c.first) {
+        c.writer->put(',');
+    }
+    c.first = false;
+    if (c.plan->kind == JsonKind::Map) {
+        write_key(*c.writer, key, *c.plan->key);
+        c.writer->put(':');
+    }
+    write_value(*c.writer, value, *c.plan->value);
+    return true;
+}
+
+void write_container(JsonWriter& w, const void* obj, const JsonValuePlan& plan) {
+    const ContainerOps& ops = *plan.codec->container;
+    void* container = const_cast<void*>(obj);
+    const bool is_map = plan.kind == JsonKind::Map;
+    const std::size_t count = ops.size(container);
+    w.put(is_map ? '{' : '[');
+    if (count > 0) {
+        const JsonValuePlan& element = *plan.value;
+        if (!is_map && ops.contiguous && element.kind == JsonKind::Number) {
+            // Contiguous numbers: stride through the data, no visitor calls
+            const auto* data = static_cast<const std::byte*>(ops.data(container));
+            visit_arithmetic(element.arithmetic, data, [&]<typename T>(const T&) {
+                const auto* values = reinterpret_cast<const T*>(data);
+                write_number(w, values[0]);
+                for (std::size_t i = 1; i < count; ++i) {
+                    w.put(',');
+                    write_number(w, values[i]);
+                }
+            });
+        } else {
+            WriteContext ctx{&w, &plan, true};
+            ops.visit(container, 0, count, &write_element, &ctx);
+        }
+    }
+    w.put(is_map ? '}' : ']');
+}
+
+void write_value(JsonWriter& w, const void* obj, const JsonValuePlan& plan) {
+    switch (plan.kind) {
+        case JsonKind::Bool:
+        case JsonKind::Number:
+            visit_arithmetic(plan.arithmetic, obj, [&](auto value) { write_number(w, value); });
+            break;
+        case JsonKind::String:
+            write_string(w, *static_cast<const std::string*>(obj));
+            break;
+        case JsonKind::Object:
+            write_class(w, obj, *plan.class_plan);
+            break;
+        case JsonKind::Array:
+        case JsonKind::Map:
+            write_container(w, obj, plan);
+            break;
+    }
+}
+
+void write_class(JsonWriter& w, const void* obj, const JsonClassPlan& plan) {
+    if (!plan.valid) [[unlikely]] {
+        throw SerializationError(plan.error);
+    }
+    const auto* base = static_cast<const std::byte*>(obj);
+    w.put('{');
+    for (std::size_t i = 0; i < plan.fields.size(); ++i) {
+        const JsonField& field = plan.fields[i];
+        if (i == 0) {
+            w.write(field.key.data() + 1, field.key.size() - 1);
+        } else {
+            w.write(field.key);
+        }
+        write_value(w, base + field.offset, *field.value);
+    }
+    w.put('}');
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+class JsonReader {
+public:
+    /**
+     * @brief Deepest object/array nesting accepted; deeper input would overflow the stack
+     */
+    static constexpr std::size_t max_depth = 512;
+
+    explicit JsonReader(std::string_view in) noexcept
+        : begin_(in.data()), cur_(in.data()), end_(in.data() + in.size()) {}
+
+    /**
+     * @brief One level of object/array nesting, for the enclosing scope
+     */
+    class Nested {
+    public:
+        explicit Nested(JsonReader& r) : r_(r) {
+            if (++r_.depth_ > max_depth) [[unlikely]] {
+                r_.fail("nesting too deep");
+            }
+        }
+        ~Nested() { --r_.depth_; }
+
+        Nested(const Nested&) = delete;
+        Nested& operator=(const Nested&) = delete;
+
+    private:
+        JsonReader& r_;
+    };
+
+    void skip_ws() noexcept {
+        while (cur_ < end_ && (*cur_ == ' ' || *cur_ == '\n' || *cur_ == '\r' || *cur_ == '\t')) {
+            ++cur_;
+        }
+    }
+
+    char peek() {
+        skip_ws();
+        if (cur_ == end_) [[unlikely]] {
+            fail("unexpected end of input");
+        }
+        return *cur_;
+    }
+
+    bool consume(char c) {
+        if (peek() == c) {
+            ++cur_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!consume(c)) [[unlikely]] {
+            fail(std::string("expected '") + c + "'");
+        }
+    }
+
+    bool consume_literal(std::string_view literal) noexcept {
+        if (static_cast<std::size_t>(end_ - cur_) >= literal.size() &&
+            std::memcmp(cur_, literal.data(), literal.size()) == 0) {
+            cur_ += literal.size();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Skip a null literal if one is next
+     */
+    bool consume_null() {
+        return peek() == 'n' && consume_literal("null");
+    }
+
+    /**
+     * @brief Parse a string; the view points into the input when it has no escapes
+     */
+    std::string_view read_string() {
+        expect('"');
+        const char* start = cur_;
+        const char* p = find_special(cur_, end_);
+        if (p < end_ && *p == '"') [[likely]] {
+            cur_ = p + 1;
+            return {start, static_cast<std::size_t>(p - start)};
+        }
+        scratch_.assign(start, p);
+        cur_ = p;
+        while (true) {
+            if (cur_ == end_) [[unlikely]] {
+                fail("unterminated string");
+            }
+            const char c = *cur_;
+            if (c == '"') {
+                ++cur_;
+                return scratch_;
+            }
+            if (c != '\\') [[unlikely]] {
+                fail("control character in string");
+            }
+            ++cur_;
+            read_escape();
+            const char* run_end = find_special(cur_, end_);
+            scratch_.append(cur_, run_end);
+            cur_ = run_end;
+        }
+    }
+
+    /**
+     * @brief Characters of the number starting at the cursor
+     */
+    std::string_view number_text() {
+        skip_ws();
+        const char* start = cur_;
+        while (cur_ < end_) {
+            const char c = *cur_;
+            if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+                ++cur_;
+            } else {
+                break;
+            }
+        }
+        if (cur_ == start) [[unlikely]] {
+            fail("expected number");
+        }
+        return {start, static_cast<std::size_t>(cur_ - start)};
+    }
+
+    /**
+     * @brief Parse an integer at the cursor; false (cursor unchanged) if it is not one
+     */
+    template<typename T>
+    bool parse_integer_at(void* dst) noexcept {
+        T value;
+        auto [ptr, ec] = std::from_chars(cur_, end_, value);
+        if (ec != std::errc{} || (ptr != end_ && (*ptr == '.' || *ptr == 'e' || *ptr == 'E'))) {
+            return false;
+        }
+        std::memcpy(dst, &value, sizeof(T));
+        cur_ = ptr;
+        return true;
+    }
+
+    /**
+     * @brief Parse the number at the cursor into dst
+     *
+     * Integers parse in place; anything from_chars stops short on
+     * (fractions, exponents) takes the general text path.
+     */
+    void read_number(ArithmeticKind kind, void* dst) {
+        skip_ws();
+        bool parsed = false;
+        switch (kind) {
+            case ArithmeticKind::Short:            parsed = parse_integer_at<short>(dst); break;
+            case ArithmeticKind::UnsignedShort:    parsed = parse_integer_at<unsigned short>(dst); break;
+            case ArithmeticKind::Int:              parsed = parse_integer_at<int>(dst); break;
+            case ArithmeticKind::UnsignedInt:      parsed = parse_integer_at<unsigned int>(dst); break;
+            case ArithmeticKind::Long:             parsed = parse_integer_at<long>(dst); break;
+            case ArithmeticKind::UnsignedLong:     parsed = parse_integer_at<unsigned long>(dst); break;
+            case ArithmeticKind::LongLong:         parsed = parse_integer_at<long long>(dst); break;
+            case ArithmeticKind::UnsignedLongLong: parsed = parse_integer_at<unsigned long long>(dst); break;
+            default:                               break;
+        }
+        if (!parsed) {
+            read_number(number_text(), kind, dst);
+        }
+    }
+
+    void read_number(std::string_view text, ArithmeticKind kind, void* dst) {
+        if (kind == ArithmeticKind::Bool) {
+            if (text == "true" || text == "1") { *static_cast<bool*>(dst) = true; return; }
+            if (text == "false" || text == "0") { *static_cast<bool*>(dst) = false; return; }
+            fail("expected boolean");
+        }
+        switch (parse_number(text, kind, dst)) {
+            case NumberStatus::Ok:
+                return;
+            case NumberStatus::OutOfRange:
+                fail("number out of range '" + std::string(text) + "'");
+            case NumberStatus::Invalid:
+                fail("invalid number '" + std::string(text) + "'");
+        }
+    }
+
+    void skip_value() {
+        switch (peek()) {
+            case '"':
+                (void)read_string();
+                break;
+            case '{': {
+                Nested nested(*this);
+                ++cur_;
+                if (consume('}')) break;
+                do {
+                    (void)read_string();
+                    expect(':');
+                    skip_value();
+                } while (consume(','));
+                expect('}');
+                break;
+            }
+            case '[': {
+                Nested nested(*this);
+                ++cur_;
+                if (consume(']')) break;
+                do {
+                    skip_value();
+                } while (consume(','));
+                expect(']');
+                break;
+            }
+            case 't':
+                if (!consume_literal("true")) fail("invalid literal");
+                break;
+            case 'f':
+                if (!consume_literal("false")) fail("invalid literal");
+                break;
+            case 'n':
+                if (!consume_literal("null")) fail("invalid literal");
+                break;
+            default:
+                (void)number_text();
+                break;
+        }
+    }
+
+    [[noreturn]] void fail(const std::string& what) const {
+        throw SerializationError("Invalid JSON at offset " + std::to_string(cur_ - begin_) + ": " + what);
+    }
+
+    [[nodiscard]] std::size_t consumed() const noexcept { return static_cast<std::size_t>(cur_ - begin_); }
+
+private:
+    enum class NumberStatus { Ok, Invalid, OutOfRange };
+
+    static NumberStatus parse_number(std::string_view text, ArithmeticKind kind, void* dst) {
+        const char* first = text.data();
+        const char* last = first + text.size();
+        if (*first == '+') ++first;     // JSON has no '+', but be lenient with hand-written files
+        const auto parse = [&]<typename T>(T& out) {
+            auto [ptr, ec] = std::from_chars(first, last, out);
+            if (ptr != last || ec == std::errc::invalid_argument) return NumberStatus::Invalid;
+            return ec == std::errc{} ? NumberStatus::Ok : NumberStatus::OutOfRange;
+        };
+        const auto parse_as = [&]<typename T>(std::type_identity<T>) {
+            T value{};
+            if constexpr (std::is_unsigned_v<T>) {
+                if (*first == '-') return NumberStatus::OutOfRange;
+            }
+            NumberStatus status = parse(value);
+            if constexpr (std::is_integral_v<T>) {
+                // 1.0 or 1e3 into an integer: go through double, truncating,
+                // but only when it fits
+                if (status == NumberStatus::Invalid && text.find_first_of(".eE") != std::string_view::npos) {
+                    double real = 0;
+                    status = parse(real);
+                    if (status != NumberStatus::Ok) return status;
+                    real = std::trunc(real);
+                    constexpr double lowest = static_cast<double>(std::numeric_limits<T>::min());
+                    constexpr double limit = static_cast<double>(std::numeric_limits<T>::max() / 2 + 1) * 2.0;
+                    if (!(real >= lowest && real < limit)) return NumberStatus::OutOfRange;
+                    value = static_cast<T>(real);
+                }
+            }
+            if (status == NumberStatus::Ok) {
+                std::memcpy(dst, &value, sizeof(T));
+            }
+            return status;
+        };
+        switch (kind) {
+            case ArithmeticKind::Char:             return parse_as(std::type_identity<signed char>{});
+            case ArithmeticKind::SignedChar:       return parse_as(std::type_identity<signed char>{});
+            case ArithmeticKind::UnsignedChar:     return parse_as(std::type_identity<unsigned char>{});
+            case ArithmeticKind::Short:            return parse_as(std::type_identity<short>{});
+            case ArithmeticKind::UnsignedShort:    return parse_as(std::type_identity<unsigned short>{});
+            case ArithmeticKind::Int:              return parse_as(std::type_identity<int>{});
+            case ArithmeticKind::UnsignedInt:      return parse_as(std::type_identity<unsigned int>{});
+            case ArithmeticKind::Long:             return parse_as(std::type_identity<long>{});
+            case ArithmeticKind::UnsignedLong:     return parse_as(std::type_identity<unsigned long>{});
+            case ArithmeticKind::LongLong:         return parse_as(std::type_identity<long long>{});
+            case ArithmeticKind::UnsignedLongLong: return parse_as(std::type_identity<unsigned long long>{});
+            case ArithmeticKind::Float:            return parse_as(std::type_identity<float>{});
+            case ArithmeticKind::Double:           return parse_as(std::type_identity<double>{});
+            case ArithmeticKind::LongDouble:       return parse_as(std::type_identity<long double>{});
+            case ArithmeticKind::Bool:
+            case ArithmeticKind::None:             break;
+        }
+        return NumberStatus::Invalid;
+    }
+
+    unsigned read_hex4() {
+        if (end_ - cur_ < 4) [[unlikely]] {
+            fail("truncated \\u escape");
+        }
+        unsigned value = 0;
+        for (int i = 0; i < 4; ++i) {
+            const char c = *cur_++;
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= static_cast<unsigned>(c - '0');
+            else if (c >= 'a' && c <= 'f') value |= static_cast<unsigned>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') value |= static_cast<unsigned>(c - 'A' + 10);
+            else fail("invalid \\u escape");
+        }
+        return value;
+    }
+
+    void read_escape() {
+        if (cur_ == end_) [[unlikely]] {
+            fail("unterminated escape");
+        }
+        const char c = *cur_++;
+        switch (c) {
+            case '"':  scratch_ += '"'; return;
+            case '\\': scratch_ += '\\'; return;
+            case '/':  scratch_ += '/'; return;
+            case 'b':  scratch_ += '\b'; return;
+            case 'f':  scratch_ += '\f'; return;
+            case 'n':  scratch_ += '\n'; return;
+            case 'r':  scratch_ += '\r'; return;
+            case 't':  scratch_ += '\t'; return;
+            case 'u':  break;
+            default:   fail("invalid escape");
+        }
+        unsigned code = read_hex4();
+        if (code >= 0xD800 && code <= 0xDBFF) {
+            if (!consume_literal("\\u")) [[unlikely]] {
+                fail("unpaired surrogate");
+            }
+            const unsigned low = read_hex4();
+            if (low < 0xDC00 || low > 0xDFFF) [[unlikely]] {
+                fail("unpaired surrogate");
+            }
+            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+        }
+        // UTF-8 encode
+        if (code < 0x80) {
+            scratch_ += static_cast<char>(code);
+        } else if (code < 0x800) {
+            scratch_ += static_cast<char>(0xC0 | (code >> 6));
+            scratch_ += static_cast<char>(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            scratch_ += static_cast<char>(0xE0 | (code >> 12));
+            scratch_ += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            scratch_ += static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            scratch_ += static_cast<char>(0xF0 | (code >> 18));
+            scratch_ += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            scratch_ += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            scratch_ += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    const char* begin_;
+    const char* cur_;
+    const char* end_;
+    std::size_t depth_ = 0;
+    std::string scratch_;   ///< Unescaped text of the last escaped string
+};
+
+void read_class(JsonReader& r, void* obj, const JsonClassPlan& plan);
+void read_value(JsonReader& r, void* obj, const JsonValuePlan& plan);
+
+void read_key(JsonReader& r, void* key, const JsonValuePlan& plan) {
+    const std::string_view text = r.read_string();
+    if (plan.kind == JsonKind::String) {
+        static_cast<std::string*>(key)->assign(text);
+    } else {
+        r.read_number(text, plan.arithmetic, key);
+    }
+}
+
+struct ReadContext {
+    JsonReader* reader;
+    const JsonValuePlan* plan;
+    bool key_pending;       ///< Maps: next callback is the key
+};
+
+void read_element(void* ctx, void* obj, const TypeCodec&) {
+    auto& c = *static_cast<ReadContext*>(ctx);
+    if (c.plan->kind == JsonKind::Map && c.key_pending) {
+        c.key_pending = false;
+        read_key(*c.reader, obj, *c.plan->key);
+        c.reader->expect(':');
+    } else {
+        c.key_pending = true;
+        read_value(*c.reader, obj, *c.plan->value);
+    }
+}
+
+void read_container(JsonReader& r, void* obj, const JsonValuePlan& plan) {
+    const ContainerOps& ops = *plan.codec->container;
+    const bool is_map = plan.kind == JsonKind::Map;
+    JsonReader::Nested nested(r);
+    r.expect(is_map ? '{' : '[');
+    ops.clear(obj);
+    if (r.consume(is_map ? '}' : ']')) {
+        return;
+    }
+
+    const JsonValuePlan& element = *plan.value;
+    if (!is_map && ops.resize_data && element.kind == JsonKind::Number) {
+        // Contiguous numbers: parse straight into geometrically grown storage
+        std::size_t capacity = 16;
+        auto* data = ops.resize_data(obj, capacity);
+        const std::size_t count = visit_arithmetic(element.arithmetic, data, [&]<typename T>(const T&) {
+            auto* values = static_cast<T*>(data);
+            std::size_t n = 0;
+            do {
+                if (n == capacity) {
+                    capacity *= 2;
+                    values = static_cast<T*>(ops.resize_data(obj, capacity));
+                }
+                r.skip_ws();
+                if constexpr (std::is_integral_v<T> && sizeof(T) > 1) {
+                    if (!r.parse_integer_at<T>(values + n)) {
+                        r.read_number(element.arithmetic, values + n);
+                    }
+                } else {
+                    r.read_number(element.arithmetic, values + n);
+                }
+                ++n;
+            } while (r.consume(','));
+            return n;
+        });
+        ops.resize_data(obj, count);
+        r.expect(']');
+        return;
+    }
+
+    ReadContext ctx{&r, &plan, true};
+    do {
+        ops.append_element(obj, &read_element, &ctx);
+    } while (r.consume(','));
+    r.expect(is_map ? '}' : ']');
+}
+
+void read_value(JsonReader& r, void* obj, const JsonValuePlan& plan) {
+    if (r.consume_null()) {
+        return;
+    }
+    switch (plan.kind) {
+        case JsonKind::Bool:
+            if (r.consume_literal("true")) {
+                *static_cast<bool*>(obj) = true;
+            } else if (r.consume_literal("false")) {
+                *static_cast<bool*>(obj) = false;
+            } else {
+                r.fail("expected boolean");
+            }
+            break;
+        case JsonKind::Number:
+            r.read_number(plan.arithmetic, obj);
+            break;
+        case JsonKind::String:
+            static_cast<std::string*>(obj)->assign(r.read_string());
+            break;
+        case JsonKind::Object:
+            read_class(r, obj, *plan.class_plan);
+            break;
+        case JsonKind::Array:
+        case JsonKind::Map:
+            read_container(r, obj, plan);
+            break;
+    }
+}
+
+void read_class(JsonReader& r, void* obj, const JsonClassPlan& plan) {
+    if (!plan.valid) [[unlikely]] {
+        throw SerializationError(plan.error);
+    }
+    auto* base = static_cast<std::byte*>(obj);
+    JsonReader::Nested nested(r);
+    r.expect('{');
+    if (r.consume('}')) {
+        return;
+    }
+
+    const std::size_t field_count = plan.fields.size();
+    std::size_t expected = 0;
+    do {
+        const std::string_view key = r.read_string();
+        r.expect(':');
+
+        // In-order input hits the expected field; otherwise look the key up
+        const JsonField* field = nullptr;
+        if (expected < field_count && plan.fields[expected].name == key) [[likely]] {
+            field = &plan.fields[expected];
+        } else {
+            auto it = plan.by_hash.find(fnv1a_hash(key));
+            if (it != plan.by_hash.end() && plan.fields[it->second].name == key) {
+                field = &plan.fields[it->second];
+                expected = it->second;
+            }
+        }
+
+        if (field) {
+            read_value(r, base + field->offset, *field->value);
+            ++expected;
+        } else {
+            r.skip_value();
+        }
+    } while (r.consume(','));
+    r.expect('}');
+}
+
+} // namespace
+
+} // namespace detail
+
+std::string to_json(const void* obj, const detail::TypeInfo& type) {
+    std::string out;
+    to_json_append(obj, type, out);
+    return out;
+}
+
+void to_json_append(const void* obj, const detail::TypeInfo& type, std::string& out) {
+    const auto& plan = detail::cached_json_plan(type);
+    const std::size_t old_size = out.size();
+    detail::JsonWriter writer(out);
+    try {
+        detail::write_class(writer, obj, plan);
+    } catch (...) {
+        out.resize(old_size);
+        throw;
+    }
+    writer.finish();
+}
+
+std::size_t from_json(void* obj, const detail::TypeInfo& type, std::string_view in) {
+    const auto& plan = detail::cached_json_plan(type);
+    detail::JsonReader reader(in);
+    detail::read_class(reader, obj, plan);
+    reader.skip_ws();
+    return reader.consumed();
+}
+
+} // namespace rttm
@@ -0,0 +1,234 @@
+/**
+ * @file Layout.cpp
+ * @brief Layout analysis and report formatting for registered types
+ */
+
+#include "RTTM/detail/Layout.hpp"
+#include "RTTM/detail/TypeManager.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace rttm {
+
+namespace {
+
+std::size_t align_up(std::size_t value, std::size_t alignment) noexcept {
+    return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+}
+
+std::size_t lines_needed(std::size_t size, std::size_t line) noexcept {
+    return std::max<std::size_t>(1, (size + line - 1) / line);
+}
+
+// Lines touched by [offset, offset + size), counted from the line holding offset
+std::size_t lines_touched(std::size_t offset, std::size_t size, std::size_t line) noexcept {
+    return size ? (offset % line + size - 1) / line + 1 : 1;
+}
+
+// Size and alignment of the member type, from its ValueOps table
+std::size_t size_of(const detail::MemberInfo& member) noexcept {
+    return member.value_ops->size;
+}
+
+std::size_t align_of(const detail::MemberInfo& member) noexcept {
+    return member.value_ops->alignment;
+}
+
+bool is_synchronization(std::string_view type_name) noexcept {
+    return type_name.find("atomic") != std::string_view::npos ||
+           type_name.find("mutex") != std::string_view::npos;
+}
+
+// Byte ranges [first, second) of base class subobjects. A range ends at
+// the base's last member rather than at its size: an empty base shares
+// its address with the derived class's members, and those may be placed
+// in a base's tail padding.
+std::vector<std::pair<std::size_t, std::size_t>> base_ranges(const detail::TypeInfo& type) {
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    auto& mgr = detail::TypeManager::instance();
+    for (const auto& [index, offset] : type.base_offsets) {
+        const detail::TypeInfo* base = mgr.get_type(index);
+        if (!base || offset < 0) {
+            continue;
+        }
+        std::size_t extent = 0;
+        for (const auto& [name, member] : base->members) {
+            extent = std::max(extent, member.offset + size_of(member));
+        }
+        const auto first = static_cast<std::size_t>(offset);
+        ranges.emplace_back(first, first + std::min(extent, base->size));
+    }
+    return ranges;
+}
+
+bool in_base(const std::vector<std::pair<std::size_t, std::size_t>>& ranges, std::size_t offset) noexcept {
+    return std::any_of(ranges.begin(), ranges.end(), [&](const auto& range) {
+        return offset >= range.first && offset < range.second;
+    });
+}
+
+} // namespace
+
+bool TypeLayout::has_line_issues() const noexcept {
+    return std::any_of(members.begin(), members.end(), [](const MemberLayout& m) {
+        return m.straddles_line || m.false_sharing_risk;
+    });
+}
+
+TypeLayout analyze_layout(const detail::TypeInfo& type, std::size_t cache_line) {
+    TypeLayout layout;
+    layout.type = &type;
+    layout.cache_line = cache_line;
+    layout.lines = type.size ? lines_needed(type.size, cache_line) : 0;
+    layout.array_period = type.size ? cache_line / std::gcd(type.size, cache_line) : 1;
+    layout.shares_lines_in_arrays = type.size % cache_line != 0;
+
+    std::vector<const detail::MemberInfo*> sorted(type.member_layout().begin(), type.member_layout().end());
+    std::stable_sort(sorted.begin(), sorted.end(), [](const detail::MemberInfo* a, const detail::MemberInfo* b) {
+        return a->offset < b->offset;
+    });
+    const auto bases = base_ranges(type);
+
+    std::size_t end = 0;
+    std::size_t base_end = 0;
+    layout.members.reserve(sorted.size());
+    for (const detail::MemberInfo* member : sorted) {
+        const std::size_t size = size_of(*member);
+        const std::size_t padding = align_up(end, align_of(*member)) - end;
+        MemberLayout& m = layout.members.emplace_back();
+        m.member = member;
+        m.gap_before = member->offset > end ? member->offset - end : 0;
+        if (m.gap_before > padding) {
+            layout.unexplained_gap += m.gap_before - padding;
+        }
+        m.first_line = member->offset / cache_line;
+        m.last_line = size ? (member->offset + size - 1) / cache_line : m.first_line;
+        m.straddles_line = lines_touched(member->offset, size, cache_line) > lines_needed(size, cache_line);
+        m.inherited = in_base(bases, member->offset);
+        m.synchronization = is_synchronization(member->type_name);
+
+        for (std::size_t i = 0; i < layout.array_period; ++i) {
+            const std::size_t start = i * type.size + member->offset;
+            if (lines_touched(start, size, cache_line) > lines_needed(size, cache_line)) {
+                ++m.array_splits;
+            }
+        }
+
+        // Overlapping members (unions, aliases) are neither gaps nor extra bytes
+        if (member->offset >= end) {
+            layout.reflected_bytes += size;
+        } else if (member->offset + size > end) {
+            layout.reflected_bytes += member->offset + size - end;
+        }
+        layout.interior_gap += m.gap_before;
+        end = std::max(end, member->offset + size);
+        if (m.inherited) {
+            base_end = std::max(base_end, member->offset + size);
+        }
+    }
+    layout.tail_gap = type.size > end ? type.size - end : 0;
+    if (layout.tail_gap > align_up(end, type.alignment) - end) {
+        layout.unexplained_gap += layout.tail_gap - (align_up(end, type.alignment) - end);
+    }
+
+    for (MemberLayout& m : layout.members) {
+        if (!m.synchronization) {
+            continue;
+        }
+        m.false_sharing_risk = std::any_of(layout.members.begin(), layout.members.end(), [&](const MemberLayout& other) {
+            return &other != &m && other.first_line <= m.last_line && m.first_line <= other.last_line;
+        });
+    }
+
+    // Largest alignment first, then largest size; ties keep the current order
+    for (const MemberLayout& m : layout.members) {
+        if (!m.inherited) {
+            layout.suggested_order.push_back(m.member);
+        }
+    }
+    std::stable_sort(layout.suggested_order.begin(), layout.suggested_order.end(),
+                     [](const detail::MemberInfo* a, const detail::MemberInfo* b) {
+                         return align_of(*a) != align_of(*b) ? align_of(*a) > align_of(*b) : size_of(*a) > size_of(*b);
+                     });
+    std::size_t cursor = base_end;
+    for (const detail::MemberInfo* member : layout.suggested_order) {
+        cursor = align_up(cursor, align_of(*member)) + size_of(*member);
+    }
+    layout.suggested_size = align_up(cursor, type.alignment);
+
+    return layout;
+}
+
+void write_layout_report(std::ostream& os, const TypeLayout& layout) {
+    const detail::TypeInfo& type = *layout.type;
+    const std::size_t line = layout.cache_line;
+    const auto flags = os.flags();
+
+    os << type.name << ": size " << type.size << ", align " << type.alignment << ", "
+       << layout.lines << (layout.lines == 1 ? " cache line" : " cache lines") << " of " << line << " bytes\n";
+    os << "  reflected " << layout.reflected_bytes << " bytes, gaps " << layout.gap_bytes()
+       << " (interior " << layout.interior_gap << ", tail " << layout.tail_gap << ")\n";
+    if (layout.unexplained_gap) {
+        os << "  note: " << layout.unexplained_gap << " gap bytes exceed what alignment requires "
+              "(unreflected members or alignas); figures below cover reflected members only\n";
+    }
+
+    os << "  " << std::setw(6) << "offset" << std::setw(6) << "size" << std::setw(6) << "align"
+       << std::setw(6) << "line" << "  member\n";
+    for (const MemberLayout& m : layout.members) {
+        if (m.gap_before) {
+            os << "  " << std::setw(6) << m.member->offset - m.gap_before << std::setw(6) << m.gap_before
+               << std::setw(12) << "" << "  <gap>\n";
+        }
+        os << "  " << std::setw(6) << m.member->offset << std::setw(6) << size_of(*m.member)
+           << std::setw(6) << align_of(*m.member) << std::setw(6) << m.first_line << "  "
+           << m.member->name << " (" << m.member->type_name << ")";
+        if (m.inherited) os << " [inherited]";
+        if (m.straddles_line) os << " [straddles line " << m.first_line << "-" << m.last_line << "]";
+        if (m.false_sharing_risk) os << " [false sharing risk]";
+        os << '\n';
+    }
+    if (layout.tail_gap) {
+        os << "  " << std::setw(6) << type.size - layout.tail_gap << std::setw(6) << layout.tail_gap
+           << std::setw(12) << "" << "  <tail gap>\n";
+    }
+
+    // Arrays (ReflectedArray, InstanceArray, batch gathers) use stride == size
+    for (const MemberLayout& m : layout.members) {
+        if (m.array_splits) {
+            os << "  array: " << m.member->name << " split across lines in " << m.array_splits << " of every "
+               << layout.array_period << " elements\n";
+        }
+    }
+    if (layout.shares_lines_in_arrays && type.size) {
+        os << "  array: adjacent elements share cache lines; writes from different threads to neighbouring "
+              "elements false-share unless the type is aligned to " << line << "\n";
+    }
+    // Columns (ReflectedColumns) use stride == member size
+    for (const MemberLayout& m : layout.members) {
+        const std::size_t size = size_of(*m.member);
+        if (size && size < line && line % size != 0) {
+            os << "  columns: " << m.member->name << " (" << size << " bytes) elements cross line boundaries\n";
+        }
+    }
+
+    if (layout.suggested_savings()) {
+        os << "  suggested order (size " << layout.suggested_size << ", saves " << layout.suggested_savings()
+           << " bytes):";
+        for (const detail::MemberInfo* member : layout.suggested_order) {
+            os << ' ' << member->name;
+        }
+        os << '\n';
+    } else {
+        os << "  member order: no padding to recover from reflected members\n";
+    }
+    os.flags(flags);
+}
+
+} // namespace rttm
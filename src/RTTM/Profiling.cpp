@@ -0,0 +1,160 @@
+/**
+ * @file Profiling.cpp
+ * @brief Thread-local event tables behind the profiling snapshot API
+ */
+
+#include "RTTM/detail/Profiling.hpp"
+#include "RTTM/detail/Name.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+namespace rttm {
+
+namespace detail {
+
+namespace {
+
+struct ProfileKey {
+    std::size_t type_hash;
+    std::size_t member_hash;
+    ProfileEvent event;
+
+    bool operator==(const ProfileKey&) const noexcept = default;
+};
+
+struct ProfileKeyHash {
+    std::size_t operator()(const ProfileKey& key) const noexcept {
+        return key.type_hash ^ (key.member_hash * 0x9E3779B97F4A7C15ull) ^ static_cast<std::size_t>(key.event);
+    }
+};
+
+using ProfileTable = std::unordered_map<ProfileKey, ProfileRecord, ProfileKeyHash>;
+
+void merge_record(ProfileTable& into, const ProfileKey& key, const ProfileRecord& record) {
+    auto [it, inserted] = into.try_emplace(key, record);
+    if (!inserted) {
+        it->second.count += record.count;
+        it->second.total_ns += record.total_ns;
+        it->second.max_ns = std::max(it->second.max_ns, record.max_ns);
+    }
+}
+
+/**
+ * @brief Events of one thread
+ *
+ * The mutex is only contended while a snapshot or reset reads the table.
+ */
+struct ThreadProfile {
+    std::mutex mutex;
+    ProfileTable records;
+};
+
+/**
+ * @brief Tracks live thread tables and keeps the counters of exited threads
+ */
+class ProfileRegistry {
+public:
+    static ProfileRegistry& instance() {
+        static ProfileRegistry registry;
+        return registry;
+    }
+
+    void attach(ThreadProfile* profile) {
+        std::lock_guard lock(mutex_);
+        live_.push_back(profile);
+    }
+
+    void detach(ThreadProfile* profile) {
+        std::lock_guard lock(mutex_);
+        live_.erase(std::remove(live_.begin(), live_.end(), profile), live_.end());
+        std::lock_guard profile_lock(profile->mutex);
+        for (const auto& [key, record] : profile->records) {
+            merge_record(retired_, key, record);
+        }
+    }
+
+    ProfileTable collect() {
+        std::lock_guard lock(mutex_);
+        ProfileTable merged = retired_;
+        for (ThreadProfile* profile : live_) {
+            std::lock_guard profile_lock(profile->mutex);
+            for (const auto& [key, record] : profile->records) {
+                merge_record(merged, key, record);
+            }
+        }
+        return merged;
+    }
+
+    void reset() {
+        std::lock_guard lock(mutex_);
+        retired_.clear();
+        for (ThreadProfile* profile : live_) {
+            std::lock_guard profile_lock(profile->mutex);
+            profile->records.clear();
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<ThreadProfile*> live_;
+    ProfileTable retired_;
+};
+
+/**
+ * @brief Registers the calling thread's table for its lifetime
+ */
+struct ThreadProfileSlot {
+    ThreadProfileSlot() { ProfileRegistry::instance().attach(&profile); }
+    ~ThreadProfileSlot() { ProfileRegistry::instance().detach(&profile); }
+
+    ThreadProfile profile;
+};
+
+} // namespace
+
+void profile_record(ProfileEvent event, std::string_view type, std::string_view member,
+                    std::uint64_t elapsed_ns) noexcept {
+    try {
+        thread_local ThreadProfileSlot slot;
+        const ProfileKey key{fnv1a_hash(type), fnv1a_hash(member), event};
+        std::lock_guard lock(slot.profile.mutex);
+        auto [it, inserted] = slot.profile.records.try_emplace(key);
+        ProfileRecord& record = it->second;
+        if (inserted) {
+            record.event = event;
+            record.type = type;
+            record.member = member;
+        }
+        ++record.count;
+        record.total_ns += elapsed_ns;
+        record.max_ns = std::max(record.max_ns, elapsed_ns);
+    } catch (...) {
+        // Profiling must never change the behavior of the profiled call
+    }
+}
+
+} // namespace detail
+
+ProfileSnapshot profile_snapshot() {
+    ProfileSnapshot snapshot;
+    detail::ProfileTable merged = detail::ProfileRegistry::instance().collect();
+    snapshot.records.reserve(merged.size());
+    for (auto& [key, record] : merged) {
+        snapshot.totals[static_cast<std::size_t>(record.event)] += record.count;
+        snapshot.records.push_back(std::move(record));
+    }
+    std::sort(snapshot.records.begin(), snapshot.records.end(),
+              [](const ProfileRecord& a, const ProfileRecord& b) {
+                  return std::tie(a.event, a.type, a.member) < std::tie(b.event, b.type, b.member);
+              });
+    return snapshot;
+}
+
+void reset_profile() {
+    detail::ProfileRegistry::instance().reset();
+}
+
+} // namespace rttm
@@ -0,0 +1,66 @@
+/**
+ * @file ReflectedArray.cpp
+ * @brief Bulk construction and copying for ReflectedArray
+ */
+
+#include "RTTM/detail/ReflectedArray.hpp"
+#include "RTTM/detail/TypeManager.hpp"
+
+namespace rttm {
+
+ReflectedArray::ReflectedArray(const detail::TypeInfo* type_info, std::size_t count,
+                               std::pmr::memory_resource* resource)
+    : resource_(resource), type_info_(type_info) {
+    if (!type_info || !type_info->default_construct_raw) [[unlikely]] {
+        throw ReflectionError("Type is not default constructible in place: " +
+                              (type_info ? type_info->name : std::string("unknown")));
+    }
+    if (count == 0) {
+        return;
+    }
+    
+    const std::size_t bytes = type_info->size * count;
+    void* storage = resource_->allocate(bytes, type_info->alignment);
+    try {
+        type_info->construct_n(storage, count);
+    } catch (...) {
+        resource_->deallocate(storage, bytes, type_info->alignment);
+        throw;
+    }
+    data_ = storage;
+    count_ = count;
+}
+
+ReflectedArray::ReflectedArray(const detail::TypeInfo* type_info, const void* src, std::size_t count,
+                               std::pmr::memory_resource* resource)
+    : resource_(resource), type_info_(type_info) {
+    if (count == 0) {
+        return;
+    }
+    if (!type_info || (!type_info->copy_construct_raw && !type_info->copier)) [[unlikely]] {
+        throw ReflectionError("Type is not copy constructible: " +
+                              (type_info ? type_info->name : std::string("unknown")));
+    }
+    
+    const std::size_t bytes = type_info->size * count;
+    void* storage = resource_->allocate(bytes, type_info->alignment);
+    try {
+        type_info->copy_n(storage, src, count);
+    } catch (...) {
+        resource_->deallocate(storage, bytes, type_info->alignment);
+        throw;
+    }
+    data_ = storage;
+    count_ = count;
+}
+
+ReflectedArray ReflectedArray::create(std::string_view type_name, std::size_t count,
+                                      std::pmr::memory_resource* resource) {
+    const detail::TypeInfo* info = detail::TypeManager::instance().get_type(type_name);
+    if (!info) [[unlikely]] {
+        throw TypeNotRegisteredError(type_name);
+    }
+    return ReflectedArray(info, count, resource);
+}
+
+} // namespace rttm
@@ -0,0 +1,309 @@
+/**
+ * @file ReflectedColumns.cpp
+ * @brief Column allocation, growth and row conversion for ReflectedColumns
+ */
+
+#include "RTTM/detail/ReflectedColumns.hpp"
+#include "RTTM/detail/TypeManager.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace rttm {
+
+ReflectedColumns::ReflectedColumns(const detail::TypeInfo* type_info, std::pmr::memory_resource* resource)
+    : resource_(resource), type_info_(type_info) {
+    if (!type_info) [[unlikely]] {
+        throw ReflectionError("Cannot create columns for unknown type");
+    }
+
+    columns_.reserve(type_info->member_count());
+    for (std::size_t ordinal = 0; ordinal < type_info->member_count(); ++ordinal) {
+        const detail::MemberInfo* member = type_info->member_at(ordinal);
+        const detail::ValueOps* ops = member->value_ops;
+        if (!ops || !ops->copy_construct || !ops->assign) [[unlikely]] {
+            throw ReflectionError("Member cannot be stored in a column: " + type_info->name + "::" +
+                                  member->name + " (" + member->type_name + ")");
+        }
+        columns_.push_back({member, nullptr});
+    }
+}
+
+ReflectedColumns ReflectedColumns::create(std::string_view type_name, std::pmr::memory_resource* resource) {
+    const detail::TypeInfo* info = detail::TypeManager::instance().get_type(type_name);
+    if (!info) [[unlikely]] {
+        throw TypeNotRegisteredError(type_name);
+    }
+    return ReflectedColumns(info, resource);
+}
+
+ReflectedColumns::ReflectedColumns(const ReflectedColumns& other)
+    : resource_(other.resource_), type_info_(other.type_info_), columns_(other.columns_) {
+    for (auto& column : columns_) {
+        column.data = nullptr;
+    }
+    reserve(other.size_);
+
+    // Column by column; on failure the finished columns hold size_ rows
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const detail::ValueOps& ops = *columns_[c].member->value_ops;
+        if (ops.trivially_copyable) {
+            if (other.size_) std::memcpy(columns_[c].data, other.columns_[c].data, other.size_ * ops.size);
+            continue;
+        }
+        std::size_t i = 0;
+        try {
+            for (; i < other.size_; ++i) {
+                ops.copy_construct(cell(c, i), other.cell(c, i));
+            }
+        } catch (...) {
+            while (i > 0) ops.destroy(cell(c, --i));
+            for (std::size_t done = 0; done < c; ++done) {
+                const detail::ValueOps& done_ops = *columns_[done].member->value_ops;
+                for (std::size_t row = other.size_; row > 0; --row) done_ops.destroy(cell(done, row - 1));
+            }
+            release();
+            throw;
+        }
+    }
+    size_ = other.size_;
+}
+
+void ReflectedColumns::reserve(std::size_t capacity) {
+    if (capacity <= capacity_) {
+        return;
+    }
+
+    // Allocate every column first so a failed allocation changes nothing
+    std::vector<void*> fresh(columns_.size(), nullptr);
+    try {
+        for (std::size_t c = 0; c < columns_.size(); ++c) {
+            const detail::ValueOps& ops = *columns_[c].member->value_ops;
+            fresh[c] = resource_->allocate(capacity * ops.size, ops.alignment);
+        }
+    } catch (...) {
+        for (std::size_t c = 0; c < columns_.size() && fresh[c]; ++c) {
+            const detail::ValueOps& ops = *columns_[c].member->value_ops;
+            resource_->deallocate(fresh[c], capacity * ops.size, ops.alignment);
+        }
+        throw;
+    }
+
+    bool move = true;
+    for (const auto& column : columns_) {
+        move = move && column.member->value_ops->nothrow_move && column.member->value_ops->move_construct;
+    }
+
+    // Relocate; copies (used when some member may throw on move) keep the old rows intact
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const detail::ValueOps& ops = *columns_[c].member->value_ops;
+        char* dst = static_cast<char*>(fresh[c]);
+        if (ops.trivially_copyable) {
+            if (size_) std::memcpy(dst, columns_[c].data, size_ * ops.size);
+            continue;
+        }
+        std::size_t i = 0;
+        try {
+            for (; i < size_; ++i) {
+                if (move) {
+                    ops.move_construct(dst + i * ops.size, cell(c, i));
+                } else {
+                    ops.copy_construct(dst + i * ops.size, cell(c, i));
+                }
+            }
+        } catch (...) {
+            while (i > 0) ops.destroy(dst + --i * ops.size);
+            for (std::size_t done = 0; done < columns_.size(); ++done) {
+                const detail::ValueOps& done_ops = *columns_[done].member->value_ops;
+                if (done < c && !done_ops.trivially_copyable) {
+                    for (std::size_t row = size_; row > 0; --row) {
+                        done_ops.destroy(static_cast<char*>(fresh[done]) + (row - 1) * done_ops.size);
+                    }
+                }
+                resource_->deallocate(fresh[done], capacity * done_ops.size, done_ops.alignment);
+            }
+            throw;
+        }
+    }
+
+    const std::size_t rows = size_;
+    destroy_rows(0, rows);
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const detail::ValueOps& ops = *columns_[c].member->value_ops;
+        if (columns_[c].data) {
+            resource_->deallocate(columns_[c].data, capacity_ * ops.size, ops.alignment);
+        }
+        columns_[c].data = fresh[c];
+    }
+    size_ = rows;
+    capacity_ = capacity;
+}
+
+void ReflectedColumns::resize(std::size_t count) {
+    if (count <= size_) {
+        destroy_rows(count, size_);
+        size_ = count;
+        return;
+    }
+
+    for (const auto& column : columns_) {
+        if (!column.member->value_ops->construct) [[unlikely]] {
+            throw ReflectionError("Member is not default constructible: " + type_info_->name + "::" +
+                                  column.member->name);
+        }
+    }
+    reserve(std::max(count, capacity_ * 2));
+
+    // Row by row, so size_ always counts complete rows
+    for (; size_ < count; ++size_) {
+        std::size_t c = 0;
+        try {
+            for (; c < columns_.size(); ++c) {
+                columns_[c].member->value_ops->construct(cell(c, size_));
+            }
+        } catch (...) {
+            while (c > 0) {
+                --c;
+                columns_[c].member->value_ops->destroy(cell(c, size_));
+            }
+            throw;
+        }
+    }
+}
+
+void ReflectedColumns::push_back(const void* obj) {
+    if (size_ == capacity_) {
+        reserve(capacity_ ? capacity_ * 2 : 8);
+    }
+
+    const char* base = static_cast<const char*>(obj);
+    std::size_t c = 0;
+    try {
+        for (; c < columns_.size(); ++c) {
+            columns_[c].member->value_ops->copy_construct(cell(c, size_), base + columns_[c].member->offset);
+        }
+    } catch (...) {
+        while (c > 0) {
+            --c;
+            columns_[c].member->value_ops->destroy(cell(c, size_));
+        }
+        throw;
+    }
+    ++size_;
+}
+
+void ReflectedColumns::clear() noexcept {
+    destroy_rows(0, size_);
+    size_ = 0;
+}
+
+void ReflectedColumns::load(std::size_t i, void* obj) const {
+    char* base = static_cast<char*>(obj);
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        columns_[c].member->value_ops->assign(base + columns_[c].member->offset, cell(c, i));
+    }
+}
+
+void ReflectedColumns::store(std::size_t i, const void* obj) {
+    const char* base = static_cast<const char*>(obj);
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        columns_[c].member->value_ops->assign(cell(c, i), base + columns_[c].member->offset);
+    }
+}
+
+ReflectedColumns::Row ReflectedColumns::at(std::size_t i) {
+    if (i >= size_) [[unlikely]] {
+        throw std::out_of_range("ReflectedColumns row out of range");
+    }
+    return row(i);
+}
+
+std::size_t ReflectedColumns::ordinal_of(Name member) const {
+    const detail::MemberInfo* info = type_info_ ? type_info_->find_member(member) : nullptr;
+    if (!info) [[unlikely]] {
+        throw PropertyNotFoundError(type_info_ ? std::string_view(type_info_->name) : "unknown", member,
+                                    type_info_ ? type_info_->member_names() : std::vector<std::string_view>{});
+    }
+    return info->ordinal;
+}
+
+const ReflectedColumns::Column& ReflectedColumns::column_at(std::size_t ordinal) const {
+    if (ordinal >= columns_.size()) [[unlikely]] {
+        throw PropertyNotFoundError(type_info_ ? std::string_view(type_info_->name) : "unknown",
+                                    "#" + std::to_string(ordinal),
+                                    type_info_ ? type_info_->member_names() : std::vector<std::string_view>{});
+    }
+    return columns_[ordinal];
+}
+
+const ReflectedColumns::Column& ReflectedColumns::checked_column(std::size_t ordinal, const std::type_info& type,
+                                                                 std::string_view type_name) const {
+    const Column& column = column_at(ordinal);
+    if (column.member->type_index != std::type_index(type)) [[unlikely]] {
+        throw PropertyTypeMismatchError(column.member->name, column.member->type_name, type_name);
+    }
+    return column;
+}
+
+void ReflectedColumns::destroy_rows(std::size_t first, std::size_t last) noexcept {
+    for (std::size_t c = 0; c < columns_.size(); ++c) {
+        const detail::ValueOps& ops = *columns_[c].member->value_ops;
+        if (ops.trivially_copyable) {
+            continue;
+        }
+        for (std::size_t i = last; i > first; --i) {
+            ops.destroy(cell(c, i - 1));
+        }
+    }
+}
+
+void ReflectedColumns::release() noexcept {
+    destroy_rows(0, size_);
+    for (auto& column : columns_) {
+        if (column.data) {
+            const detail::ValueOps& ops = *column.member->value_ops;
+            resource_->deallocate(column.data, capacity_ * ops.size, ops.alignment);
+            column.data = nullptr;
+        }
+    }
+    size_ = 0;
+    capacity_ = 0;
+}
+
+// ============================================================================
+// Row
+// ============================================================================
+
+// Same thunks and errors as Instance::get_property / set_property
+Variant ReflectedColumns::Row::get_property(std::size_t ordinal) const {
+    const detail::MemberInfo& member = *columns_->column_at(ordinal).member;
+    if (!member.getter) [[unlikely]] {
+        throw ReflectionError("Property is not copyable: " + member.name + " (" + member.type_name + ")");
+    }
+    Variant out;
+    member.getter(field(ordinal), &out);
+    return out;
+}
+
+void ReflectedColumns::Row::set_property(std::size_t ordinal, const Variant& value) const {
+    const detail::MemberInfo& member = *columns_->column_at(ordinal).member;
+    if (!member.setter) [[unlikely]] {
+        throw ReflectionError("Property is not assignable: " + member.name + " (" + member.type_name + ")");
+    }
+    if (!member.setter(field(ordinal), &value)) [[unlikely]] {
+        throw ReflectionError("Cannot assign value to property '" + member.name + "' of type " + member.type_name);
+    }
+}
+
+Instance ReflectedColumns::Row::to_instance() const {
+    const detail::TypeInfo* info = columns_->type_info_;
+    std::shared_ptr<void> obj = info->default_factory_raw ? info->default_factory_raw() : nullptr;
+    if (!obj) [[unlikely]] {
+        throw ReflectionError("Failed to create instance of type: " + info->name);
+    }
+    columns_->load(index_, obj.get());
+    return Instance::from_owned(std::move(obj), info);
+}
+
+} // namespace rttm
@@ -0,0 +1,460 @@
+/**
+ * @file Serializer.cpp
+ * @brief Plan compilation and execution for the binary serializer
+ */
+
+#include "RTTM/detail/Serializer.hpp"
+#include "RTTM/detail/PlanCache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+
+namespace rttm {
+
+namespace detail {
+
+namespace {
+
+// ============================================================================
+// Plan building
+// ============================================================================
+
+class PlanBuilder;
+using BinaryPlanCache = PlanCache<SerializationPlan, PlanBuilder>;
+
+/**
+ * @brief Compiles binary plans; value plans are shared by codec
+ */
+class PlanBuilder {
+public:
+    void build(SerializationPlan& plan) {
+        const TypeInfo& type = *plan.type;
+
+        std::vector<const MemberInfo*> members;
+        members.reserve(type.members.size());
+        for (const auto& [name, member] : type.members) {
+            members.push_back(&member);
+        }
+        std::sort(members.begin(), members.end(), [](const MemberInfo* a, const MemberInfo* b) {
+            return a->offset < b->offset;
+        });
+
+        for (const MemberInfo* member : members) {
+            const TypeCodec* codec = member->codec;
+            if (!codec || codec->kind == CodecKind::Unsupported) {
+                throw SerializationError("Member '" + member->name + "' of " + type.name +
+                                         " has no binary encoding (" + member->type_name + ")");
+            }
+
+            const auto offset = static_cast<std::uint32_t>(member->offset);
+            if (codec->kind == CodecKind::Trivial) {
+                // Merge with the previous raw copy when exactly adjacent
+                if (!plan.steps.empty() && !plan.steps.back().value &&
+                    plan.steps.back().offset + plan.steps.back().size == offset) {
+                    plan.steps.back().size += codec->size;
+                } else {
+                    plan.steps.push_back(PlanStep{offset, codec->size, nullptr});
+                }
+                plan.min_size += codec->size;
+            } else {
+                const ValuePlan* value = value_plan_locked(codec, type.name + "::" + member->name);
+                plan.steps.push_back(PlanStep{offset, codec->size, value});
+                plan.min_size += value->min_size;
+            }
+        }
+    }
+
+private:
+    const ValuePlan* value_plan_locked(const TypeCodec* codec, const std::string& where) {
+        auto it = values_.find(codec);
+        if (it != values_.end()) {
+            return it->second.get();
+        }
+
+        // Built completely before publishing so a failed element type
+        // never leaves a half-initialized plan in the cache
+        auto plan = std::make_unique<ValuePlan>();
+        plan->codec = codec;
+        switch (codec->kind) {
+            case CodecKind::Trivial:
+                plan->min_size = codec->size;
+                break;
+            case CodecKind::String:
+                plan->min_size = 1;
+                break;
+            case CodecKind::Class: {
+                const TypeInfo* info = TypeManager::instance().get_type_by_id(codec->type_id);
+                if (!info) {
+                    throw SerializationError("Unregistered class type in " + where);
+                }
+                const SerializationPlan& nested = BinaryPlanCache::instance().class_plan_locked(*info);
+                if (!nested.valid && !nested.error.empty()) {
+                    throw SerializationError(nested.error);
+                }
+                plan->class_plan = &nested;
+                plan->min_size = nested.min_size;
+                break;
+            }
+            case CodecKind::Container: {
+                const ContainerOps& ops = *codec->container;
+                if (!ops.append_element) {
+                    throw SerializationError("Container elements are not default constructible in " + where);
+                }
+                if (ops.key_codec) {
+                    plan->key = element_plan_locked(ops.key_codec, where);
+                }
+                if (!ops.associative || ops.mapped) {
+                    plan->value = element_plan_locked(ops.value_codec, where);
+                }
+                plan->min_size = 1;
+                break;
+            }
+            case CodecKind::Unsupported:
+                throw SerializationError("Type has no binary encoding in " + where);
+        }
+        return values_.emplace(codec, std::move(plan)).first->second.get();
+    }
+
+    const ValuePlan* element_plan_locked(const TypeCodec* codec, const std::string& where) {
+        if (codec->kind == CodecKind::Unsupported) {
+            throw SerializationError("Container element type has no binary encoding in " + where);
+        }
+        return value_plan_locked(codec, where);
+    }
+
+    std::unordered_map<const TypeCodec*, std::unique_ptr<ValuePlan>> values_;
+};
+
+// ============================================================================
+// Writers / reader
+// ============================================================================
+
+class SpanWriter {
+public:
+    SpanWriter(std::byte* begin, std::byte* end) noexcept : begin_(begin), cur_(begin), end_(end) {}
+
+    void write(const void* src, std::size_t n) {
+        if (n > static_cast<std::size_t>(end_ - cur_)) [[unlikely]] {
+            throw SerializationError("Serialization buffer too small");
+        }
+        std::memcpy(cur_, src, n);
+        cur_ += n;
+    }
+
+    [[nodiscard]] std::size_t written() const noexcept { return static_cast<std::size_t>(cur_ - begin_); }
+
+private:
+    std::byte* begin_;
+    std::byte* cur_;
+    std::byte* end_;
+};
+
+class CountingWriter {
+public:
+    void write(const void*, std::size_t n) noexcept { count_ += n; }
+    [[nodiscard]] std::size_t written() const noexcept { return count_; }
+
+private:
+    std::size_t count_ = 0;
+};
+
+class SpanReader {
+public:
+    explicit SpanReader(std::span<const std::byte> in) noexcept
+        : begin_(in.data()), cur_(in.data()), end_(in.data() + in.size()) {}
+
+    void read(void* dst, std::size_t n) {
+        const std::byte* src = take(n);
+        std::memcpy(dst, src, n);
+    }
+
+    const std::byte* take(std::size_t n) {
+        if (n > remaining()) [[unlikely]] {
+            throw SerializationError("Serialized data is truncated");
+        }
+        const std::byte* src = cur_;
+        cur_ += n;
+        return src;
+    }
+
+    std::uint64_t varint() {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const auto byte = static_cast<std::uint8_t>(*take(1));
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        throw SerializationError("Malformed length prefix in serialized data");
+    }
+
+    [[nodiscard]] std::size_t remaining() const noexcept { return static_cast<std::size_t>(end_ - cur_); }
+    [[nodiscard]] std::size_t consumed() const noexcept { return static_cast<std::size_t>(cur_ - begin_); }
+
+private:
+    const std::byte* begin_;
+    const std::byte* cur_;
+    const std::byte* end_;
+};
+
+// ============================================================================
+// Encoding
+// ============================================================================
+
+template<typename Writer>
+void write_varint(Writer& w, std::uint64_t value) {
+    std::uint8_t buf[10];
+    std::size_t n = 0;
+    while (value >= 0x80) {
+        buf[n++] = static_cast<std::uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    buf[n++] = static_cast<std::uint8_t>(value);
+    w.write(buf, n);
+}
+
+template<typename Writer>
+void encode_class(Writer& w, const void* obj, const SerializationPlan& plan);
+
+template<typename Writer>
+void encode_value(Writer& w, const void* obj, const ValuePlan& plan);
+
+template<typename Writer>
+struct EncodeContext {
+    Writer* writer;
+    const ValuePlan* plan;
+};
+
+template<typename Writer>
+bool encode_element(void* ctx, void* key, void* value) {
+    auto& c = *static_cast<EncodeContext<Writer>*>(ctx);
+    if (c.plan->key) {
+        encode_value(*c.writer, key, *c.plan->key);
+    }
+    if (c.plan->value) {
+        encode_value(*c.writer, value, *c.plan->value);
+    }
+    return true;
+}
+
+template<typename Writer>
+void encode_container(Writer& w, const void* obj, const ValuePlan& plan) {
+    const ContainerOps& ops = *plan.codec->container;
+    void* container = const_cast<void*>(obj);
+    const std::size_t count = ops.size(container);
+    write_varint(w, count);
+    if (count == 0) {
+        return;
+    }
+    if (ops.contiguous && plan.value->codec->kind == CodecKind::Trivial) {
+        w.write(ops.data(container), count * ops.value_size);
+        return;
+    }
+    EncodeContext<Writer> ctx{&w, &plan};
+    ops.visit(container, 0, count, &encode_element<Writer>, &ctx);
+}
+
+template<typename Writer>
+void encode_value(Writer& w, const void* obj, const ValuePlan& plan) {
+    switch (plan.codec->kind) {
+        case CodecKind::Trivial:
+            w.write(obj, plan.codec->size);
+            break;
+        case CodecKind::String: {
+            const auto& str = *static_cast<const std::string*>(obj);
+            write_varint(w, str.size());
+            w.write(str.data(), str.size());
+            break;
+        }
+        case CodecKind::Class:
+            encode_class(w, obj, *plan.class_plan);
+            break;
+        case CodecKind::Container:
+            encode_container(w, obj, plan);
+            break;
+        case CodecKind::Unsupported:
+            break;
+    }
+}
+
+template<typename Writer>
+void encode_class(Writer& w, const void* obj, const SerializationPlan& plan) {
+    if (!plan.valid) [[unlikely]] {
+        throw SerializationError(plan.error);
+    }
+    const auto* base = static_cast<const std::byte*>(obj);
+    for (const PlanStep& step : plan.steps) {
+        if (!step.value) {
+            w.write(base + step.offset, step.size);
+        } else {
+            encode_value(w, base + step.offset, *step.value);
+        }
+    }
+}
+
+// ============================================================================
+// Decoding
+// ============================================================================
+
+void decode_class(SpanReader& r, void* obj, const SerializationPlan& plan);
+void decode_value(SpanReader& r, void* obj, const ValuePlan& plan);
+
+struct DecodeContext {
+    SpanReader* reader;
+    const ValuePlan* plan;
+    bool key_pending;       ///< Maps: next callback is the key
+};
+
+void decode_element(void* ctx, void* obj, const TypeCodec&) {
+    auto& c = *static_cast<DecodeContext*>(ctx);
+    if (c.plan->key && c.key_pending) {
+        // Sets only ever receive the key; maps alternate key / mapped value
+        c.key_pending = !c.plan->value;
+        decode_value(*c.reader, obj, *c.plan->key);
+    } else {
+        c.key_pending = true;
+        decode_value(*c.reader, obj, *c.plan->value);
+    }
+}
+
+void decode_container(SpanReader& r, void* obj, const ValuePlan& plan) {
+    const ContainerOps& ops = *plan.codec->container;
+    const std::uint64_t count = r.varint();
+
+    // Every element takes at least min_element bytes; reject counts the
+    // remaining input can't possibly hold before allocating anything
+    const std::size_t min_element = (plan.key ? plan.key->min_size : 0) + (plan.value ? plan.value->min_size : 0);
+    if (min_element > 0 && count > r.remaining() / min_element) [[unlikely]] {
+        throw SerializationError("Serialized container size exceeds remaining data");
+    }
+
+    ops.clear(obj);
+    if (count == 0) {
+        return;
+    }
+    const auto n = static_cast<std::size_t>(count);
+    if (ops.resize_data && plan.value->codec->kind == CodecKind::Trivial) {
+        void* data = ops.resize_data(obj, n);
+        r.read(data, n * ops.value_size);
+        return;
+    }
+    ops.reserve(obj, n);
+    DecodeContext ctx{&r, &plan, true};
+    for (std::size_t i = 0; i < n; ++i) {
+        ops.append_element(obj, &decode_element, &ctx);
+    }
+}
+
+void decode_value(SpanReader& r, void* obj, const ValuePlan& plan) {
+    switch (plan.codec->kind) {
+        case CodecKind::Trivial:
+            r.read(obj, plan.codec->size);
+            break;
+        case CodecKind::String: {
+            const std::uint64_t length = r.varint();
+            if (length > r.remaining()) [[unlikely]] {
+                throw SerializationError("Serialized data is truncated");
+            }
+            const auto n = static_cast<std::size_t>(length);
+            static_cast<std::string*>(obj)->assign(reinterpret_cast<const char*>(r.take(n)), n);
+            break;
+        }
+        case CodecKind::Class:
+            decode_class(r, obj, *plan.class_plan);
+            break;
+        case CodecKind::Container:
+            decode_container(r, obj, plan);
+            break;
+        case CodecKind::Unsupported:
+            break;
+    }
+}
+
+void decode_class(SpanReader& r, void* obj, const SerializationPlan& plan) {
+    if (!plan.valid) [[unlikely]] {
+        throw SerializationError(plan.error);
+    }
+    auto* base = static_cast<std::byte*>(obj);
+    for (const PlanStep& step : plan.steps) {
+        if (!step.value) {
+            r.read(base + step.offset, step.size);
+        } else {
+            decode_value(r, base + step.offset, *step.value);
+        }
+    }
+}
+
+const SerializationPlan& cached_plan(const TypeInfo& type) {
+    return BinaryPlanCache::instance().cached(type);
+}
+
+} // namespace
+
+const SerializationPlan& serialization_plan(const TypeInfo& type) {
+    return cached_plan(type);
+}
+
+void serialize_value(const void* obj, const ValuePlan& plan, std::vector<std::byte>& out) {
+    CountingWriter counter;
+    encode_value(counter, obj, plan);
+
+    const std::size_t old_size = out.size();
+    out.resize(old_size + counter.written());
+    SpanWriter writer(out.data() + old_size, out.data() + out.size());
+    try {
+        encode_value(writer, obj, plan);
+    } catch (...) {
+        out.resize(old_size);
+        throw;
+    }
+}
+
+std::size_t deserialize_value(void* obj, const ValuePlan& plan, std::span<const std::byte> in) {
+    SpanReader reader(in);
+    decode_value(reader, obj, plan);
+    return reader.consumed();
+}
+
+} // namespace detail
+
+std::size_t serialize(const void* obj, const detail::TypeInfo& type, std::span<std::byte> out) {
+    const auto& plan = detail::cached_plan(type);
+    detail::SpanWriter writer(out.data(), out.data() + out.size());
+    detail::encode_class(writer, obj, plan);
+    return writer.written();
+}
+
+std::size_t serialized_size(const void* obj, const detail::TypeInfo& type) {
+    const auto& plan = detail::cached_plan(type);
+    detail::CountingWriter writer;
+    detail::encode_class(writer, obj, plan);
+    return writer.written();
+}
+
+void serialize_append(const void* obj, const detail::TypeInfo& type, std::vector<std::byte>& out) {
+    const auto& plan = detail::cached_plan(type);
+    detail::CountingWriter counter;
+    detail::encode_class(counter, obj, plan);
+
+    const std::size_t old_size = out.size();
+    out.resize(old_size + counter.written());
+    detail::SpanWriter writer(out.data() + old_size, out.data() + out.size());
+    try {
+        detail::encode_class(writer, obj, plan);
+    } catch (...) {
+        out.resize(old_size);
+        throw;
+    }
+}
+
+std::size_t deserialize(void* obj, const detail::TypeInfo& type, std::span<const std::byte> in) {
+    const auto& plan = detail::cached_plan(type);
+    detail::SpanReader reader(in);
+    detail::decode_class(reader, obj, plan);
+    return reader.consumed();
+}
+
+} // namespace rttm
@@ -0,0 +1,210 @@
+/**
+ * @file TypeManager.cpp
+ * @brief TypeManager singleton, module registration and reader epochs
+ *
+ * Kept out of line so that every module sharing the RTTM library (host and
+ * plugins) resolves the same registry and the same thread-local staging
+ * pointer.
+ */
+
+#include "RTTM/detail/TypeManager.hpp"
+
+#include <thread>
+
+namespace rttm::detail {
+
+TypeManager& TypeManager::instance() {
+    static TypeManager mgr;
+    return mgr;
+}
+
+TypeManager::ModuleStaging*& TypeManager::current_staging() noexcept {
+    thread_local ModuleStaging* staging = nullptr;
+    return staging;
+}
+
+ModuleId TypeManager::load_module(ModuleRegistrationFn register_fn) {
+    ModuleStaging staging;
+    {
+        ModuleStaging*& current = current_staging();
+        ModuleStaging* const outer = std::exchange(current, &staging);
+        try {
+            register_fn();
+        } catch (...) {
+            current = outer;
+            throw;
+        }
+        current = outer;
+    }
+
+    // Publish the batch: one lock, one invalidation, one snapshot
+    std::unique_lock lock(mutex_);
+
+    LoadedModule module;
+    module.types.reserve(staging.order.size());
+    bool materialized = false;
+    for (const auto& [name, type_id] : staging.order) {
+        // A pending static record of the same name describes the type first
+        materialized |= materialize_named_locked(name);
+        if (types_by_name_.find(name) != types_by_name_.end()) {
+            continue;   // Registered elsewhere meanwhile: first owner wins
+        }
+        // Node handles keep the TypeInfo (and pointers into it) in place
+        auto result = types_by_name_.insert(staging.types.extract(staging.types.find(name)));
+        TypeInfo* stored = &result.position->second;
+        index_type_locked(result.position->first, stored, type_id);
+        module.types.emplace_back(stored, type_id);
+    }
+
+    if (!module.types.empty()) {
+        cache_generation_.fetch_add(1, std::memory_order_release);
+    }
+    if ((!module.types.empty() || materialized) && frozen_) {
+        publish_snapshot_locked();
+    }
+
+    const ModuleId id = next_module_id_++;
+    modules_.emplace(id, std::move(module));
+    return id;
+}
+
+void TypeManager::unload_module(ModuleId id) {
+    std::vector<TypeMap::node_type> retired;
+    std::vector<std::pair<std::uint64_t, std::unique_ptr<TypeSnapshot>>> snapshots;
+    std::uint64_t epoch = 0;
+    {
+        std::unique_lock lock(mutex_);
+        auto module = modules_.find(id);
+        if (module == modules_.end()) {
+            return;
+        }
+
+        retired.reserve(module->second.types.size());
+        for (const auto& [info, type_id] : module->second.types) {
+            auto it = types_by_name_.find(info->name);
+            if (it == types_by_name_.end() || &it->second != info) {
+                continue;
+            }
+            if (auto by_hash = types_by_hash_.find(fnv1a_hash(it->first));
+                by_hash != types_by_hash_.end() && by_hash->second == info) {
+                types_by_hash_.erase(by_hash);
+            }
+            if (auto by_index = types_by_index_.find(info->type_index);
+                by_index != types_by_index_.end() && by_index->second == info) {
+                types_by_index_.erase(by_index);
+            }
+            if (auto by_id = types_by_id_.find(type_id);
+                type_id && by_id != types_by_id_.end() && by_id->second == info) {
+                types_by_id_.erase(by_id);
+            }
+            retired.push_back(types_by_name_.extract(it));
+        }
+        modules_.erase(module);
+
+        // Readers pinning from here on can no longer reach the retired types
+        cache_generation_.fetch_add(1, std::memory_order_release);
+        if (frozen_) {
+            publish_snapshot_locked();
+        }
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+        epoch = reader_epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+        // Every snapshot retired so far was retired at or before epoch
+        snapshots = std::move(retired_snapshots_);
+        retired_snapshots_.clear();
+    }
+
+    wait_for_readers(epoch);
+    // retired and snapshots are destroyed here, while the module's code is still loaded
+}
+
+void TypeManager::pin_reader() const {
+    EpochReaderSlot& slot = *reader_slot(true);
+    if (slot.depth++ != 0) {
+        return;
+    }
+    // Re-check after publishing: an unload that missed the pin must not
+    // have advanced the epoch in between
+    std::uint64_t epoch = reader_epoch_.load(std::memory_order_relaxed);
+    for (;;) {
+        slot.pinned.store(epoch, std::memory_order_seq_cst);
+        const std::uint64_t current = reader_epoch_.load(std::memory_order_seq_cst);
+        if (current == epoch) [[likely]] {
+            return;
+        }
+        epoch = current;
+    }
+}
+
+void TypeManager::unpin_reader() const noexcept {
+    EpochReaderSlot* slot = reader_slot(false);
+    if (slot && slot->depth > 0 && --slot->depth == 0) {
+        slot->pinned.store(0, std::memory_order_release);
+    }
+}
+
+EpochReaderSlot* TypeManager::reader_slot(bool create) const {
+    struct Owner {
+        EpochReaderSlot* slot = nullptr;
+        ~Owner() {
+            if (slot) {
+                slot->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+    thread_local Owner owner;
+
+    if (!owner.slot && create) {
+        // Reuse the slot of an exited thread, else publish a new one
+        for (EpochReaderSlot* slot = reader_slots_.load(std::memory_order_acquire); slot; slot = slot->next) {
+            bool expected = false;
+            if (!slot->in_use.load(std::memory_order_relaxed) &&
+                slot->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                slot->depth = 0;
+                owner.slot = slot;
+                return slot;
+            }
+        }
+        auto* slot = new EpochReaderSlot;
+        slot->in_use.store(true, std::memory_order_relaxed);
+        slot->next = reader_slots_.load(std::memory_order_relaxed);
+        while (!reader_slots_.compare_exchange_weak(slot->next, slot, std::memory_order_release,
+                                                    std::memory_order_relaxed)) {
+        }
+        owner.slot = slot;
+    }
+    return owner.slot;
+}
+
+void TypeManager::wait_for_readers(std::uint64_t epoch) const {
+    const EpochReaderSlot* self = reader_slot(false);
+    for (EpochReaderSlot* slot = reader_slots_.load(std::memory_order_acquire); slot; slot = slot->next) {
+        if (slot == self) {
+            continue;
+        }
+        for (;;) {
+            const std::uint64_t pinned = slot->pinned.load(std::memory_order_seq_cst);
+            if (pinned == 0 || pinned >= epoch) {
+                break;
+            }
+            std::this_thread::yield();
+        }
+    }
+}
+
+void TypeManager::reclaim_snapshots_locked() {
+    if (retired_snapshots_.empty()) {
+        return;
+    }
+    // Lookups never hold a snapshot across a registration, so skip our own slot
+    const EpochReaderSlot* self = reader_slot(false);
+    std::uint64_t oldest = UINT64_MAX;
+    for (EpochReaderSlot* slot = reader_slots_.load(std::memory_order_acquire); slot; slot = slot->next) {
+        const std::uint64_t pinned = slot->pinned.load(std::memory_order_seq_cst);
+        if (slot != self && pinned != 0) {
+            oldest = std::min(oldest, pinned);
+        }
+    }
+    std::erase_if(retired_snapshots_, [oldest](const auto& retired) { return retired.first <= oldest; });
+}
+
+} // namespace rttm::detail
@@ -0,0 +1,134 @@
+/**
+ * @file rttm_layout.cpp
+ * @brief Dump the field layout of every registered type
+ *
+ * Usage: rttm_layout [--cache-line N] [--summary] [TYPE...]
+ *
+ * Prints each type's members by offset with gaps, cache-line straddles,
+ * false-sharing risks and a padding-minimizing member order. --summary
+ * prints one line per type, largest gap first. Types are whatever the
+ * binary registers: configure with -DRTTM_LAYOUT_SOURCES="a.cpp;b.cpp" to
+ * compile a project's registration files into the tool; without them a
+ * few sample types are registered.
+ */
+
+#include "RTTM/RTTM.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef RTTM_LAYOUT_SAMPLES
+namespace samples {
+
+// Declaration order leaves padding after every bool
+struct Particle {
+    bool alive = true;
+    double x = 0.0;
+    bool visible = true;
+    double y = 0.0;
+    std::uint16_t flags = 0;
+    float mass = 1.0f;
+};
+
+// A counter written by many threads next to read-mostly data
+struct WorkQueueStats {
+    std::uint64_t capacity = 0;
+    std::atomic<std::uint64_t> pushed{0};
+    std::atomic<std::uint64_t> popped{0};
+    char label[40] = {};
+};
+
+} // namespace samples
+
+RTTM_REGISTRATION {
+    rttm::Registry<samples::Particle>()
+        .property("alive", &samples::Particle::alive)
+        .property("x", &samples::Particle::x)
+        .property("visible", &samples::Particle::visible)
+        .property("y", &samples::Particle::y)
+        .property("flags", &samples::Particle::flags)
+        .property("mass", &samples::Particle::mass);
+
+    rttm::Registry<samples::WorkQueueStats>()
+        .property("capacity", &samples::WorkQueueStats::capacity)
+        .property("pushed", &samples::WorkQueueStats::pushed)
+        .property("popped", &samples::WorkQueueStats::popped)
+        .property("label", &samples::WorkQueueStats::label);
+}
+#endif
+
+namespace {
+
+int usage(const char* argv0) {
+    std::cerr << "usage: " << argv0 << " [--cache-line N] [--summary] [TYPE...]\n";
+    return 2;
+}
+
+void write_summary(std::ostream& os, std::vector<rttm::TypeLayout>& layouts) {
+    std::stable_sort(layouts.begin(), layouts.end(), [](const rttm::TypeLayout& a, const rttm::TypeLayout& b) {
+        return a.gap_bytes() > b.gap_bytes();
+    });
+    os << std::setw(8) << "size" << std::setw(8) << "gaps" << std::setw(8) << "saves" << std::setw(8) << "lines"
+       << "  type\n";
+    for (const rttm::TypeLayout& layout : layouts) {
+        os << std::setw(8) << layout.type->size << std::setw(8) << layout.gap_bytes()
+           << std::setw(8) << layout.suggested_savings() << std::setw(8) << layout.lines << "  "
+           << layout.type->name << (layout.has_line_issues() ? " [cache line issues]" : "") << '\n';
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t cache_line = rttm::default_cache_line;
+    bool summary = false;
+    std::vector<std::string_view> selected;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--cache-line" && i + 1 < argc) {
+            cache_line = std::strtoull(argv[++i], nullptr, 10);
+            if (cache_line == 0 || (cache_line & (cache_line - 1)) != 0) {
+                std::cerr << "cache line size must be a power of two\n";
+                return 2;
+            }
+        } else if (arg == "--summary") {
+            summary = true;
+        } else if (arg.starts_with("--")) {
+            return usage(argv[0]);
+        } else {
+            selected.push_back(arg);
+        }
+    }
+
+    auto& mgr = rttm::detail::TypeManager::instance();
+    std::vector<std::string_view> names = selected.empty() ? mgr.get_all_type_names() : selected;
+    std::sort(names.begin(), names.end());
+
+    std::vector<rttm::TypeLayout> layouts;
+    for (std::string_view name : names) {
+        const rttm::detail::TypeInfo* info = mgr.get_type(name);
+        if (!info) {
+            std::cerr << "type not registered: " << name << '\n';
+            return 1;
+        }
+        layouts.push_back(rttm::analyze_layout(*info, cache_line));
+    }
+
+    if (summary) {
+        write_summary(std::cout, layouts);
+        return 0;
+    }
+    for (const rttm::TypeLayout& layout : layouts) {
+        rttm::write_layout_report(std::cout, layout);
+        std::cout << '\n';
+    }
+    return 0;
+}